@@ -0,0 +1,80 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/binary_filter/lz4_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    // The LZ4 filter compresses the archive data in frames of bounded size
+    // (hpx.plugins.lz4_serialization_filter.frame_size) while the data is
+    // being serialized. It uses the same frame layout as the lz4 filter and
+    // trades compression ratio for speed, the speed can be further increased
+    // using hpx.plugins.lz4_serialization_filter.acceleration. Frames that do
+    // not compress well are stored uncompressed, after such a frame only
+    // every n-th frame is compressed to sample whether the data has become
+    // compressible again. Messages smaller than
+    // hpx.plugins.lz4_serialization_filter.min_size are never compressed.
+    struct HPX_LIBRARY_EXPORT lz4_serialization_filter
+      : public serialization::binary_filter
+    {
+        explicit lz4_serialization_filter(bool compress = false,
+            serialization::binary_filter* next_filter = nullptr);
+
+        void load(void* dst, std::size_t dst_count) override;
+        void save(void const* src, std::size_t src_count) override;
+        bool flush(
+            void* dst, std::size_t dst_count, std::size_t& written) override;
+
+        void set_max_length(std::size_t size) override;
+        std::size_t init_data(void const* buffer, std::size_t size,
+            std::size_t buffer_size) override;
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, const unsigned int)
+        {
+        }
+
+        HPX_SERIALIZATION_POLYMORPHIC(lz4_serialization_filter, override);
+
+        void compress_frame();
+        void store_frame();
+        std::size_t decompress_frame(char* dst, std::size_t dst_count);
+
+        std::vector<char> frame_;     // uncompressed data of current frame
+        std::vector<char> buffer_;    // compressed frames
+        std::size_t current_;
+        std::size_t num_frames_;
+        std::size_t frame_size_;
+
+        // the data to decompress
+        char const* src_;
+        std::size_t src_size_;
+
+        bool compress_;
+        bool skip_compression_;
+        bool flushed_;
+    };
+}    // namespace hpx::plugins::compression
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
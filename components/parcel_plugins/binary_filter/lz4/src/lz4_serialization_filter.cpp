@@ -0,0 +1,321 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/binary_filter/lz4_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <lz4.h>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        // Each frame starts with its uncompressed size and its stored size,
+        // the highest bit of the stored size marks uncompressed frames.
+        constexpr std::size_t frame_header_size = 2 * sizeof(std::uint32_t);
+        constexpr std::uint32_t frame_uncompressed = 0x80000000;
+
+        // Frames shrinking to more than 90% of their size are considered to
+        // be incompressible. After an incompressible frame only every 8th
+        // frame is compressed.
+        constexpr std::size_t incompressible_ratio = 90;
+        constexpr std::size_t sample_interval = 8;
+
+        struct lz4_configuration
+        {
+            lz4_configuration()
+              : acceleration(hpx::util::from_string<int>(hpx::get_config_entry(
+                    "hpx.plugins.lz4_serialization_filter.acceleration", "1")))
+              , frame_size(hpx::util::from_string<std::size_t>(
+                    hpx::get_config_entry(
+                        "hpx.plugins.lz4_serialization_filter.frame_size",
+                        "65536")))
+              , min_size(hpx::util::from_string<std::size_t>(
+                    hpx::get_config_entry(
+                        "hpx.plugins.lz4_serialization_filter.min_size",
+                        "1024")))
+            {
+                acceleration = (std::max) (acceleration, 1);
+                frame_size = (std::clamp) (frame_size, std::size_t(1024),
+                    std::size_t(LZ4_MAX_INPUT_SIZE));
+            }
+
+            int acceleration;
+            std::size_t frame_size;
+            std::size_t min_size;
+        };
+
+        lz4_configuration const& get_configuration()
+        {
+            static lz4_configuration const config;
+            return config;
+        }
+
+        void write_frame_header(
+            char* dst, std::size_t raw_size, std::uint32_t stored_size)
+        {
+            auto const size = static_cast<std::uint32_t>(raw_size);
+            std::memcpy(dst, &size, sizeof(size));
+            std::memcpy(dst + sizeof(size), &stored_size, sizeof(stored_size));
+        }
+    }    // namespace detail
+
+    lz4_serialization_filter::lz4_serialization_filter(
+        bool compress, serialization::binary_filter*)
+      : current_(0)
+      , num_frames_(0)
+      , frame_size_(detail::get_configuration().frame_size)
+      , src_(nullptr)
+      , src_size_(0)
+      , compress_(compress)
+      , skip_compression_(false)
+      , flushed_(false)
+    {
+    }
+
+    void lz4_serialization_filter::set_max_length(std::size_t size)
+    {
+        frame_.reserve((std::min) (size, frame_size_));
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::save(void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        while (src_count != 0)
+        {
+            std::size_t const count =
+                (std::min) (src_count, frame_size_ - frame_.size());
+            frame_.insert(frame_.end(), src_begin, src_begin + count);
+            src_begin += count;
+            src_count -= count;
+
+            if (frame_.size() == frame_size_)
+                compress_frame();
+        }
+    }
+
+    void lz4_serialization_filter::compress_frame()
+    {
+        if (frame_.empty())
+            return;
+
+        // sample the compression ratio if the previous frame was not
+        // compressible
+        if (skip_compression_ && num_frames_ % detail::sample_interval != 0)
+        {
+            store_frame();
+            return;
+        }
+
+        int const raw_size = static_cast<int>(frame_.size());
+        int const bound = LZ4_compressBound(raw_size);
+
+        std::size_t const offset = buffer_.size();
+        buffer_.resize(offset + detail::frame_header_size + bound);
+
+        int const stored_size = LZ4_compress_fast(frame_.data(),
+            buffer_.data() + offset + detail::frame_header_size, raw_size,
+            bound, detail::get_configuration().acceleration);
+
+        if (stored_size <= 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::compress_frame",
+                "compression failure");
+        }
+
+        if (static_cast<std::size_t>(stored_size) * 100 >=
+            frame_.size() * detail::incompressible_ratio)
+        {
+            buffer_.resize(offset);
+            skip_compression_ = true;
+            store_frame();
+            return;
+        }
+
+        buffer_.resize(offset + detail::frame_header_size + stored_size);
+        detail::write_frame_header(buffer_.data() + offset, frame_.size(),
+            static_cast<std::uint32_t>(stored_size));
+
+        skip_compression_ = false;
+        ++num_frames_;
+        frame_.clear();
+    }
+
+    void lz4_serialization_filter::store_frame()
+    {
+        std::size_t const offset = buffer_.size();
+        buffer_.resize(offset + detail::frame_header_size + frame_.size());
+        detail::write_frame_header(buffer_.data() + offset, frame_.size(),
+            static_cast<std::uint32_t>(frame_.size()) |
+                detail::frame_uncompressed);
+        std::memcpy(buffer_.data() + offset + detail::frame_header_size,
+            frame_.data(), frame_.size());
+
+        ++num_frames_;
+        frame_.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool lz4_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        if (!flushed_)
+        {
+            // small messages are not worth compressing
+            if (num_frames_ == 0 &&
+                frame_.size() < detail::get_configuration().min_size)
+            {
+                if (!frame_.empty())
+                    store_frame();
+            }
+            else
+            {
+                compress_frame();
+            }
+            flushed_ = true;
+        }
+
+        // the container may provide less space than needed, the remaining
+        // data is written by subsequent calls
+        written = (std::min) (dst_count, buffer_.size() - current_);
+        if (written != 0)
+        {
+            std::memcpy(dst, buffer_.data() + current_, written);
+            current_ += written;
+        }
+
+        return current_ == buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        // frames are decompressed on demand
+        src_ = static_cast<char const*>(buffer);
+        src_size_ = size;
+        frame_.clear();
+        current_ = 0;
+        return buffer_size;
+    }
+
+    // Decompress the next frame into the given destination, return the
+    // uncompressed size of the frame. Nothing is decompressed if the frame
+    // does not fit.
+    std::size_t lz4_serialization_filter::decompress_frame(
+        char* dst, std::size_t dst_count)
+    {
+        if (src_size_ < detail::frame_header_size)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::load",
+                "archive data bstream is too short");
+        }
+
+        std::uint32_t raw_size = 0;
+        std::uint32_t stored_size = 0;
+        std::memcpy(&raw_size, src_, sizeof(raw_size));
+        std::memcpy(&stored_size, src_ + sizeof(raw_size), sizeof(stored_size));
+
+        if (raw_size > dst_count)
+            return raw_size;
+
+        bool const uncompressed = (stored_size & detail::frame_uncompressed);
+        stored_size &= ~detail::frame_uncompressed;
+
+        char const* src = src_ + detail::frame_header_size;
+        if (src_size_ - detail::frame_header_size < stored_size)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::load",
+                "archive data bstream is too short");
+        }
+
+        if (uncompressed)
+        {
+            if (stored_size != raw_size)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "lz4_serialization_filter::load",
+                    "archive data bstream structure mismatch");
+            }
+            std::memcpy(dst, src, raw_size);
+        }
+        else
+        {
+            int const size = LZ4_decompress_safe(src, dst,
+                static_cast<int>(stored_size), static_cast<int>(raw_size));
+
+            if (size < 0 || static_cast<std::uint32_t>(size) != raw_size)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "lz4_serialization_filter::load", "decompression failure");
+            }
+        }
+
+        src_ += detail::frame_header_size + stored_size;
+        src_size_ -= detail::frame_header_size + stored_size;
+        return raw_size;
+    }
+
+    void lz4_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        char* dst_begin = static_cast<char*>(dst);
+        while (dst_count != 0)
+        {
+            if (current_ == frame_.size())
+            {
+                // decompress directly into the destination if it covers the
+                // whole frame
+                std::size_t const size =
+                    decompress_frame(dst_begin, dst_count);
+                if (size <= dst_count)
+                {
+                    dst_begin += size;
+                    dst_count -= size;
+                    continue;
+                }
+
+                frame_.resize(size);
+                decompress_frame(frame_.data(), size);
+                current_ = 0;
+            }
+
+            std::size_t const count =
+                (std::min) (dst_count, frame_.size() - current_);
+            std::memcpy(dst_begin, frame_.data() + current_, count);
+            current_ += count;
+            dst_begin += count;
+            dst_count -= count;
+        }
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -0,0 +1,297 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the frame format written by the lz4 filter, the handling of small
+// and incompressible data, and the round trip of chunks above the zero-copy
+// threshold through a compressing archive.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE) && defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/compression_lz4.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using filter_type = hpx::plugins::compression::lz4_serialization_filter;
+
+///////////////////////////////////////////////////////////////////////////////
+// the filter is configured with these sizes, see main() below
+constexpr std::size_t frame_size = 4096;
+constexpr std::size_t min_size = 1024;
+
+constexpr std::size_t frame_header_size = 2 * sizeof(std::uint32_t);
+constexpr std::uint32_t frame_uncompressed = 0x80000000;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<char> compressible_data(std::size_t size)
+{
+    std::string const text = "The quick brown fox jumps over the lazy dog. ";
+
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = text[i % text.size()];
+    }
+    return data;
+}
+
+std::vector<char> incompressible_data(std::size_t size, unsigned int seed = 0)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+
+    std::vector<char> data(size);
+    for (char& c : data)
+    {
+        c = static_cast<char>(dist(gen));
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<char> compress(std::vector<char> const& data)
+{
+    filter_type filter(true);
+    filter.set_max_length(data.size());
+
+    // pass the data in pieces not aligned with the frames
+    std::size_t pos = 0;
+    while (pos != data.size())
+    {
+        std::size_t const count =
+            (std::min) (data.size() - pos, std::size_t(1000));
+        filter.save(data.data() + pos, count);
+        pos += count;
+    }
+
+    // start with a small buffer to exercise repeated calls to flush
+    std::vector<char> compressed(16);
+    std::size_t size = 0;
+    while (true)
+    {
+        std::size_t written = 0;
+        bool const flushed = filter.flush(
+            compressed.data() + size, compressed.size() - size, written);
+        size += written;
+        if (flushed)
+        {
+            break;
+        }
+        compressed.resize(2 * compressed.size());
+    }
+    compressed.resize(size);
+    return compressed;
+}
+
+std::vector<char> decompress(
+    std::vector<char> const& compressed, std::size_t size)
+{
+    filter_type filter;
+    filter.init_data(compressed.data(), compressed.size(), size);
+
+    // load the data in pieces of growing size, both smaller and larger than
+    // a frame
+    std::vector<char> data(size);
+    std::size_t pos = 0;
+    std::size_t step = 1;
+    while (pos != size)
+    {
+        std::size_t const count = (std::min) (size - pos, step);
+        filter.load(data.data() + pos, count);
+        pos += count;
+        step = 3 * step + 1;
+    }
+    return data;
+}
+
+struct frame_header
+{
+    std::uint32_t raw_size;
+    std::uint32_t stored_size;
+    bool uncompressed;
+};
+
+std::vector<frame_header> parse_frames(std::vector<char> const& compressed)
+{
+    std::vector<frame_header> frames;
+
+    std::size_t pos = 0;
+    while (pos != compressed.size())
+    {
+        HPX_TEST_LTE(pos + frame_header_size, compressed.size());
+        if (pos + frame_header_size > compressed.size())
+        {
+            break;
+        }
+
+        frame_header h{};
+        std::memcpy(&h.raw_size, compressed.data() + pos, sizeof(h.raw_size));
+        std::memcpy(&h.stored_size,
+            compressed.data() + pos + sizeof(h.raw_size),
+            sizeof(h.stored_size));
+        h.uncompressed = (h.stored_size & frame_uncompressed) != 0;
+        h.stored_size &= ~frame_uncompressed;
+
+        frames.push_back(h);
+        pos += frame_header_size + h.stored_size;
+    }
+
+    HPX_TEST_EQ(pos, compressed.size());
+    return frames;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_frame_headers()
+{
+    std::size_t const size = 10 * frame_size + frame_size / 2;
+    std::vector<char> const data = compressible_data(size);
+
+    std::vector<char> const compressed = compress(data);
+    HPX_TEST_LT(compressed.size(), data.size());
+
+    // all frames but the last one are full, all of them are compressed
+    std::vector<frame_header> const frames = parse_frames(compressed);
+    HPX_TEST_EQ(frames.size(), std::size_t(11));
+
+    std::size_t raw_size = 0;
+    for (std::size_t i = 0; i != frames.size(); ++i)
+    {
+        HPX_TEST_EQ(frames[i].raw_size,
+            i + 1 != frames.size() ? frame_size : frame_size / 2);
+        HPX_TEST(!frames[i].uncompressed);
+        HPX_TEST_LT(frames[i].stored_size, frames[i].raw_size);
+        raw_size += frames[i].raw_size;
+    }
+    HPX_TEST_EQ(raw_size, size);
+
+    HPX_TEST(decompress(compressed, size) == data);
+}
+
+void test_small_message()
+{
+    // messages below the minimal size are stored as a single uncompressed
+    // frame
+    std::vector<char> const data = compressible_data(min_size / 2);
+
+    std::vector<char> const compressed = compress(data);
+    HPX_TEST_EQ(compressed.size(), frame_header_size + data.size());
+
+    std::vector<frame_header> const frames = parse_frames(compressed);
+    HPX_TEST_EQ(frames.size(), std::size_t(1));
+    HPX_TEST(frames[0].uncompressed);
+    HPX_TEST_EQ(frames[0].raw_size, data.size());
+    HPX_TEST_EQ(frames[0].stored_size, data.size());
+
+    HPX_TEST(decompress(compressed, data.size()) == data);
+}
+
+void test_incompressible()
+{
+    // an incompressible frame disables compression, only every 8th frame is
+    // compressed after that to sample whether the data has become
+    // compressible again
+    std::vector<char> data = incompressible_data(4 * frame_size);
+    std::vector<char> const compressible = compressible_data(12 * frame_size);
+    data.insert(data.end(), compressible.begin(), compressible.end());
+
+    std::vector<char> const compressed = compress(data);
+
+    std::vector<frame_header> const frames = parse_frames(compressed);
+    HPX_TEST_EQ(frames.size(), std::size_t(16));
+    for (std::size_t i = 0; i != frames.size(); ++i)
+    {
+        HPX_TEST_EQ(frames[i].raw_size, frame_size);
+        HPX_TEST_EQ(frames[i].uncompressed, i < 8);
+        if (frames[i].uncompressed)
+        {
+            HPX_TEST_EQ(frames[i].stored_size, frame_size);
+        }
+    }
+
+    HPX_TEST(decompress(compressed, data.size()) == data);
+}
+
+void test_large_chunk()
+{
+    // the vector is larger than the zero-copy threshold, it is still passed
+    // through the filter instead of being sent as a separate chunk
+    std::vector<double> data(64 * 1024);
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        data[i] = static_cast<double>(i % 16);
+    }
+    HPX_TEST_LT(std::size_t(HPX_ZERO_COPY_SERIALIZATION_THRESHOLD),
+        data.size() * sizeof(double));
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::size_t size = 0;
+    {
+        filter_type filter(true);
+        hpx::serialization::output_archive oarchive(buffer,
+            hpx::serialization::archive_flags::enable_compression, &chunks,
+            &filter, HPX_ZERO_COPY_SERIALIZATION_THRESHOLD);
+        oarchive << data;
+        oarchive.flush();
+        size = oarchive.bytes_written();
+    }
+
+    for (auto const& chunk : chunks)
+    {
+        HPX_TEST(chunk.type_ !=
+            hpx::serialization::chunk_type::chunk_type_pointer);
+        HPX_TEST(chunk.type_ !=
+            hpx::serialization::chunk_type::chunk_type_const_pointer);
+    }
+    HPX_TEST_LT(buffer.size(), data.size() * sizeof(double));
+
+    std::vector<double> result;
+    {
+        hpx::serialization::input_archive iarchive(buffer, size, &chunks);
+        iarchive >> result;
+    }
+    HPX_TEST(result == data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map&)
+{
+    test_frame_headers();
+    test_small_message();
+    test_incompressible();
+    test_large_chunk();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.plugins.lz4_serialization_filter.frame_size=" +
+            std::to_string(frame_size),
+        "hpx.plugins.lz4_serialization_filter.min_size=" +
+            std::to_string(min_size),
+    };
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+
+#endif
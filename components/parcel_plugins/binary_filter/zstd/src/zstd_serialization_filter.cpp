@@ -0,0 +1,416 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/binary_filter/zstd_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <zstd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        // Each frame starts with its uncompressed size and its stored size,
+        // the highest bit of the stored size marks uncompressed frames.
+        constexpr std::size_t frame_header_size = 2 * sizeof(std::uint32_t);
+        constexpr std::uint32_t frame_uncompressed = 0x80000000;
+
+        // Frames shrinking to more than 90% of their size are considered to
+        // be incompressible. After an incompressible frame only every 8th
+        // frame is compressed.
+        constexpr std::size_t incompressible_ratio = 90;
+        constexpr std::size_t sample_interval = 8;
+
+        struct zstd_configuration
+        {
+            zstd_configuration()
+              : level(hpx::util::from_string<int>(hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.level", "3")))
+              , frame_size(hpx::util::from_string<std::size_t>(
+                    hpx::get_config_entry(
+                        "hpx.plugins.zstd_serialization_filter.frame_size",
+                        "65536")))
+              , min_size(hpx::util::from_string<std::size_t>(
+                    hpx::get_config_entry(
+                        "hpx.plugins.zstd_serialization_filter.min_size",
+                        "1024")))
+            {
+                frame_size = (std::clamp) (frame_size, std::size_t(1024),
+                    std::size_t(frame_uncompressed - 1));
+
+                std::string const dictionary_file = hpx::get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.dictionary", "");
+                if (dictionary_file.empty())
+                    return;
+
+                std::ifstream in(dictionary_file, std::ios::binary);
+                std::vector<char> const dictionary(
+                    (std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+                if (!in.is_open() || in.bad() || dictionary.empty())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "zstd_serialization_filter",
+                        "could not read zstd dictionary from file: {}",
+                        dictionary_file);
+                }
+
+                cdict.reset(ZSTD_createCDict(
+                    dictionary.data(), dictionary.size(), level));
+                ddict.reset(
+                    ZSTD_createDDict(dictionary.data(), dictionary.size()));
+                if (!cdict || !ddict)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "zstd_serialization_filter",
+                        "invalid zstd dictionary: {}", dictionary_file);
+                }
+            }
+
+            struct cdict_deleter
+            {
+                void operator()(ZSTD_CDict* p) const noexcept
+                {
+                    ZSTD_freeCDict(p);
+                }
+            };
+
+            struct ddict_deleter
+            {
+                void operator()(ZSTD_DDict* p) const noexcept
+                {
+                    ZSTD_freeDDict(p);
+                }
+            };
+
+            int level;
+            std::size_t frame_size;
+            std::size_t min_size;
+            std::unique_ptr<ZSTD_CDict, cdict_deleter> cdict;
+            std::unique_ptr<ZSTD_DDict, ddict_deleter> ddict;
+        };
+
+        zstd_configuration const& get_configuration()
+        {
+            static zstd_configuration const config;
+            return config;
+        }
+
+        // The (de)compression contexts are expensive to create, reuse them
+        // for all filters running on the same OS thread. Filters never
+        // suspend while using a context.
+        struct zstd_contexts
+        {
+            zstd_contexts()
+              : cctx(ZSTD_createCCtx())
+              , dctx(ZSTD_createDCtx())
+            {
+            }
+
+            zstd_contexts(zstd_contexts const&) = delete;
+            zstd_contexts(zstd_contexts&&) = delete;
+            zstd_contexts& operator=(zstd_contexts const&) = delete;
+            zstd_contexts& operator=(zstd_contexts&&) = delete;
+
+            ~zstd_contexts()
+            {
+                ZSTD_freeCCtx(cctx);
+                ZSTD_freeDCtx(dctx);
+            }
+
+            ZSTD_CCtx* cctx;
+            ZSTD_DCtx* dctx;
+        };
+
+        zstd_contexts& get_contexts()
+        {
+            thread_local zstd_contexts contexts;
+            return contexts;
+        }
+
+        void write_frame_header(
+            char* dst, std::size_t raw_size, std::uint32_t stored_size)
+        {
+            auto const size = static_cast<std::uint32_t>(raw_size);
+            std::memcpy(dst, &size, sizeof(size));
+            std::memcpy(dst + sizeof(size), &stored_size, sizeof(stored_size));
+        }
+    }    // namespace detail
+
+    zstd_serialization_filter::zstd_serialization_filter(
+        bool compress, serialization::binary_filter*)
+      : current_(0)
+      , num_frames_(0)
+      , frame_size_(detail::get_configuration().frame_size)
+      , src_(nullptr)
+      , src_size_(0)
+      , compress_(compress)
+      , skip_compression_(false)
+      , flushed_(false)
+    {
+    }
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        frame_.reserve((std::min) (size, frame_size_));
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        while (src_count != 0)
+        {
+            std::size_t const count =
+                (std::min) (src_count, frame_size_ - frame_.size());
+            frame_.insert(frame_.end(), src_begin, src_begin + count);
+            src_begin += count;
+            src_count -= count;
+
+            if (frame_.size() == frame_size_)
+                compress_frame();
+        }
+    }
+
+    void zstd_serialization_filter::compress_frame()
+    {
+        if (frame_.empty())
+            return;
+
+        // sample the compression ratio if the previous frame was not
+        // compressible
+        if (skip_compression_ && num_frames_ % detail::sample_interval != 0)
+        {
+            store_frame();
+            return;
+        }
+
+        auto const& config = detail::get_configuration();
+        ZSTD_CCtx* cctx = detail::get_contexts().cctx;
+
+        std::size_t const offset = buffer_.size();
+        buffer_.resize(offset + detail::frame_header_size +
+            ZSTD_compressBound(frame_.size()));
+
+        char* dst = buffer_.data() + offset + detail::frame_header_size;
+        std::size_t const dst_size =
+            buffer_.size() - offset - detail::frame_header_size;
+
+        std::size_t const stored_size = config.cdict ?
+            ZSTD_compress_usingCDict(cctx, dst, dst_size, frame_.data(),
+                frame_.size(), config.cdict.get()) :
+            ZSTD_compressCCtx(cctx, dst, dst_size, frame_.data(),
+                frame_.size(), config.level);
+
+        if (ZSTD_isError(stored_size))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::compress_frame",
+                "compression failure: {}", ZSTD_getErrorName(stored_size));
+        }
+
+        if (stored_size * 100 >= frame_.size() * detail::incompressible_ratio)
+        {
+            buffer_.resize(offset);
+            skip_compression_ = true;
+            store_frame();
+            return;
+        }
+
+        buffer_.resize(offset + detail::frame_header_size + stored_size);
+        detail::write_frame_header(buffer_.data() + offset, frame_.size(),
+            static_cast<std::uint32_t>(stored_size));
+
+        skip_compression_ = false;
+        ++num_frames_;
+        frame_.clear();
+    }
+
+    void zstd_serialization_filter::store_frame()
+    {
+        std::size_t const offset = buffer_.size();
+        buffer_.resize(offset + detail::frame_header_size + frame_.size());
+        detail::write_frame_header(buffer_.data() + offset, frame_.size(),
+            static_cast<std::uint32_t>(frame_.size()) |
+                detail::frame_uncompressed);
+        std::memcpy(buffer_.data() + offset + detail::frame_header_size,
+            frame_.data(), frame_.size());
+
+        ++num_frames_;
+        frame_.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        if (!flushed_)
+        {
+            // small messages are not worth compressing
+            if (num_frames_ == 0 &&
+                frame_.size() < detail::get_configuration().min_size)
+            {
+                if (!frame_.empty())
+                    store_frame();
+            }
+            else
+            {
+                compress_frame();
+            }
+            flushed_ = true;
+        }
+
+        // the container may provide less space than needed, the remaining
+        // data is written by subsequent calls
+        written = (std::min) (dst_count, buffer_.size() - current_);
+        if (written != 0)
+        {
+            std::memcpy(dst, buffer_.data() + current_, written);
+            current_ += written;
+        }
+
+        return current_ == buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        // frames are decompressed on demand
+        src_ = static_cast<char const*>(buffer);
+        src_size_ = size;
+        frame_.clear();
+        current_ = 0;
+        return buffer_size;
+    }
+
+    // Decompress the next frame into the given destination, return the
+    // uncompressed size of the frame. Nothing is decompressed if the frame
+    // does not fit.
+    std::size_t zstd_serialization_filter::decompress_frame(
+        char* dst, std::size_t dst_count)
+    {
+        if (src_size_ < detail::frame_header_size)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::load",
+                "archive data bstream is too short");
+        }
+
+        std::uint32_t raw_size = 0;
+        std::uint32_t stored_size = 0;
+        std::memcpy(&raw_size, src_, sizeof(raw_size));
+        std::memcpy(&stored_size, src_ + sizeof(raw_size), sizeof(stored_size));
+
+        if (raw_size > dst_count)
+            return raw_size;
+
+        bool const uncompressed = (stored_size & detail::frame_uncompressed);
+        stored_size &= ~detail::frame_uncompressed;
+
+        char const* src = src_ + detail::frame_header_size;
+        if (src_size_ - detail::frame_header_size < stored_size)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::load",
+                "archive data bstream is too short");
+        }
+
+        if (uncompressed)
+        {
+            if (stored_size != raw_size)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "zstd_serialization_filter::load",
+                    "archive data bstream structure mismatch");
+            }
+            std::memcpy(dst, src, raw_size);
+        }
+        else
+        {
+            auto const& config = detail::get_configuration();
+            ZSTD_DCtx* dctx = detail::get_contexts().dctx;
+
+            std::size_t const size = config.ddict ?
+                ZSTD_decompress_usingDDict(
+                    dctx, dst, raw_size, src, stored_size, config.ddict.get()) :
+                ZSTD_decompressDCtx(dctx, dst, raw_size, src, stored_size);
+
+            if (ZSTD_isError(size) || size != raw_size)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "zstd_serialization_filter::load",
+                    "decompression failure: {}",
+                    ZSTD_isError(size) ? ZSTD_getErrorName(size) :
+                                         "frame size mismatch");
+            }
+        }
+
+        src_ += detail::frame_header_size + stored_size;
+        src_size_ -= detail::frame_header_size + stored_size;
+        return raw_size;
+    }
+
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        char* dst_begin = static_cast<char*>(dst);
+        while (dst_count != 0)
+        {
+            if (current_ == frame_.size())
+            {
+                // decompress directly into the destination if it covers the
+                // whole frame
+                std::size_t const size =
+                    decompress_frame(dst_begin, dst_count);
+                if (size <= dst_count)
+                {
+                    dst_begin += size;
+                    dst_count -= size;
+                    continue;
+                }
+
+                frame_.resize(size);
+                decompress_frame(frame_.data(), size);
+                current_ = 0;
+            }
+
+            std::size_t const count =
+                (std::min) (dst_count, frame_.size() - current_);
+            std::memcpy(dst_begin, frame_.data() + current_, count);
+            current_ += count;
+            dst_begin += count;
+            dst_count -= count;
+        }
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -0,0 +1,127 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+#include <hpx/assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::plugins::parcel::detail {
+
+    // Histogram of the time between consecutive parcels (in nanoseconds)
+    // using logarithmic buckets, bucket i holds the values in [2^i, 2^(i+1)).
+    // The histogram is used to adapt the coalescing parameters, it is decayed
+    // after each adaptation step so that it follows changes of the
+    // application behavior.
+    class arrival_statistics
+    {
+    public:
+        static constexpr std::size_t num_buckets = 48;
+
+        void add(std::int64_t time_between_parcels) noexcept
+        {
+            std::size_t bucket = 0;
+            if (time_between_parcels > 1)
+            {
+                auto value = static_cast<std::uint64_t>(time_between_parcels);
+                while (value >>= 1)
+                    ++bucket;
+            }
+
+            ++buckets_[(std::min) (bucket, num_buckets - 1)];
+            ++count_;
+        }
+
+        [[nodiscard]] constexpr std::size_t count() const noexcept
+        {
+            return count_;
+        }
+
+        // Return the (approximate) time between parcels that is not exceeded
+        // by the given fraction of all recorded values.
+        [[nodiscard]] std::int64_t percentile(double fraction) const noexcept
+        {
+            HPX_ASSERT(fraction >= 0.0 && fraction <= 1.0);
+            if (count_ == 0)
+                return 0;
+
+            auto const threshold = static_cast<std::size_t>(
+                fraction * static_cast<double>(count_));
+
+            std::size_t seen = 0;
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                seen += buckets_[i];
+                if (seen > threshold || seen == count_)
+                {
+                    // use the geometric center of the bucket
+                    return static_cast<std::int64_t>(
+                        (std::uint64_t(3) << i) / 2);
+                }
+            }
+            return static_cast<std::int64_t>(std::uint64_t(1) << num_buckets);
+        }
+
+        // Halve all counts, older values lose weight over time.
+        void decay() noexcept
+        {
+            count_ = 0;
+            for (auto& bucket : buckets_)
+            {
+                bucket /= 2;
+                count_ += bucket;
+            }
+        }
+
+    private:
+        std::array<std::size_t, num_buckets> buckets_ = {};
+        std::size_t count_ = 0;
+    };
+
+    // Coalescing parameters derived from the observed parcel arrivals.
+    struct coalescing_parameters
+    {
+        std::size_t num_parcels;    // number of parcels per message
+        std::size_t interval;       // flush interval (in microseconds)
+    };
+
+    // Choose the number of parcels to coalesce such that the first parcel of
+    // a message is expected to wait no longer than the given latency target
+    // (in microseconds) for the message to fill up. The flush interval is set
+    // to the time the message is expected to be full, it never exceeds the
+    // latency target.
+    inline coalescing_parameters adapt_coalescing_parameters(
+        arrival_statistics const& arrivals, std::size_t latency_target,
+        std::size_t max_parcels) noexcept
+    {
+        // the median is not affected by the occasional pause between bursts
+        // of parcels
+        std::int64_t const time_between_parcels =
+            (std::max) (arrivals.percentile(0.5), std::int64_t(1));
+
+        auto const target = static_cast<std::int64_t>(latency_target) * 1000;
+        auto const num_parcels = static_cast<std::size_t>((std::clamp) (
+            target / time_between_parcels, std::int64_t(1),
+            static_cast<std::int64_t>((std::max) (max_parcels, std::size_t(1)))));
+
+        auto const fill_time = static_cast<std::size_t>(
+            (static_cast<std::int64_t>(num_parcels + 1) * time_between_parcels +
+                999) /
+            1000);
+
+        return {num_parcels,
+            (std::max) ((std::min) (fill_time, latency_target), std::size_t(1))};
+    }
+}    // namespace hpx::plugins::parcel::detail
+
+#endif
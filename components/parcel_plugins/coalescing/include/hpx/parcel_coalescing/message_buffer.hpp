@@ -164,6 +164,16 @@ namespace hpx::plugins::parcel::detail {
             return max_messages_;
         }
 
+        // Change the number of messages the buffer holds before it is full,
+        // a buffer already holding that many messages is reported full by
+        // the next append.
+        void set_capacity(std::size_t max_messages)
+        {
+            max_messages_ = max_messages;
+            messages_.reserve(max_messages_);
+            handlers_.reserve(max_messages_);
+        }
+
     private:
         parcelset::locality dest_;
         std::vector<parcelset::parcel> messages_;
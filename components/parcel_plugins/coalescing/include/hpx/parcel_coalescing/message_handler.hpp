@@ -15,6 +15,7 @@
 #include <hpx/modules/statistics.hpp>
 #include <hpx/modules/synchronization.hpp>
 
+#include <hpx/parcel_coalescing/arrival_statistics.hpp>
 #include <hpx/parcel_coalescing/message_buffer.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
 
@@ -74,12 +75,27 @@ namespace hpx::plugins::parcel {
 
         void update_num_messages();
         void update_interval();
+        void update_latency_target();
+
+        // recompute number of coalesced parcels and flush interval from the
+        // observed parcel arrivals (adaptive mode only)
+        void adapt_parameters();
 
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
         std::size_t num_coalesced_parcels_;
         std::size_t interval_;
+
+        // adaptive coalescing: num_coalesced_parcels_ and interval_ are
+        // derived from the observed parcel arrivals, max_coalesced_parcels_
+        // (the configured number of messages) is the upper limit of the
+        // number of parcels per message
+        bool adaptive_;
+        std::size_t max_coalesced_parcels_;
+        std::size_t latency_target_;
+        detail::arrival_statistics arrivals_;
+
         detail::message_buffer buffer_;
         util::pool_timer timer_;
         bool stopped_;
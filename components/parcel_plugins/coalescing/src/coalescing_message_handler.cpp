@@ -42,6 +42,8 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      latency_target = 100
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -50,7 +52,9 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "latency_target = 100";
         }
     };
 }    // namespace hpx::traits
@@ -85,19 +89,68 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string const value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        // the documented default of the latency_target setting (in
+        // microseconds), see plugin_config_data above
+        constexpr std::size_t default_latency_target = 100;
+
+        std::size_t get_latency_target(std::size_t latency_target)
+        {
+            return hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.latency_target",
+                latency_target));
+        }
+
+        // number of parcel arrivals between two adaptation steps
+        constexpr std::size_t adaptation_period = 64;
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        num_coalesced_parcels_ =
-            detail::get_num_messages(num_coalesced_parcels_);
+        max_coalesced_parcels_ =
+            detail::get_num_messages(max_coalesced_parcels_);
+        if (!adaptive_)
+        {
+            num_coalesced_parcels_ = max_coalesced_parcels_;
+        }
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        interval_ = detail::get_interval(interval_);
+        if (!adaptive_)
+        {
+            interval_ = detail::get_interval(interval_);
+        }
+    }
+
+    void coalescing_message_handler::update_latency_target()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        latency_target_ = detail::get_latency_target(latency_target_);
+    }
+
+    void coalescing_message_handler::adapt_parameters()
+    {
+        detail::coalescing_parameters const params =
+            detail::adapt_coalescing_parameters(
+                arrivals_, latency_target_, max_coalesced_parcels_);
+
+        // the new number of parcels applies to the current buffer already,
+        // it is flushed once it holds that many parcels
+        num_coalesced_parcels_ = params.num_parcels;
+        interval_ = params.interval;
+        buffer_.set_capacity(num_coalesced_parcels_);
+
+        arrivals_.decay();
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -106,6 +159,10 @@ namespace hpx::plugins::parcel {
       : pp_(pp)
       , num_coalesced_parcels_(detail::get_num_messages(num))
       , interval_(detail::get_interval(interval))
+      , adaptive_(detail::get_adaptive())
+      , max_coalesced_parcels_(num_coalesced_parcels_)
+      , latency_target_(
+            detail::get_latency_target(detail::default_latency_target))
       , buffer_(num_coalesced_parcels_)
       , timer_(hpx::bind_back(&coalescing_message_handler::timer_flush, this),
             hpx::bind_back(&coalescing_message_handler::flush_terminate, this),
@@ -150,6 +207,10 @@ namespace hpx::plugins::parcel {
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             hpx::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.latency_target",
+            hpx::bind(
+                &coalescing_message_handler::update_latency_target, this));
     }
 
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
@@ -169,6 +230,13 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        if (adaptive_)
+        {
+            arrivals_.add(time_since_last_parcel);
+            if (arrivals_.count() >= detail::adaptation_period)
+                adapt_parameters();
+        }
+
         std::chrono::microseconds const interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
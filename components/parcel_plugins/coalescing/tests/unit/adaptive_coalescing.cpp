@@ -0,0 +1,112 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Invoke an action using message coalescing in bursts with the adaptive mode
+// of the coalescing message handler enabled. All invocations have to
+// complete, and the parcels of a burst have to be sent in fewer messages than
+// there are parcels.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_bursts = 10;
+constexpr std::size_t burst_size = 1000;
+
+std::size_t identity(std::size_t i)
+{
+    return i;
+}
+HPX_DECLARE_PLAIN_ACTION(identity, identity_action)
+HPX_ACTION_USES_MESSAGE_COALESCING(identity_action)
+HPX_PLAIN_ACTION(identity, identity_action)
+
+std::int64_t counter_value(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(name);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bursts(hpx::id_type const& id)
+{
+    identity_action act;
+    for (std::size_t burst = 0; burst != num_bursts; ++burst)
+    {
+        std::vector<hpx::future<std::size_t>> results;
+        results.reserve(burst_size);
+        for (std::size_t i = 0; i != burst_size; ++i)
+        {
+            results.push_back(hpx::async(act, id, i));
+        }
+
+        hpx::wait_all(results);
+        for (std::size_t i = 0; i != burst_size; ++i)
+        {
+            HPX_TEST_EQ(results[i].get(), i);
+        }
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map&)
+{
+    std::vector<hpx::id_type> const localities = hpx::find_remote_localities();
+    for (hpx::id_type const& id : localities)
+    {
+        test_bursts(id);
+    }
+
+    if (!localities.empty())
+    {
+        std::int64_t const parcels = counter_value(
+            "/coalescing{locality#0/total}/count/parcels@identity_action");
+        std::int64_t const messages = counter_value(
+            "/coalescing{locality#0/total}/count/messages@identity_action");
+
+        HPX_TEST_EQ(parcels,
+            static_cast<std::int64_t>(
+                localities.size() * num_bursts * burst_size));
+        HPX_TEST_LT(std::int64_t(0), messages);
+        HPX_TEST_LT(messages, parcels);
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // explicitly enable message handlers (parcel coalescing) in adaptive
+    // mode, the latency target is large enough for the parcels of a burst to
+    // be coalesced
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.adaptive=1",
+        "hpx.plugins.coalescing_message_handler.latency_target=10000",
+    };
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,90 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcel_coalescing/arrival_statistics.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using hpx::plugins::parcel::detail::adapt_coalescing_parameters;
+using hpx::plugins::parcel::detail::arrival_statistics;
+
+void test_percentile()
+{
+    arrival_statistics arrivals;
+    HPX_TEST_EQ(arrivals.percentile(0.5), std::int64_t(0));
+
+    // 90 parcels arriving 1us apart, 10 after a pause of 1ms
+    for (int i = 0; i != 90; ++i)
+        arrivals.add(1000);
+    for (int i = 0; i != 10; ++i)
+        arrivals.add(1000000);
+
+    HPX_TEST_EQ(arrivals.count(), std::size_t(100));
+
+    // values are reported with the precision of the logarithmic buckets
+    std::int64_t const median = arrivals.percentile(0.5);
+    HPX_TEST_LTE(std::int64_t(512), median);
+    HPX_TEST_LTE(median, std::int64_t(2048));
+
+    std::int64_t const tail = arrivals.percentile(0.95);
+    HPX_TEST_LTE(std::int64_t(524288), tail);
+    HPX_TEST_LTE(tail, std::int64_t(2097152));
+
+    // decaying keeps the shape of the distribution
+    arrivals.decay();
+    HPX_TEST_EQ(arrivals.count(), std::size_t(50));
+    HPX_TEST_EQ(arrivals.percentile(0.5), median);
+}
+
+void test_adapt_parameters()
+{
+    // dense traffic: parcels 1us apart, 100us latency target
+    {
+        arrival_statistics arrivals;
+        for (int i = 0; i != 64; ++i)
+            arrivals.add(1000);
+
+        auto const params = adapt_coalescing_parameters(arrivals, 100, 1000);
+        HPX_TEST_LTE(std::size_t(50), params.num_parcels);
+        HPX_TEST_LTE(params.num_parcels, std::size_t(200));
+        HPX_TEST_LTE(params.interval, std::size_t(100));
+
+        // the configured number of messages is the upper limit
+        auto const limited = adapt_coalescing_parameters(arrivals, 100, 10);
+        HPX_TEST_EQ(limited.num_parcels, std::size_t(10));
+        HPX_TEST_LTE(limited.interval, std::size_t(100));
+    }
+
+    // sparse traffic: parcels 1ms apart, nothing to coalesce
+    {
+        arrival_statistics arrivals;
+        for (int i = 0; i != 64; ++i)
+            arrivals.add(1000000);
+
+        auto const params = adapt_coalescing_parameters(arrivals, 100, 1000);
+        HPX_TEST_EQ(params.num_parcels, std::size_t(1));
+        HPX_TEST_EQ(params.interval, std::size_t(100));
+    }
+}
+
+int main()
+{
+    test_percentile();
+    test_adapt_parameters();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,64 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // Find the intersection of the merge path of the sorted sequences
+    // [first1, first1 + len1) and [first2, first2 + len2) with the given
+    // diagonal. Returns the number of elements i taken from the first
+    // sequence such that the first 'diagonal' elements of the merged sequence
+    // are the first i elements of the first sequence and the first
+    // 'diagonal - i' elements of the second sequence. The merge is stable,
+    // elements of the first sequence precede equivalent elements of the
+    // second sequence.
+    //
+    // Splitting the output of a merge at equidistant diagonals gives chunks
+    // of exactly the same size, independently of how the elements of the two
+    // sequences interleave.
+    template <typename Iter1, typename Iter2, typename Comp, typename Proj1,
+        typename Proj2>
+    constexpr std::size_t merge_path_split(Iter1 first1, std::size_t len1,
+        Iter2 first2, std::size_t len2, std::size_t diagonal, Comp&& comp,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        HPX_ASSERT(diagonal <= len1 + len2);
+
+        std::size_t low = diagonal > len2 ? diagonal - len2 : 0;
+        std::size_t high = (std::min) (diagonal, len1);
+
+        // the element i of the first sequence is part of the first
+        // 'diagonal' elements if it is not greater than the element
+        // 'diagonal - i - 1' of the second sequence
+        while (low < high)
+        {
+            std::size_t const i = low + (high - low) / 2;
+            if (HPX_INVOKE(comp,
+                    HPX_INVOKE(proj2, *std::next(first2, diagonal - i - 1)),
+                    HPX_INVOKE(proj1, *std::next(first1, i))))
+            {
+                high = i;
+            }
+            else
+            {
+                low = i + 1;
+            }
+        }
+        return low;
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,382 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // Sequences shorter than this are sorted using std::sort, the overheads
+    // of the histograms dominate otherwise.
+    inline constexpr std::size_t radix_sort_limit = 4096;
+
+    // Minimal number of elements handled by one chunk of each pass.
+    inline constexpr std::size_t radix_sort_limit_per_task = 65536;
+
+    // Number of bits of the key that are sorted by each pass.
+    inline constexpr std::size_t radix_sort_bits = 8;
+    inline constexpr std::size_t radix_sort_buckets = std::size_t(1)
+        << radix_sort_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map an arithmetic key onto an unsigned integer of the same size such
+    // that the order of the unsigned integers is the order of the keys.
+    template <typename T, typename Enable = void>
+    struct radix_sort_key
+    {
+        static constexpr bool value = false;
+    };
+
+    template <typename T>
+    struct radix_sort_key<T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static constexpr bool value = true;
+
+        using type = std::make_unsigned_t<T>;
+
+        // flip the sign bit of signed integers to move the negative values
+        // in front of the positive ones
+        static constexpr type sign_bit = std::is_signed_v<T> ?
+            static_cast<type>(type(1) << (sizeof(T) * CHAR_BIT - 1)) :
+            type(0);
+
+        static constexpr type convert(T value) noexcept
+        {
+            return static_cast<type>(static_cast<type>(value) ^ sign_bit);
+        }
+    };
+
+    template <typename T>
+    struct radix_sort_key<T,
+        std::enable_if_t<std::is_floating_point_v<T> &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>>
+    {
+        static constexpr bool value = true;
+
+        using type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+
+        static constexpr type sign_bit = type(1)
+            << (sizeof(T) * CHAR_BIT - 1);
+
+        // flip all bits of negative values (reversing their order) and the
+        // sign bit of positive values
+        static type convert(T value) noexcept
+        {
+            type bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            return bits ^ ((bits & sign_bit) != 0 ? ~type(0) : sign_bit);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Only the comparison operators that order by the natural order of the
+    // keys can be replaced by a radix sort.
+    template <typename T, typename Comp>
+    inline constexpr bool is_radix_sort_less_v =
+        std::is_same_v<Comp, hpx::parallel::detail::less> ||
+        std::is_same_v<Comp, std::less<T>> || std::is_same_v<Comp, std::less<>>;
+
+    template <typename T, typename Comp>
+    inline constexpr bool is_radix_sort_greater_v =
+        std::is_same_v<Comp, hpx::parallel::detail::greater> ||
+        std::is_same_v<Comp, std::greater<T>> ||
+        std::is_same_v<Comp, std::greater<>>;
+
+    template <typename T, typename Comp>
+    inline constexpr bool is_radix_sortable_v =
+        radix_sort_key<T>::value &&
+        (is_radix_sort_less_v<T, std::decay_t<Comp>> ||
+            is_radix_sort_greater_v<T, std::decay_t<Comp>>);
+
+    // The values sorted along with the keys are copied into a temporary
+    // buffer.
+    template <typename T>
+    inline constexpr bool is_radix_sortable_value_v =
+        std::is_trivially_copyable_v<T> &&
+        std::is_trivially_default_constructible_v<T>;
+
+    // Placeholder for the values if only the keys are sorted.
+    struct radix_sort_no_values
+    {
+    };
+
+    template <typename ValueIter>
+    struct radix_sort_value
+    {
+        using type = hpx::traits::iter_value_t<ValueIter>;
+    };
+
+    template <>
+    struct radix_sort_value<radix_sort_no_values>
+    {
+        using type = char;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Least significant digit first radix sort of the keys (and the values
+    // associated with them). Each pass counts the digits of each chunk into a
+    // separate histogram, turns the histograms into the output positions of
+    // each chunk using an exclusive scan (bucket major, chunk minor), and
+    // scatters the elements of each chunk into a temporary buffer. Passes for
+    // digits that are equal for all keys are skipped.
+    template <bool Descending, typename Exec, typename KeyIter,
+        typename ValueIter>
+    void radix_sort(Exec& exec, KeyIter keys, ValueIter values,
+        std::size_t count, std::size_t chunk_size)
+    {
+        using key_type = hpx::traits::iter_value_t<KeyIter>;
+        using key_traits = radix_sort_key<key_type>;
+        using unsigned_type = typename key_traits::type;
+        using value_type = typename radix_sort_value<ValueIter>::type;
+
+        constexpr bool has_values =
+            !std::is_same_v<ValueIter, radix_sort_no_values>;
+        constexpr std::size_t num_passes =
+            sizeof(unsigned_type) * CHAR_BIT / radix_sort_bits;
+
+        auto digit = [](key_type key, std::size_t shift) -> std::size_t {
+            unsigned_type bits = key_traits::convert(key);
+            if constexpr (Descending)
+            {
+                bits = static_cast<unsigned_type>(~bits);
+            }
+            return static_cast<std::size_t>(bits >> shift) &
+                (radix_sort_buckets - 1);
+        };
+
+        std::size_t const num_chunks = (count + chunk_size - 1) / chunk_size;
+        auto const shape = hpx::util::iterator_range(
+            hpx::util::counting_iterator(std::size_t(0)),
+            hpx::util::counting_iterator(num_chunks));
+
+        auto run = [&](auto&& f) {
+            hpx::wait_all(execution::bulk_async_execute(
+                exec,
+                [&](std::size_t chunk) {
+                    std::size_t const begin = chunk * chunk_size;
+                    f(chunk, begin, (std::min) (begin + chunk_size, count));
+                },
+                shape));
+        };
+
+        // the temporary buffers are first touched by the scatter passes
+        std::unique_ptr<key_type[]> key_buffer(new key_type[count]);
+        std::unique_ptr<value_type[]> value_buffer;
+        if constexpr (has_values)
+        {
+            value_buffer.reset(new value_type[count]);
+        }
+
+        std::vector<std::array<std::size_t, radix_sort_buckets>> histograms(
+            num_chunks);
+
+        auto count_digits = [&](auto src_keys, std::size_t shift) {
+            run([&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                auto& histogram = histograms[chunk];
+                histogram.fill(0);
+                for (std::size_t i = begin; i != end; ++i)
+                {
+                    ++histogram[digit(src_keys[i], shift)];
+                }
+            });
+        };
+
+        auto scatter = [&](auto src_keys, auto src_values, auto dst_keys,
+                           auto dst_values, std::size_t shift) {
+            run([&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                auto& offsets = histograms[chunk];
+                for (std::size_t i = begin; i != end; ++i)
+                {
+                    std::size_t const pos =
+                        offsets[digit(src_keys[i], shift)]++;
+                    dst_keys[pos] = src_keys[i];
+                    if constexpr (has_values)
+                    {
+                        dst_values[pos] = src_values[i];
+                    }
+                }
+            });
+        };
+
+        bool in_buffer = false;
+        for (std::size_t pass = 0; pass != num_passes; ++pass)
+        {
+            std::size_t const shift = pass * radix_sort_bits;
+            if (in_buffer)
+            {
+                count_digits(key_buffer.get(), shift);
+            }
+            else
+            {
+                count_digits(keys, shift);
+            }
+
+            // skip this pass if all keys have the same digit
+            bool all_equal = false;
+            for (std::size_t bucket = 0; bucket != radix_sort_buckets;
+                ++bucket)
+            {
+                std::size_t total = 0;
+                for (auto const& histogram : histograms)
+                {
+                    total += histogram[bucket];
+                }
+                if (total != 0)
+                {
+                    all_equal = total == count;
+                    break;
+                }
+            }
+            if (all_equal)
+            {
+                continue;
+            }
+
+            std::size_t offset = 0;
+            for (std::size_t bucket = 0; bucket != radix_sort_buckets;
+                ++bucket)
+            {
+                for (auto& histogram : histograms)
+                {
+                    std::size_t const n = histogram[bucket];
+                    histogram[bucket] = offset;
+                    offset += n;
+                }
+            }
+
+            if (in_buffer)
+            {
+                scatter(key_buffer.get(), value_buffer.get(), keys, values,
+                    shift);
+            }
+            else
+            {
+                scatter(keys, values, key_buffer.get(), value_buffer.get(),
+                    shift);
+            }
+            in_buffer = !in_buffer;
+        }
+
+        // copy back the result of an odd number of passes
+        if (in_buffer)
+        {
+            run([&](std::size_t, std::size_t begin, std::size_t end) {
+                std::copy(key_buffer.get() + begin, key_buffer.get() + end,
+                    keys + begin);
+                if constexpr (has_values)
+                {
+                    std::copy(value_buffer.get() + begin,
+                        value_buffer.get() + end, values + begin);
+                }
+            });
+        }
+    }
+
+    // Sort count keys starting at first (and the values starting at values
+    // along with them) in parallel, using the given execution policy.
+    template <typename ExPolicy, typename KeyIter, typename ValueIter,
+        typename Comp>
+    void parallel_radix_sort(ExPolicy& policy, KeyIter first,
+        std::size_t count, ValueIter values, Comp&&)
+    {
+        using key_type = hpx::traits::iter_value_t<KeyIter>;
+        constexpr bool descending =
+            is_radix_sort_greater_v<key_type, std::decay_t<Comp>>;
+
+        if (count < radix_sort_limit)
+        {
+            if constexpr (std::is_same_v<ValueIter, radix_sort_no_values>)
+            {
+                if constexpr (descending)
+                {
+                    std::sort(first, first + count, std::greater<>());
+                }
+                else
+                {
+                    std::sort(first, first + count, std::less<>());
+                }
+                return;
+            }
+            else if (count < 2)
+            {
+                return;
+            }
+        }
+
+        // figure out the chunk size to use
+        std::size_t const cores =
+            hpx::execution::experimental::processing_units_count(
+                policy.parameters(), policy.executor(),
+                hpx::chrono::null_duration, count);
+
+        std::size_t max_chunks =
+            hpx::execution::experimental::maximal_number_of_chunks(
+                policy.parameters(), policy.executor(), cores, count);
+
+        std::size_t chunk_size = hpx::execution::experimental::get_chunk_size(
+            policy.parameters(), policy.executor(), hpx::chrono::null_duration,
+            cores, count);
+
+        util::detail::adjust_chunk_size_and_max_chunks(
+            cores, count, max_chunks, chunk_size);
+
+        // we should not get smaller than our radix_sort_limit_per_task
+        chunk_size = (std::max) (chunk_size, radix_sort_limit_per_task);
+
+        radix_sort<descending>(
+            policy.executor(), first, values, count, chunk_size);
+    }
+
+    // Same as parallel_radix_sort, but runs the sort on a new task. The
+    // returned future becomes ready with the given result once the sort has
+    // finished.
+    template <typename Result, typename ExPolicy, typename KeyIter,
+        typename ValueIter, typename Comp>
+    hpx::future<Result> parallel_radix_sort_async(ExPolicy&& policy,
+        KeyIter first, std::size_t count, ValueIter values, Comp&& comp,
+        Result result)
+    {
+        auto exec = policy.executor();
+        return execution::async_execute(HPX_MOVE(exec),
+            [policy = HPX_FORWARD(ExPolicy, policy), first, count, values,
+                comp = HPX_FORWARD(Comp, comp),
+                result = HPX_MOVE(result)]() mutable -> Result {
+                parallel_radix_sort(policy, first, count, values, comp);
+                return HPX_MOVE(result);
+            });
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -13,6 +13,7 @@
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
@@ -27,6 +28,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -34,100 +37,134 @@ namespace hpx::parallel::detail {
     /// \cond NOINTERNAL
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename FwdIter>
-    struct set_operations_buffer
+    // An output iterator discarding all values written to it, used to count
+    // the number of elements a set operation generates for a chunk.
+    struct set_operation_counter
     {
-        template <typename T>
-        class rewritable_ref
-        {
-        public:
-            rewritable_ref() = default;
-
-            explicit constexpr rewritable_ref(T const& item) noexcept
-              : item_(&item)
-            {
-            }
+        using iterator_category = std::output_iterator_tag;
+        using value_type = void;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = void;
 
-            rewritable_ref& operator=(T const& item)
+        struct discard
+        {
+            template <typename T>
+            constexpr discard& operator=(T&&) noexcept
             {
-                item_ = &item;
                 return *this;
             }
+        };
 
-            // different versions of clang-format produce different results
-            // clang-format off
-            operator T const&() const
-            {
-                HPX_ASSERT(item_ != nullptr);
-                return *item_;
-            }
-            // clang-format on
+        constexpr discard operator*() const noexcept
+        {
+            return discard{};
+        }
 
-        private:
-            T const* item_ = nullptr;
-        };
+        constexpr set_operation_counter& operator++() noexcept
+        {
+            ++count;
+            return *this;
+        }
+
+        constexpr set_operation_counter operator++(int) noexcept
+        {
+            set_operation_counter tmp = *this;
+            ++count;
+            return tmp;
+        }
 
-        using value_type = typename std::iterator_traits<FwdIter>::value_type;
-        using type = std::conditional_t<std::is_scalar_v<value_type>,
-            value_type, rewritable_ref<value_type>>;
+        std::size_t count = 0;
     };
 
     struct set_chunk_data
     {
-        static constexpr std::size_t uninit_start =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_len = static_cast<std::size_t>(0);
-        static constexpr std::size_t uninit_start_index =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_first1 =
-            static_cast<std::size_t>(-1);
-        static constexpr std::size_t uninit_first2 =
-            static_cast<std::size_t>(-1);
-
-        std::size_t start = uninit_start;
-        std::size_t len = uninit_len;
-        std::size_t start_index = uninit_start_index;
-        std::size_t first1 = uninit_first1;
-        std::size_t first2 = uninit_first2;
+        // the ranges of the input sequences handled by this chunk
+        std::size_t start1 = 0;
+        std::size_t end1 = 0;
+        std::size_t start2 = 0;
+        std::size_t end2 = 0;
+
+        // the positions the set operation stopped at in the input sequences
+        std::size_t first1 = 0;
+        std::size_t first2 = 0;
+
+        // the number of generated elements and their position in the output
+        std::size_t len = 0;
+        std::size_t start_index = 0;
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // Split the sorted input sequences at the intersection of their merge path
+    // with the given diagonal. The split is moved backwards to the first
+    // element (in both sequences) that is equivalent to the element following
+    // the split, which makes sure that equivalent elements of both sequences
+    // are always handled by the same chunk.
+    template <typename Iter1, typename Iter2, typename F, typename Proj1,
+        typename Proj2>
+    std::pair<std::size_t, std::size_t> set_operation_split(Iter1 first1,
+        std::size_t len1, Iter2 first2, std::size_t len2, std::size_t diagonal,
+        F&& f, Proj1&& proj1, Proj2&& proj2)
+    {
+        std::size_t const i = merge_path_split(
+            first1, len1, first2, len2, diagonal, f, proj1, proj2);
+        std::size_t const j = diagonal - i;
+
+        auto align = [&](auto const& value) {
+            return std::make_pair(
+                static_cast<std::size_t>(detail::lower_bound(first1,
+                                             first1 + i, value, f, proj1) -
+                    first1),
+                static_cast<std::size_t>(detail::lower_bound(first2,
+                                             first2 + j, value, f, proj2) -
+                    first2));
+        };
+
+        // the element following the split is taken from the first sequence
+        // if it is not greater than the next element of the second sequence
+        if (i != len1 &&
+            (j == len2 ||
+                !HPX_INVOKE(f, HPX_INVOKE(proj2, first2[j]),
+                    HPX_INVOKE(proj1, first1[i]))))
+        {
+            return align(HPX_INVOKE(proj1, first1[i]));
+        }
+        if (j != len2)
+        {
+            return align(HPX_INVOKE(proj2, first2[j]));
+        }
+        return std::make_pair(i, j);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The input sequences are partitioned into chunks of (almost) equal
+    // combined size along their merge path. The first step counts the number
+    // of elements generated by each chunk, the second step applies the set
+    // operation to each chunk again, writing directly to the destination.
     template <typename ExPolicy, typename Iter1, typename Sent1, typename Iter2,
         typename Sent2, typename Iter3, typename F, typename Proj1,
-        typename Proj2, typename Combiner, typename SetOp>
+        typename Proj2, typename SetOp>
     util::detail::algorithm_result_t<ExPolicy,
         util::in_in_out_result<Iter1, Iter2, Iter3>>
     set_operation(ExPolicy&& policy, Iter1 first1, Sent1 last1, Iter2 first2,
         Sent2 last2, Iter3 dest, F&& f, Proj1&& proj1, Proj2&& proj2,
-        Combiner&& combiner, SetOp&& setop)
+        SetOp&& setop)
     {
         using result_type = util::in_in_out_result<Iter1, Iter2, Iter3>;
 
-        using difference_type1 =
-            typename std::iterator_traits<Iter1>::difference_type;
-        using difference_type2 =
-            typename std::iterator_traits<Iter2>::difference_type;
-
-        // allocate intermediate buffers
-        difference_type1 len1 = detail::distance(first1, last1);
-        difference_type2 len2 = detail::distance(first2, last2);
-
-        using buffer_type = typename set_operations_buffer<Iter3>::type;
+        auto const len1 =
+            static_cast<std::size_t>(detail::distance(first1, last1));
+        auto const len2 =
+            static_cast<std::size_t>(detail::distance(first2, last2));
 
         std::size_t cores =
             hpx::execution::experimental::processing_units_count(
                 policy.parameters(), policy.executor(),
-                hpx::chrono::null_duration, (std::min) (len1, len2));
-
-        std::size_t const step = (len1 + cores - 1) / cores;
+                hpx::chrono::null_duration, len1 + len2);
 
 #if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
-        std::shared_ptr<buffer_type[]> buffer(
-            new buffer_type[combiner(len1, len2)]);
         std::shared_ptr<set_chunk_data[]> chunks(new set_chunk_data[cores]);
 #else
-        boost::shared_array<buffer_type> buffer(
-            new buffer_type[combiner(len1, len2)]);
         boost::shared_array<set_chunk_data> chunks(new set_chunk_data[cores]);
 #endif
 
@@ -137,93 +174,31 @@ namespace hpx::parallel::detail {
             HPX_ASSERT(part_size == 1);
             HPX_UNUSED(part_size);
 
-            // find start in sequence 1
-            std::size_t start1 = (curr_chunk - chunks.get()) * step;
-            std::size_t end1 =
-                (std::min) (start1 + step, static_cast<std::size_t>(len1));
-
-            if (start1 >= end1)
-            {
-                return;
-            }
-
-            bool const first_partition = start1 == 0;
-            bool const last_partition = end1 == static_cast<std::size_t>(len1);
-
-            auto start_value = HPX_INVOKE(proj1, first1[start1]);
-            auto end_value = HPX_INVOKE(proj1, first1[end1]);
-
-            // all but the last chunk require special handling
-            if (!last_partition)
-            {
-                // this chunk will be handled by the next one if all elements of
-                // this partition are equal
-                if (!HPX_INVOKE(f, start_value, end_value))
-                {
-                    return;
-                }
-
-                // move backwards to find earliest element which is equal to the
-                // last element of the current chunk
-                if (end1 != 0)
-                {
-                    auto end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-
-                    while (!HPX_INVOKE(f, end_value1, end_value) && --end1 != 0)
-                    {
-                        end_value = HPX_MOVE(end_value1);
-                        end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-                    }
-                }
-            }
-
-            // move backwards to find earliest element which is equal to the
-            // first element of the current chunk
-            if (start1 != 0)
-            {
-                auto start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-
-                while (
-                    !HPX_INVOKE(f, start_value1, start_value) && --start1 != 0)
-                {
-                    start_value = HPX_MOVE(start_value1);
-                    start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-                }
-            }
+            auto const chunk =
+                static_cast<std::size_t>(curr_chunk - chunks.get());
 
-            // find start and end in sequence 2
-            std::size_t start2 = 0;
-            if (!first_partition)
-            {
-                start2 = detail::lower_bound(
-                             first2, first2 + len2, start_value, f, proj2) -
-                    first2;
-            }
+            std::tie(curr_chunk->start1, curr_chunk->start2) =
+                set_operation_split(first1, len1, first2, len2,
+                    (len1 + len2) * chunk / cores, f, proj1, proj2);
+            std::tie(curr_chunk->end1, curr_chunk->end2) =
+                set_operation_split(first1, len1, first2, len2,
+                    (len1 + len2) * (chunk + 1) / cores, f, proj1, proj2);
 
-            std::size_t end2 = len2;
-            if (!last_partition)
-            {
-                end2 = detail::lower_bound(first2 + start2, first2 + len2,
-                           end_value, f, proj2) -
-                    first2;
-            }
+            // count the number of elements generated by this chunk
+            auto op_result = setop(first1 + curr_chunk->start1,
+                first1 + curr_chunk->end1, first2 + curr_chunk->start2,
+                first2 + curr_chunk->end2, set_operation_counter{}, f);
 
-            // perform requested set-operation into the proper place of the
-            // intermediate buffer
-            curr_chunk->start = combiner(start1, start2);
-            auto buffer_dest = buffer.get() + curr_chunk->start;
-            auto op_result = setop(first1 + start1, first1 + end1,
-                first2 + start2, first2 + end2, buffer_dest, f);
             curr_chunk->first1 = op_result.in1 - first1;
             curr_chunk->first2 = op_result.in2 - first2;
-            curr_chunk->len = op_result.out - buffer_dest;
+            curr_chunk->len = op_result.out.count;
         };
 
         // second step, is executed after all partitions are done running
 
         // different versions of clang-format produce different formatting
         // clang-format off
-        auto f2 = [buffer, chunks, cores, first1, first2, dest](
+        auto f2 = [chunks, cores, first1, first2, dest, f, setop](
                       auto&& data) -> result_type {
             // clang-format on
 
@@ -234,50 +209,41 @@ namespace hpx::parallel::detail {
             // accumulate real length and rightmost positions in input sequences
             std::size_t first1_pos = 0;
             std::size_t first2_pos = 0;
+            std::size_t start_index = 0;
 
-            set_chunk_data* chunk = chunks.get();
-            chunk->start_index = 0;
-            for (size_t i = 1; i != cores; ++i)
+            for (std::size_t i = 0; i != cores; ++i)
             {
-                set_chunk_data const* curr_chunk = chunk++;
-                chunk->start_index = curr_chunk->start_index + curr_chunk->len;
-                if (curr_chunk->first1 != static_cast<std::size_t>(-1))
-                {
-                    first1_pos = (std::max) (first1_pos, curr_chunk->first1);
-                }
-                if (curr_chunk->first2 != static_cast<std::size_t>(-1))
-                {
-                    first2_pos = (std::max) (first2_pos, curr_chunk->first2);
-                }
+                set_chunk_data& curr_chunk = chunks[i];
+                curr_chunk.start_index = start_index;
+                start_index += curr_chunk.len;
+
+                first1_pos = (std::max) (first1_pos, curr_chunk.first1);
+                first2_pos = (std::max) (first2_pos, curr_chunk.first2);
             }
 
-            // finally, copy data to destination
+            // finally, write data to destination
             parallel::util::
                 foreach_partitioner<hpx::execution::parallel_policy>::call(
                     hpx::execution::par, chunks.get(), cores,
-                    [buffer, dest](
+                    [first1, first2, dest, &f, &setop](
                         set_chunk_data* ch, std::size_t, std::size_t) {
-                        if (ch->start == set_chunk_data::uninit_start ||
-                            ch->start_index ==
-                                set_chunk_data::uninit_start_index ||
-                            ch->len == set_chunk_data::uninit_len)
+                        if (ch->len == 0)
                         {
                             return;
                         }
-                        std::copy(buffer.get() + ch->start,
-                            buffer.get() + ch->start + ch->len,
-                            dest + ch->start_index);
+                        setop(first1 + ch->start1, first1 + ch->end1,
+                            first2 + ch->start2, first2 + ch->end2,
+                            std::next(dest, ch->start_index), f);
                     },
                     [](set_chunk_data* last) -> set_chunk_data* {
                         return last;
                     });
 
             return {std::next(first1, first1_pos),
-                std::next(first2, first2_pos),
-                std::next(dest, chunk->start_index + chunk->len)};
+                std::next(first2, first2_pos), std::next(dest, start_index)};
         };
 
-        // fill the buffer piecewise
+        // count the elements piecewise
         return parallel::util::partitioner<ExPolicy, result_type, void>::call(
             policy, chunks.get(), cores, HPX_MOVE(f1), HPX_MOVE(f2));
     }
@@ -289,14 +289,13 @@ namespace hpx {
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/iterator_support/unwrap_iterator.hpp>
-#include <hpx/modules/itt_notify.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/rotate.hpp>
-#include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
@@ -321,55 +320,6 @@ namespace hpx::parallel {
     namespace detail {
         /// \cond NOINTERNAL
 
-        ///////////////////////////////////////////////////////////////////////
-        struct lower_bound_helper;
-
-        struct upper_bound_helper
-        {
-            template <typename Iter, typename Sent, typename T, typename Comp,
-                typename Proj>
-            static constexpr Iter call(
-                Iter first, Sent last, T const& value, Comp&& comp, Proj&& proj)
-            {
-                return detail::upper_bound(first, last, value,
-                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
-            }
-
-            template <typename Iter, typename T, typename Comp, typename Proj>
-            static constexpr Iter call_n(Iter first,
-                typename std::iterator_traits<Iter>::difference_type count,
-                T const& value, Comp&& comp, Proj&& proj)
-            {
-                return detail::upper_bound_n(first, count, value,
-                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
-            }
-
-            using another_type = lower_bound_helper;
-        };
-
-        struct lower_bound_helper
-        {
-            template <typename Iter, typename Sent, typename T, typename Comp,
-                typename Proj>
-            static constexpr Iter call(
-                Iter first, Sent last, T const& value, Comp&& comp, Proj&& proj)
-            {
-                return detail::lower_bound(first, last, value,
-                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
-            }
-
-            template <typename Iter, typename T, typename Comp, typename Proj>
-            static constexpr Iter call_n(Iter first,
-                typename std::iterator_traits<Iter>::difference_type count,
-                T const& value, Comp&& comp, Proj&& proj)
-            {
-                return detail::lower_bound_n(first, count, value,
-                    HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj, proj));
-            }
-
-            using another_type = upper_bound_helper;
-        };
-
         template <typename T>
         HPX_FORCEINLINE decltype(auto) init_value([[maybe_unused]] T&& val)
         {
@@ -650,106 +600,6 @@ namespace hpx::parallel {
             }
         }
 
-        template <typename Iter1, typename Iter2, typename Comp, typename Proj1,
-            typename Proj2, typename BinarySearchHelper>
-        auto get_reshape_chunks(std::size_t len1, Iter2 first2, Iter2 last2,
-            Comp&& comp, Proj1&& proj1, Proj2&& proj2, BinarySearchHelper)
-        {
-            using merge_region =
-                hpx::tuple<Iter1, std::size_t, Iter2, std::size_t, std::size_t>;
-
-            auto reshape = [len1, first2, last2, comp, proj1, proj2](
-                               auto&& shape) {
-#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-                static hpx::util::itt::event notify_event("reshape");
-                hpx::util::itt::mark_event e(notify_event);
-#endif
-                std::vector<merge_region> reshaped;
-                reshaped.reserve(2 * std::size(shape));
-
-                Iter2 it2 = first2;
-                std::size_t dest_start = 0;
-                for (auto [it1, size1, base] : shape)
-                {
-                    Iter2 l2 = last2;
-                    if (base + size1 != len1)
-                    {
-                        // gcc complains about using HPX_INVOKE here
-                        l2 = BinarySearchHelper::call(it2, last2,
-                            std::invoke(proj1, *std::next(it1, size1)), comp,
-                            proj2);
-                    }
-
-                    std::size_t size2 = detail::distance(it2, l2);
-
-                    // prevent chunks from growing too large
-                    if (size2 <= static_cast<std::size_t>(
-                                     1.2 * static_cast<double>(size1)))
-                    {
-                        reshaped.emplace_back(
-                            it1, size1, it2, size2, dest_start);
-
-                        it2 = l2;
-                        dest_start += size1 + size2;
-                    }
-                    else
-                    {
-                        // split first sequence into smaller pieces based
-                        // on chunks of the second (sub-)sequence
-                        Iter1 begin1 = it1;
-                        std::size_t remainder1 = size1;
-
-                        std::size_t chunk_size2 = size1;
-                        std::size_t remainder2 = size2 - chunk_size2;
-
-                        Iter2 begin2 = it2;
-                        Iter2 end2 = std::next(begin2, chunk_size2);
-
-                        while (chunk_size2 != 0)
-                        {
-                            Iter1 end_chunk1;
-                            if (end2 != l2)
-                            {
-                                using binary_search =
-                                    typename BinarySearchHelper::another_type;
-
-                                // gcc complains about using HPX_INVOKE here
-                                end_chunk1 =
-                                    binary_search::call_n(begin1, remainder1,
-                                        std::invoke(proj2, *end2), comp, proj1);
-                            }
-                            else
-                            {
-                                end_chunk1 = std::next(it1, size1);
-                            }
-
-                            auto chunk_size1 =
-                                detail::distance(begin1, end_chunk1);
-
-                            reshaped.emplace_back(begin1, chunk_size1, begin2,
-                                chunk_size2, dest_start);
-
-                            dest_start += chunk_size1 + chunk_size2;
-
-                            chunk_size2 = (std::min) (size1, remainder2);
-                            remainder2 -= chunk_size2;
-
-                            begin1 = end_chunk1;
-                            remainder1 -= chunk_size1;
-
-                            begin2 = end2;
-                            end2 = std::next(begin2, chunk_size2);
-                        }
-
-                        it2 = l2;
-                    }
-                }
-                return reshaped;
-            };
-
-            return reshape;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename ExPolicy, typename Iter1, typename Sent1,
             typename Iter2, typename Sent2, typename Iter3, typename Comp,
@@ -766,42 +616,36 @@ namespace hpx::parallel {
 
             using result_type = util::in_in_out_result<Iter1, Iter2, Iter3>;
 
-            auto f1 = [dest, comp, proj1, proj2](Iter1 it1, std::size_t size1,
-                          Iter2 it2, std::size_t size2, std::size_t dest_base) {
-                if (size1 != 0 || size2 != 0)
+            // partition the destination sequence, each chunk merges the
+            // elements between the intersections of the merge path with the
+            // diagonals at its start and at its end
+            auto f1 = [first1, first2, size1 = static_cast<std::size_t>(len1),
+                          size2 = static_cast<std::size_t>(len2), comp, proj1,
+                          proj2](Iter3 part_dest, std::size_t part_size,
+                          std::size_t base) {
+                if (part_size == 0)
                 {
-                    sequential_merge(it1, std::next(it1, size1), it2,
-                        std::next(it2, size2), std::next(dest, dest_base), comp,
-                        proj1, proj2);
+                    return;
                 }
-            };
-
-            if (len1 > len2)
-            {
-                auto f2 = [first2, len1, len2, dest](Iter1 l1) {
-                    return result_type{l1, std::next(first2, len2),
-                        std::next(dest, len1 + len2)};
-                };
-
-                auto reshape = get_reshape_chunks<Iter1>(len1, first2, end2,
-                    comp, proj1, proj2, lower_bound_helper{});
 
-                return util::foreach_partitioner<ExPolicy>::call(
-                    HPX_FORWARD(ExPolicy, policy), first1, len1, HPX_MOVE(f1),
-                    HPX_MOVE(f2), HPX_MOVE(reshape));
-            }
+                std::size_t const begin = merge_path_split(
+                    first1, size1, first2, size2, base, comp, proj1, proj2);
+                std::size_t const end = merge_path_split(first1, size1,
+                    first2, size2, base + part_size, comp, proj1, proj2);
 
-            auto f2 = [first1, len1, len2, dest](Iter2 l2) {
-                return result_type{
-                    std::next(first1, len1), l2, std::next(dest, len1 + len2)};
+                sequential_merge(std::next(first1, begin),
+                    std::next(first1, end), std::next(first2, base - begin),
+                    std::next(first2, base + part_size - end), part_dest,
+                    comp, proj1, proj2);
             };
 
-            auto reshape = get_reshape_chunks<Iter2>(
-                len2, first1, end1, comp, proj2, proj1, upper_bound_helper{});
+            auto f2 = [end1, end2](Iter3 last) {
+                return result_type{end1, end2, last};
+            };
 
             return util::foreach_partitioner<ExPolicy>::call(
-                HPX_FORWARD(ExPolicy, policy), first2, len2, HPX_MOVE(f1),
-                HPX_MOVE(f2), HPX_MOVE(reshape));
+                HPX_FORWARD(ExPolicy, policy), dest, len1 + len2, HPX_MOVE(f1),
+                HPX_MOVE(f2));
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -893,115 +737,53 @@ namespace hpx::parallel {
                 return;
             }
 
-            if (left_size >= right_size)
-            {
-                // Means that always 'pivot' < 'middle'.
-                HPX_ASSERT(left_size >= 3ul);
-
-                // Select pivot in left-side range.
-                Iter pivot = first + left_size / 2;
-                Iter boundary = lower_bound_helper::call(
-                    middle, last, HPX_INVOKE(proj, *pivot), comp, proj);
-                Iter target = pivot + (boundary - middle);
-
-                // Swap two blocks, [pivot, middle) and [middle, boundary).
-                // After this, [first, last) will be divided into three blocks,
-                //   [first, target), target, and [target+1, last).
-                // And all elements of [first, target) are less than
-                //   the thing of target.
-                // And all elements of [target+1, last) are greater or equal than
-                //   the thing of target.
-                detail::sequential_rotate(pivot, middle, boundary);
-
-                hpx::future<void> fut =
-                    execution::async_execute(policy.executor(), [&]() -> void {
-                        // Process the range which is left-side of 'target'.
-                        parallel_inplace_merge_helper(
-                            policy, first, pivot, target, comp, proj);
-                    });
-
-                try
-                {
-                    // Process the range which is right-side of 'target'.
+            // Split both ranges at the intersection of the merge path with
+            // the middle diagonal and swap the blocks [first + left1, middle)
+            // and [middle, middle + left2). After this, [first, last)
+            // consists of two merge problems of equal size, independently of
+            // the sizes of the input ranges and of the distribution of the
+            // values.
+            std::size_t const diagonal = (left_size + right_size) / 2;
+            std::size_t const left1 = merge_path_split(first, left_size,
+                middle, right_size, diagonal, comp, proj, proj);
+            std::size_t const left2 = diagonal - left1;
+
+            Iter split = first + diagonal;
+            detail::sequential_rotate(first + left1, middle, middle + left2);
+
+            hpx::future<void> fut =
+                execution::async_execute(policy.executor(), [&]() -> void {
+                    // Process the left half.
                     parallel_inplace_merge_helper(
-                        policy, target + 1, boundary, last, comp, proj);
-                }
-                catch (...)
-                {
-                    fut.wait();
-
-                    std::vector<hpx::future<void>> futures;
-                    futures.reserve(2);
-                    futures.emplace_back(HPX_MOVE(fut));
-                    futures.emplace_back(hpx::make_exceptional_future<void>(
-                        std::current_exception()));
-
-                    std::list<std::exception_ptr> errors;
-                    util::detail::handle_local_exceptions<ExPolicy>::call(
-                        futures, errors);
-
-                    HPX_UNREACHABLE;
-                }
+                        policy, first, first + left1, split, comp, proj);
+                });
 
-                if (fut.valid())    // NOLINT
-                {
-                    fut.get();
-                }
+            try
+            {
+                // Process the right half.
+                parallel_inplace_merge_helper(policy, split,
+                    split + (left_size - left1), last, comp, proj);
             }
-            else    // left_size < right_size
+            catch (...)
             {
-                // Means that always 'pivot' < 'last'.
-                HPX_ASSERT(right_size >= 3ul);
-
-                // Select pivot in right-side range.
-                Iter pivot = middle + right_size / 2;
-                Iter boundary = upper_bound_helper::call(
-                    first, middle, HPX_INVOKE(proj, *pivot), comp, proj);
-                Iter target = boundary + (pivot - middle);
-
-                // Swap two blocks, [boundary, middle) and [middle, pivot+1).
-                // After this, [first, last) will be divided into three blocks,
-                //   [first, target), target, and [target+1, last).
-                // And all elements of [first, target) are less than
-                //   the thing of target.
-                // And all elements of [target+1, last) are greater or equal than
-                //   the thing of target.
-                detail::sequential_rotate(boundary, middle, pivot + 1);
-
-                hpx::future<void> fut =
-                    execution::async_execute(policy.executor(), [&]() -> void {
-                        // Process the range which is left-side of 'target'.
-                        parallel_inplace_merge_helper(
-                            policy, first, boundary, target, comp, proj);
-                    });
+                fut.wait();
 
-                try
-                {
-                    // Process the range which is right-side of 'target'.
-                    parallel_inplace_merge_helper(
-                        policy, target + 1, pivot + 1, last, comp, proj);
-                }
-                catch (...)
-                {
-                    fut.wait();
-
-                    std::vector<hpx::future<void>> futures;
-                    futures.reserve(2);
-                    futures.emplace_back(HPX_MOVE(fut));
-                    futures.emplace_back(hpx::make_exceptional_future<void>(
-                        std::current_exception()));
+                std::vector<hpx::future<void>> futures;
+                futures.reserve(2);
+                futures.emplace_back(HPX_MOVE(fut));
+                futures.emplace_back(hpx::make_exceptional_future<void>(
+                    std::current_exception()));
 
-                    std::list<std::exception_ptr> errors;
-                    util::detail::handle_local_exceptions<ExPolicy>::call(
-                        futures, errors);
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_local_exceptions<ExPolicy>::call(
+                    futures, errors);
 
-                    HPX_UNREACHABLE;
-                }
+                HPX_UNREACHABLE;
+            }
 
-                if (fut.valid())    // NOLINT
-                {
-                    fut.get();
-                }
+            if (fut.valid())    // NOLINT
+            {
+                fut.get();
             }
         }
 
@@ -130,6 +130,11 @@ namespace hpx {
     /// permitted to execute in an unordered fashion in unspecified
     /// threads, and indeterminately sequenced within each thread.
     ///
+    /// If the values are arithmetic, no projection is given, and \a comp is
+    /// one of \a std::less, \a std::greater, or their \a hpx::ranges
+    /// counterparts, the parallel algorithm uses a radix sort that performs
+    /// O(N) operations.
+    ///
     /// \returns  The \a sort algorithm returns a
     ///           \a hpx::future<void> if the execution policy is of
     ///           type
@@ -164,6 +169,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -362,11 +368,42 @@ namespace hpx::parallel {
 
                 try
                 {
-                    // call the sort routine and return the right type,
-                    // depending on execution policy
-                    return algorithm_result::get(parallel_sort_async(
-                        HPX_FORWARD(ExPolicy, policy), first, last,
-                        util::compare_projected<Comp&, Proj&>(comp, proj)));
+                    // arithmetic values compared by their natural order are
+                    // sorted using a radix sort
+                    if constexpr (std::is_same_v<std::decay_t<Proj>,
+                                      hpx::identity> &&
+                        is_radix_sortable_v<
+                            typename std::iterator_traits<RandomIt>::value_type,
+                            Comp>)
+                    {
+                        std::size_t const count =
+                            static_cast<std::size_t>(last - first);
+
+                        // asynchronous policies run the sort on a new task
+                        if constexpr (hpx::is_async_execution_policy_v<
+                                          ExPolicy>)
+                        {
+                            return algorithm_result::get(
+                                parallel_radix_sort_async(
+                                    HPX_FORWARD(ExPolicy, policy), first,
+                                    count, radix_sort_no_values{}, comp,
+                                    last));
+                        }
+                        else
+                        {
+                            parallel_radix_sort(policy, first, count,
+                                radix_sort_no_values{}, comp);
+                            return algorithm_result::get(HPX_MOVE(last));
+                        }
+                    }
+                    else
+                    {
+                        // call the sort routine and return the right type,
+                        // depending on execution policy
+                        return algorithm_result::get(parallel_sort_async(
+                            HPX_FORWARD(ExPolicy, policy), first, last,
+                            util::compare_projected<Comp&, Proj&>(comp, proj)));
+                    }
                 }
                 catch (...)
                 {
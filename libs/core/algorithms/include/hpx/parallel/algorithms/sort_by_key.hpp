@@ -99,9 +99,15 @@ namespace hpx { namespace experimental {
 
 #include <hpx/config.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
+#include <cstddef>
+#include <exception>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -154,14 +160,60 @@ namespace hpx::experimental {
         ValueIter value_last = value_first;
         std::advance(value_last, std::distance(key_first, key_last));
 
-        using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
+        // arithmetic keys compared by their natural order are sorted using a
+        // radix sort that moves the values along with the keys
+        if constexpr (!hpx::is_sequenced_execution_policy_v<ExPolicy> &&
+            hpx::parallel::detail::is_radix_sortable_v<
+                typename std::iterator_traits<KeyIter>::value_type,
+                Compare> &&
+            hpx::parallel::detail::is_radix_sortable_value_v<
+                typename std::iterator_traits<ValueIter>::value_type>)
+        {
+            using result_type = sort_by_key_result<KeyIter, ValueIter>;
+            using algorithm_result =
+                hpx::parallel::util::detail::algorithm_result<ExPolicy,
+                    result_type>;
 
-        return hpx::parallel::detail::get_iter_pair<iterator_type>(
-            hpx::parallel::detail::sort<iterator_type>().call(
-                HPX_FORWARD(ExPolicy, policy),
-                hpx::util::zip_iterator(key_first, value_first),
-                hpx::util::zip_iterator(key_last, value_last), HPX_MOVE(comp),
-                hpx::parallel::detail::extract_key()));
+            try
+            {
+                std::size_t const count = static_cast<std::size_t>(
+                    std::distance(key_first, key_last));
+
+                // asynchronous policies run the sort on a new task
+                if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+                {
+                    return algorithm_result::get(
+                        hpx::parallel::detail::parallel_radix_sort_async(
+                            HPX_FORWARD(ExPolicy, policy), key_first, count,
+                            value_first, HPX_MOVE(comp),
+                            result_type(key_last, value_last)));
+                }
+                else
+                {
+                    hpx::parallel::detail::parallel_radix_sort(
+                        policy, key_first, count, value_first, comp);
+                    return algorithm_result::get(
+                        result_type(key_last, value_last));
+                }
+            }
+            catch (...)
+            {
+                return algorithm_result::get(
+                    hpx::parallel::detail::handle_exception<ExPolicy,
+                        result_type>::call(std::current_exception()));
+            }
+        }
+        else
+        {
+            using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
+
+            return hpx::parallel::detail::get_iter_pair<iterator_type>(
+                hpx::parallel::detail::sort<iterator_type>().call(
+                    HPX_FORWARD(ExPolicy, policy),
+                    hpx::util::zip_iterator(key_first, value_first),
+                    hpx::util::zip_iterator(key_last, value_last),
+                    HPX_MOVE(comp), hpx::parallel::detail::extract_key()));
+        }
 #endif
     }
 }    // namespace hpx::experimental
@@ -0,0 +1,44 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/modules/concepts.hpp>
+#include <hpx/parallel/util/adapt_placement_mode.hpp>
+#include <hpx/parallel/util/adapt_sharing_mode.hpp>
+#include <hpx/parallel/util/adapt_thread_priority.hpp>
+
+namespace hpx::execution::experimental {
+
+    /// Adapt the given execution policy such that parallel algorithms
+    /// invoked with it distribute their chunks over the worker threads
+    /// statically: each worker is assigned one contiguous range of chunks
+    /// (depth-first placement), the chunks are not stolen by other workers
+    /// (no function sharing), and the created threads stay on the core they
+    /// were scheduled on (bound priority). As a consequence, two algorithms
+    /// invoked on sequences of the same size with the same chunking
+    /// parameters touch the same index ranges from the same cores. If the
+    /// memory of a sequence was first touched using such a policy (e.g.,
+    /// through a compute::host::policy_allocator), later algorithms access
+    /// the memory from the NUMA domain it was allocated in.
+    ///
+    /// As with the other policy adaptors, hints or priorities explicitly
+    /// supplied by the user are not overwritten.
+    template <typename ExPolicy>
+        requires(hpx::is_execution_policy_v<ExPolicy>)
+    decltype(auto) adapt_static_placement(ExPolicy&& policy)
+    {
+        return hpx::execution::experimental::adapt_thread_priority(
+            hpx::execution::experimental::adapt_sharing_mode(
+                hpx::execution::experimental::adapt_placement_mode(
+                    HPX_FORWARD(ExPolicy, policy),
+                    hpx::threads::thread_placement_hint::depth_first),
+                hpx::threads::thread_sharing_hint::do_not_share_function),
+            hpx::threads::thread_priority::bound);
+    }
+}    // namespace hpx::execution::experimental
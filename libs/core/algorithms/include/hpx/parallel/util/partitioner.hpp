@@ -142,7 +142,7 @@ namespace hpx::parallel::util::detail {
     template <typename Result, typename ExPolicy, typename FwdIter,
         typename Data, typename F>
     // requires is_container<Data>
-    std::vector<hpx::future<Result>> partition_with_data(ExPolicy&& policy,
+    decltype(auto) partition_with_data(ExPolicy&& policy,
         FwdIter first, std::size_t count,
         std::vector<std::size_t> const& chunk_sizes, Data&& data, F&& f)
     {
@@ -12,8 +12,13 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/algorithms/let_value.hpp>
+#include <hpx/execution/algorithms/then.hpp>
 #include <hpx/execution/execution.hpp>
 #include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/futures/traits/is_future.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
@@ -27,6 +32,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <type_traits>
 #include <utility>
@@ -225,6 +231,183 @@ namespace hpx::parallel::util {
                     });
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Executors that return senders (instead of futures) from
+        // async_execute and bulk_async_execute, e.g. explicit_scheduler_executor
+        template <typename ExPolicy, typename Enable = void>
+        struct has_sender_executor : std::false_type
+        {
+        };
+
+        template <typename ExPolicy>
+        struct has_sender_executor<ExPolicy,
+            std::enable_if_t<
+                hpx::execution_policy_has_scheduler_executor_v<ExPolicy>>>
+          : std::bool_constant<!hpx::traits::is_future_v<
+                decltype(execution::async_execute(
+                    std::declval<typename ExPolicy::executor_type&>(),
+                    std::declval<void (*)()>()))>>
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The sender partitioner composes all steps of the scan into a single
+        // sender. The results of the first step are collected by one bulk
+        // operation, the second step runs as its continuation and launches
+        // the bulk operation for the third step. No futures are created for
+        // the chunks, the returned sender completes with the result of f4.
+        // Unlike for the other partitioners, f4 receives the results of the
+        // third step (if any) as a std::vector<Result2>.
+        template <typename ExPolicy, typename R, typename Result1,
+            typename Result2>
+        struct scan_sender_partitioner
+        {
+            using parameters_type = typename ExPolicy::executor_parameters_type;
+
+            using handle_local_exceptions =
+                detail::handle_local_exceptions<ExPolicy>;
+
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static auto call(ExPolicy_ policy, FwdIter first,
+                std::size_t count, T&& init, F1&& f1, F2&& f2, F3&& f3,
+                F4&& f4)
+            {
+                namespace ex = hpx::execution::experimental;
+
+                // inform parameter traits
+                using scoped_executor_parameters =
+                    detail::scoped_executor_parameters_ref<parameters_type,
+                        typename std::decay_t<ExPolicy_>::executor_type>;
+
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                try
+                {
+                    // (begin of chunk, size of chunk, index of chunk)
+                    using tuple_type =
+                        hpx::tuple<FwdIter, std::size_t, std::size_t>;
+
+                    std::vector<tuple_type> shape =
+                        get_shape<tuple_type>(policy, first, count);
+
+                    // first step, run f1 on all chunks
+                    auto&& items = execution::bulk_async_execute(
+                        policy.executor(),
+                        [f1 = HPX_FORWARD(F1, f1)](
+                            tuple_type const& elem) mutable -> Result1 {
+                            return HPX_INVOKE(
+                                f1, hpx::get<0>(elem), hpx::get<1>(elem));
+                        },
+                        shape);
+
+                    auto result = ex::let_value(HPX_MOVE(items),
+                        [exec = policy.executor(), shape = HPX_MOVE(shape),
+                            init = HPX_FORWARD(T, init),
+                            f2 = HPX_FORWARD(F2, f2), f3 = HPX_FORWARD(F3, f3),
+                            f4 = HPX_FORWARD(F4, f4)](
+                            std::vector<Result1>& workitems) mutable {
+                            // perform f2 sequentially in one go, the first
+                            // intermediate result is the initial value
+                            workitems.insert(workitems.begin(), HPX_MOVE(init));
+                            for (std::size_t i = 1; i < workitems.size(); ++i)
+                            {
+                                workitems[i] = HPX_INVOKE(
+                                    f2, workitems[i - 1], workitems[i]);
+                            }
+
+                            // start f3 on all chunks, the intermediate
+                            // results are kept alive by let_value
+                            auto&& finalitems = execution::bulk_async_execute(
+                                exec,
+                                [&workitems, f3 = HPX_MOVE(f3)](
+                                    tuple_type const& elem) mutable {
+                                    return HPX_INVOKE(f3, hpx::get<0>(elem),
+                                        hpx::get<1>(elem),
+                                        workitems[hpx::get<2>(elem)]);
+                                },
+                                shape);
+
+                            return ex::then(HPX_MOVE(finalitems),
+                                [&workitems, f4 = HPX_MOVE(f4)](
+                                    auto&&... results) mutable {
+                                    return HPX_INVOKE(f4, HPX_MOVE(workitems),
+                                        make_final_items(HPX_FORWARD(
+                                            decltype(results), results)...));
+                                });
+                        });
+
+                    scoped_params.mark_end_of_scheduling();
+
+                    return result;
+                }
+                catch (...)
+                {
+                    handle_local_exceptions::call(std::current_exception());
+                }
+            }
+
+        private:
+            template <typename Tuple, typename ExPolicy_, typename FwdIter>
+            static std::vector<Tuple> get_shape(
+                ExPolicy_& policy, FwdIter first, std::size_t count)
+            {
+                using has_variable_chunk_size =
+                    typename hpx::execution::experimental::
+                        extract_has_variable_chunk_size<parameters_type>::type;
+
+                auto make_shape = [](auto&& chunks) {
+                    std::vector<Tuple> shape;
+                    shape.reserve(hpx::util::size(chunks));
+
+                    std::size_t index = 0;
+                    for (auto const& elem : chunks)
+                    {
+                        shape.emplace_back(
+                            hpx::get<0>(elem), hpx::get<1>(elem), index++);
+                    }
+                    return shape;
+                };
+
+                if constexpr (has_variable_chunk_size::value)
+                {
+                    return make_shape(detail::get_bulk_iteration_shape_variable(
+                        policy, first, count));
+                }
+                else
+                {
+                    return make_shape(
+                        detail::get_bulk_iteration_shape(policy, first, count));
+                }
+            }
+
+            // The third step does not produce any futures. If it has no
+            // results, f4 receives an empty vector of futures, as for the
+            // other partitioners.
+            static std::vector<hpx::future<Result2>> make_final_items()
+            {
+                return {};
+            }
+
+            // Otherwise f4 receives the results as plain values.
+            template <typename Results>
+            static std::vector<Result2> make_final_items(Results&& results)
+            {
+                if constexpr (std::is_same_v<std::decay_t<Results>,
+                                  std::vector<Result2>>)
+                {
+                    return HPX_FORWARD(Results, results);
+                }
+                else
+                {
+                    return std::vector<Result2>(
+                        std::make_move_iterator(results.begin()),
+                        std::make_move_iterator(results.end()));
+                }
+            }
+        };
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -235,10 +418,14 @@ namespace hpx::parallel::util {
     template <typename ExPolicy, typename R = void, typename Result1 = R,
         typename Result2 = void>
     struct scan_partitioner
-      : detail::select_partitioner<std::decay_t<ExPolicy>,
-            detail::scan_static_partitioner,
-            detail::scan_task_static_partitioner>::template apply<R, Result1,
-            Result2>
+      : std::conditional_t<
+            detail::has_sender_executor<std::decay_t<ExPolicy>>::value,
+            detail::scan_sender_partitioner<std::decay_t<ExPolicy>, R, Result1,
+                Result2>,
+            typename detail::select_partitioner<std::decay_t<ExPolicy>,
+                detail::scan_static_partitioner,
+                detail::scan_task_static_partitioner>::template apply<R,
+                Result1, Result2>>
     {
     };
 }    // namespace hpx::parallel::util
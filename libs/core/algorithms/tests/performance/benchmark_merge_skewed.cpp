@@ -0,0 +1,173 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures hpx::merge, hpx::inplace_merge, and the parallel
+// set operations for inputs of different shapes: randomly interleaved
+// sequences, sequences of very different lengths, and sequences where all
+// elements of one sequence are smaller than all elements of the other. The
+// parallel algorithms split their work along the merge path, which gives
+// chunks of equal size independently of the shape of the input.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/format.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+// Generate two sorted sequences with a total of size elements, the first one
+// holding the given fraction of the elements. If disjoint is set, all
+// elements of the first sequence are smaller than the elements of the second.
+std::pair<std::vector<std::uint64_t>, std::vector<std::uint64_t>> make_input(
+    std::size_t size, double fraction, bool disjoint)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> dist(0, size);
+
+    std::size_t const size1 = static_cast<std::size_t>(size * fraction);
+    std::vector<std::uint64_t> first(size1), second(size - size1);
+
+    std::generate(first.begin(), first.end(), [&]() { return dist(gen); });
+    std::generate(second.begin(), second.end(), [&]() {
+        return disjoint ? dist(gen) + size + 1 : dist(gen);
+    });
+
+    std::sort(first.begin(), first.end());
+    std::sort(second.begin(), second.end());
+
+    return {first, second};
+}
+
+template <typename F>
+double measure(int test_count, F&& f)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::chrono::high_resolution_timer t;
+        f();
+        elapsed += t.elapsed();
+    }
+    return elapsed / test_count;
+}
+
+void bench(char const* name, std::size_t size, double fraction, bool disjoint,
+    int test_count)
+{
+    auto const input = make_input(size, fraction, disjoint);
+    auto const& first = input.first;
+    auto const& second = input.second;
+    std::vector<std::uint64_t> dest(size);
+
+    auto const policy = hpx::execution::par;
+
+    double const merge = measure(test_count, [&]() {
+        hpx::merge(policy, first.begin(), first.end(), second.begin(),
+            second.end(), dest.begin());
+    });
+
+    double const merge_seq = measure(test_count, [&]() {
+        std::merge(first.begin(), first.end(), second.begin(), second.end(),
+            dest.begin());
+    });
+
+    double inplace_merge = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::copy(first.begin(), first.end(), dest.begin());
+        auto const middle = std::copy(
+            second.begin(), second.end(), dest.begin() + first.size());
+
+        hpx::chrono::high_resolution_timer t;
+        hpx::inplace_merge(policy, dest.begin(), dest.begin() + first.size(),
+            middle);
+        inplace_merge += t.elapsed();
+    }
+    inplace_merge /= test_count;
+
+    double const set_union = measure(test_count, [&]() {
+        hpx::set_union(policy, first.begin(), first.end(), second.begin(),
+            second.end(), dest.begin());
+    });
+
+    double const set_intersection = measure(test_count, [&]() {
+        hpx::set_intersection(policy, first.begin(), first.end(),
+            second.begin(), second.end(), dest.begin());
+    });
+
+    double const set_difference = measure(test_count, [&]() {
+        hpx::set_difference(policy, first.begin(), first.end(), second.begin(),
+            second.end(), dest.begin());
+    });
+
+    hpx::util::format_to(std::cout,
+        "{}: merge {:.4f}s (std::merge {:.4f}s), inplace_merge {:.4f}s, "
+        "set_union {:.4f}s, set_intersection {:.4f}s, set_difference "
+        "{:.4f}s\n",
+        name, merge, merge_seq, inplace_merge, set_union, set_intersection,
+        set_difference);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const size = vm["vector_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    if (test_count <= 0)
+    {
+        std::cerr << "test_count cannot be zero or negative...\n";
+        return hpx::local::finalize();
+    }
+
+    std::cout << "using seed: " << seed << ", vector size: " << size << "\n";
+
+    bench("balanced", size, 0.5, false, test_count);
+    bench("skewed (1:99)", size, 0.01, false, test_count);
+    bench("skewed (99:1)", size, 0.99, false, test_count);
+    bench("disjoint", size, 0.5, true, test_count);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(10000000),
+            "total number of elements of both input sequences")
+        ("test_count", value<int>()->default_value(5),
+            "number of tests to be averaged")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = {"hpx.os_threads=all"};
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,170 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the radix sort used by hpx::sort and
+// hpx::experimental::sort_by_key for arithmetic keys compared with std::less
+// or std::greater with the comparison based sort used otherwise (selected
+// here by wrapping the comparison operator into a lambda) and with std::sort.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> random_keys(std::size_t size)
+{
+    std::mt19937_64 gen(seed);
+    std::vector<T> keys(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::normal_distribution<T> dist(0, 1000);
+        std::generate(keys.begin(), keys.end(), [&]() { return dist(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dist;
+        std::generate(keys.begin(), keys.end(), [&]() { return dist(gen); });
+    }
+    return keys;
+}
+
+// Run the given sort on a fresh copy of the keys, return the average time in
+// seconds (the copies are not measured).
+template <typename T, typename F>
+double measure(std::vector<T> const& keys, int test_count, F&& f)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<T> data(keys);
+
+        hpx::chrono::high_resolution_timer t;
+        f(data);
+        elapsed += t.elapsed();
+
+        if (!std::is_sorted(data.begin(), data.end()))
+        {
+            std::cerr << "sort failed\n";
+        }
+    }
+    return elapsed / test_count;
+}
+
+template <typename T>
+void bench_sort(char const* name, std::size_t size, int test_count)
+{
+    std::vector<T> const keys = random_keys<T>(size);
+
+    double const radix = measure(keys, test_count, [](std::vector<T>& data) {
+        hpx::sort(hpx::execution::par, data.begin(), data.end());
+    });
+
+    double const comparison =
+        measure(keys, test_count, [](std::vector<T>& data) {
+            hpx::sort(hpx::execution::par, data.begin(), data.end(),
+                [](T lhs, T rhs) { return lhs < rhs; });
+        });
+
+    double const sequential =
+        measure(keys, test_count, [](std::vector<T>& data) {
+            std::sort(data.begin(), data.end());
+        });
+
+    hpx::util::format_to(std::cout,
+        "sort<{}>: radix {:.4f}s, comparison {:.4f}s, std::sort {:.4f}s, "
+        "speedup {:.2f}\n",
+        name, radix, comparison, sequential, comparison / radix);
+}
+
+template <typename T>
+void bench_sort_by_key(char const* name, std::size_t size, int test_count)
+{
+    std::vector<T> const keys = random_keys<T>(size);
+    std::vector<std::uint32_t> indices(size);
+
+    auto run = [&](auto comp) {
+        return measure(keys, test_count, [&](std::vector<T>& data) {
+            std::iota(indices.begin(), indices.end(), 0);
+            hpx::experimental::sort_by_key(hpx::execution::par, data.begin(),
+                data.end(), indices.begin(), comp);
+        });
+    };
+
+    double const radix = run(std::less<T>());
+    double const comparison = run([](T lhs, T rhs) { return lhs < rhs; });
+
+    hpx::util::format_to(std::cout,
+        "sort_by_key<{}, uint32_t>: radix {:.4f}s, comparison {:.4f}s, "
+        "speedup {:.2f}\n",
+        name, radix, comparison, comparison / radix);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const size = vm["vector_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    if (test_count <= 0)
+    {
+        std::cerr << "test_count cannot be zero or negative...\n";
+        return hpx::local::finalize();
+    }
+
+    std::cout << "using seed: " << seed << ", vector size: " << size << "\n";
+
+    bench_sort<std::uint32_t>("uint32_t", size, test_count);
+    bench_sort<std::int64_t>("int64_t", size, test_count);
+    bench_sort<double>("double", size, test_count);
+    bench_sort_by_key<std::int64_t>("int64_t", size, test_count);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(10000000),
+            "number of elements to sort")
+        ("test_count", value<int>()->default_value(5),
+            "number of tests to be averaged")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = {"hpx.os_threads=all"};
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
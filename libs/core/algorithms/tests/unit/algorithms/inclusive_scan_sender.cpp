@@ -0,0 +1,141 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+template <typename LnPolicy, typename ExPolicy, typename IteratorTag>
+void test_inclusive_scan_sender(
+    LnPolicy ln_policy, ExPolicy&& ex_policy, IteratorTag)
+{
+    static_assert(hpx::is_async_execution_policy_v<ExPolicy>,
+        "hpx::is_async_execution_policy_v<ExPolicy>");
+
+    using base_iterator = std::vector<std::size_t>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    namespace ex = hpx::execution::experimental;
+    namespace tt = hpx::this_thread::experimental;
+    using scheduler_t = ex::thread_pool_policy_scheduler<LnPolicy>;
+
+    auto exec = ex::explicit_scheduler_executor(scheduler_t(ln_policy));
+
+    std::vector<std::size_t> c(10007);
+    std::vector<std::size_t> d(c.size());
+    std::vector<std::size_t> e(c.size());
+    std::fill(std::begin(c), std::end(c), std::size_t(1));
+
+    std::size_t const val(0);
+    auto op = [](std::size_t v1, std::size_t v2) { return v1 + v2; };
+
+    {
+        auto snd_result =
+            tt::sync_wait(ex::just(iterator(std::begin(c)),
+                              iterator(std::end(c)), std::begin(d), op, val) |
+                hpx::inclusive_scan(ex_policy.on(exec)));
+        auto result = hpx::get<0>(*snd_result);
+
+        HPX_TEST(result == std::end(d));
+
+        // verify values
+        std::inclusive_scan(std::begin(c), std::end(c), std::begin(e), op, val);
+        HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+    }
+
+    {
+        // the scan composes with subsequent continuations
+        std::fill(std::begin(d), std::end(d), std::size_t(0));
+
+        auto snd_result =
+            tt::sync_wait(ex::just(iterator(std::begin(c)),
+                              iterator(std::end(c)), std::begin(d), op, val) |
+                hpx::inclusive_scan(ex_policy.on(exec)) |
+                ex::then([&](auto it) {
+                    return static_cast<std::size_t>(
+                        std::distance(std::begin(d), it));
+                }));
+        std::size_t result = hpx::get<0>(*snd_result);
+
+        HPX_TEST_EQ(result, c.size());
+        HPX_TEST(std::equal(std::begin(d), std::end(d), std::begin(e)));
+    }
+
+    {
+        // edge case: empty range
+        auto snd_result =
+            tt::sync_wait(ex::just(iterator(std::begin(c)),
+                              iterator(std::begin(c)), std::begin(d), op, val) |
+                hpx::inclusive_scan(ex_policy.on(exec)));
+        auto result = hpx::get<0>(*snd_result);
+
+        HPX_TEST(result == std::begin(d));
+    }
+}
+
+template <typename IteratorTag>
+void inclusive_scan_sender_test()
+{
+    using namespace hpx::execution;
+    test_inclusive_scan_sender(hpx::launch::sync, seq(task), IteratorTag());
+    test_inclusive_scan_sender(hpx::launch::sync, unseq(task), IteratorTag());
+
+    test_inclusive_scan_sender(hpx::launch::async, par(task), IteratorTag());
+    test_inclusive_scan_sender(
+        hpx::launch::async, par_unseq(task), IteratorTag());
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    inclusive_scan_sender_test<std::forward_iterator_tag>();
+    inclusive_scan_sender_test<std::random_access_iterator_tag>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,277 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify merge, inplace_merge, and the set operations, which split their work
+// along the merge path, for inputs of skewed shapes: one empty or tiny input,
+// disjoint inputs, and long runs of equivalent keys spanning the partition
+// boundaries. The elements carry their origin, which allows verifying that
+// the algorithms are stable by comparing with the sequential results of the
+// standard library.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
+#include <hpx/type_support/identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct element
+{
+    std::size_t key;
+    std::size_t origin;    // 1 or 2, the input sequence
+    std::size_t index;     // position in the input sequence
+
+    friend bool operator==(element const& lhs, element const& rhs)
+    {
+        return lhs.key == rhs.key && lhs.origin == rhs.origin &&
+            lhs.index == rhs.index;
+    }
+};
+
+// compare the keys only, elements of different origin are equivalent
+struct key_less
+{
+    bool operator()(element const& lhs, element const& rhs) const
+    {
+        return lhs.key < rhs.key;
+    }
+};
+
+// generate a sorted sequence of 'size' elements with keys starting at
+// 'offset', each key is repeated 'run' times
+std::vector<element> generate(std::size_t size, std::size_t run,
+    std::size_t origin, std::size_t offset = 0)
+{
+    std::vector<element> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = element{offset + i / run, origin, i};
+    }
+    return data;
+}
+
+struct shape
+{
+    std::string name;
+    std::vector<element> first;
+    std::vector<element> second;
+};
+
+std::vector<shape> generate_shapes(std::size_t size)
+{
+    std::vector<shape> shapes;
+
+    // one input empty
+    shapes.push_back({"first empty", {}, generate(size, 1, 2)});
+    shapes.push_back({"second empty", generate(size, 1, 1), {}});
+
+    // one input tiny, placed at the start, in the middle, and at the end of
+    // the other one
+    for (std::size_t offset : {std::size_t(0), size / 2, size})
+    {
+        shapes.push_back({"first tiny at " + std::to_string(offset),
+            generate(3, 1, 1, offset), generate(size, 1, 2)});
+        shapes.push_back({"second tiny at " + std::to_string(offset),
+            generate(size, 1, 1), generate(1, 1, 2, offset)});
+    }
+
+    // all elements of one input are smaller than those of the other
+    shapes.push_back({"disjoint, first smaller", generate(size, 1, 1),
+        generate(size / 3, 1, 2, size)});
+    shapes.push_back({"disjoint, second smaller",
+        generate(size / 3, 1, 1, size), generate(size, 1, 2)});
+
+    // long runs of equivalent keys, longer than the chunks
+    shapes.push_back({"long runs", generate(size, size / 8, 1),
+        generate(size, size / 8, 2)});
+    shapes.push_back({"long runs, skewed", generate(size, size / 4, 1),
+        generate(size / 16, size / 64, 2, 1)});
+    shapes.push_back({"all equivalent", generate(size, size, 1),
+        generate(size / 2, size, 2)});
+
+    return shapes;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Result>
+auto get_result(Result&& result)
+{
+    if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+    {
+        return result.get();
+    }
+    else
+    {
+        return std::forward<Result>(result);
+    }
+}
+
+// compare with the results of the standard algorithms, which are stable
+template <typename ExPolicy, typename F, typename StdF>
+void test_set_operation(ExPolicy policy, shape const& s, F&& f, StdF&& std_f)
+{
+    std::vector<element> dest(s.first.size() + s.second.size());
+    std::vector<element> expected(dest.size());
+
+    auto result = get_result<ExPolicy>(f(policy, std::begin(s.first),
+        std::end(s.first), std::begin(s.second), std::end(s.second),
+        std::begin(dest), key_less()));
+    auto expected_result = std_f(std::begin(s.first), std::end(s.first),
+        std::begin(s.second), std::end(s.second), std::begin(expected),
+        key_less());
+
+    HPX_TEST_EQ_MSG(std::distance(std::begin(dest), result),
+        std::distance(std::begin(expected), expected_result), s.name);
+    HPX_TEST_MSG(std::equal(std::begin(dest), result, std::begin(expected)),
+        s.name);
+}
+
+template <typename ExPolicy>
+void test_merge_skewed(ExPolicy policy, shape const& s)
+{
+    // merge
+    test_set_operation(
+        policy, s,
+        [](auto&&... args) {
+            return hpx::merge(std::forward<decltype(args)>(args)...);
+        },
+        [](auto&&... args) {
+            return std::merge(std::forward<decltype(args)>(args)...);
+        });
+
+    // inplace_merge
+    {
+        std::vector<element> data(s.first);
+        data.insert(std::end(data), std::begin(s.second), std::end(s.second));
+        std::vector<element> expected(data);
+
+        auto middle = std::next(std::begin(data), s.first.size());
+        if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+        {
+            hpx::inplace_merge(
+                policy, std::begin(data), middle, std::end(data), key_less())
+                .get();
+        }
+        else
+        {
+            hpx::inplace_merge(
+                policy, std::begin(data), middle, std::end(data), key_less());
+        }
+        std::inplace_merge(std::begin(expected),
+            std::next(std::begin(expected), s.first.size()), std::end(expected),
+            key_less());
+
+        HPX_TEST_MSG(data == expected, s.name);
+    }
+
+    // set operations
+    test_set_operation(
+        policy, s,
+        [](auto&&... args) {
+            return hpx::set_union(std::forward<decltype(args)>(args)...);
+        },
+        [](auto&&... args) {
+            return std::set_union(std::forward<decltype(args)>(args)...);
+        });
+    test_set_operation(
+        policy, s,
+        [](auto&&... args) {
+            return hpx::set_intersection(
+                std::forward<decltype(args)>(args)...);
+        },
+        [](auto&&... args) {
+            return std::set_intersection(
+                std::forward<decltype(args)>(args)...);
+        });
+    test_set_operation(
+        policy, s,
+        [](auto&&... args) {
+            return hpx::set_difference(std::forward<decltype(args)>(args)...);
+        },
+        [](auto&&... args) {
+            return std::set_difference(std::forward<decltype(args)>(args)...);
+        });
+    test_set_operation(
+        policy, s,
+        [](auto&&... args) {
+            return hpx::set_symmetric_difference(
+                std::forward<decltype(args)>(args)...);
+        },
+        [](auto&&... args) {
+            return std::set_symmetric_difference(
+                std::forward<decltype(args)>(args)...);
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the split at a diagonal takes exactly those elements of the first sequence
+// which a stable merge places before the diagonal
+void test_merge_path_split(shape const& s)
+{
+    std::vector<element> merged(s.first.size() + s.second.size());
+    std::merge(std::begin(s.first), std::end(s.first), std::begin(s.second),
+        std::end(s.second), std::begin(merged), key_less());
+
+    std::size_t taken_from_first = 0;
+    for (std::size_t diagonal = 0; diagonal <= merged.size(); ++diagonal)
+    {
+        std::size_t const split = hpx::parallel::detail::merge_path_split(
+            std::begin(s.first), s.first.size(), std::begin(s.second),
+            s.second.size(), diagonal, key_less(), hpx::identity_v,
+            hpx::identity_v);
+
+        HPX_TEST_EQ_MSG(split, taken_from_first, s.name);
+
+        if (diagonal != merged.size() && merged[diagonal].origin == 1)
+        {
+            ++taken_from_first;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map&)
+{
+    for (shape const& s : generate_shapes(1000))
+    {
+        test_merge_path_split(s);
+    }
+
+    for (shape const& s : generate_shapes(100000))
+    {
+        std::cout << "--- " << s.name << " ---" << std::endl;
+
+        test_merge_skewed(hpx::execution::seq, s);
+        test_merge_skewed(hpx::execution::par, s);
+        test_merge_skewed(hpx::execution::par(hpx::execution::task), s);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default, this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -145,6 +146,27 @@ void test_sort2()
     test_sort2_async(par(task), float(), std::greater<float>());
 }
 
+void test_sort_radix()
+{
+    using namespace hpx::execution;
+
+    // arithmetic values sorted using the radix sort, including sizes below
+    // the radix sort limit
+    std::size_t const sizes[] = {0, 1, 100, 10000, HPX_SORT_TEST_SIZE};
+    for (std::size_t size : sizes)
+    {
+        test_sort_radix(par, std::int8_t(), size);
+        test_sort_radix(par, std::int16_t(), size, std::greater<>());
+        test_sort_radix(par, int(), size);
+        test_sort_radix(par_unseq, std::uint32_t(), size, std::greater<>());
+        test_sort_radix(par, std::int64_t(), size);
+        test_sort_radix(par, std::uint64_t(), size);
+        test_sort_radix(par, float(), size);
+        test_sort_radix(par_unseq, double(), size);
+        test_sort_radix(par, double(), size, std::greater<double>());
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -157,6 +179,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_sort1();
     test_sort2();
+    test_sort_radix();
     sort_benchmark();
 
     return hpx::local::finalize();
@@ -9,12 +9,16 @@
 #include <hpx/modules/testing.hpp>
 #include <hpx/parallel/algorithms/sort_by_key.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <numeric>
 #include <random>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 //
@@ -228,6 +232,114 @@ void test_sort_by_key_async(
     HPX_TEST(is_equal);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> generate_radix_keys(std::size_t size)
+{
+    std::mt19937 g(static_cast<unsigned int>(std::rand()));
+    std::vector<T> keys(size);
+
+    // use a small range of values to have many duplicate keys, including
+    // negative ones for signed types
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_int_distribution<int> dist(-1000, 1000);
+        for (T& key : keys)
+        {
+            key = static_cast<T>(dist(g)) / T(8);
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<std::int64_t> dist(
+            std::is_signed_v<T> ? -1000 : 0, 1000);
+        for (T& key : keys)
+        {
+            key = static_cast<T>(dist(g));
+        }
+    }
+    return keys;
+}
+
+// arithmetic keys are sorted using the radix sort, verify that the values
+// are moved along with the keys
+template <typename ExPolicy, typename Tkey, typename Compare = std::less<>>
+void test_sort_by_key_radix(
+    ExPolicy&& policy, Tkey, std::size_t size, Compare comp = Compare())
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+    msg(typeid(ExPolicy).name(), typeid(Tkey).name(), typeid(Compare).name(),
+        radix);
+    std::cout << "\n";
+
+    std::vector<Tkey> keys = generate_radix_keys<Tkey>(size);
+    std::vector<std::size_t> values(size);
+    std::iota(values.begin(), values.end(), std::size_t(0));
+
+    std::vector<Tkey> const o_keys = keys;
+    std::vector<Tkey> expected = keys;
+    std::sort(expected.begin(), expected.end(), comp);
+
+    if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+    {
+        hpx::experimental::sort_by_key(std::forward<ExPolicy>(policy),
+            keys.begin(), keys.end(), values.begin(), comp)
+            .get();
+    }
+    else
+    {
+        hpx::experimental::sort_by_key(std::forward<ExPolicy>(policy),
+            keys.begin(), keys.end(), values.begin(), comp);
+    }
+
+    HPX_TEST(keys == expected);
+
+    // each value still belongs to its key, and no value was lost
+    bool values_match = true;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        if (values[i] >= size || o_keys[values[i]] != keys[i])
+        {
+            values_match = false;
+            break;
+        }
+    }
+    HPX_TEST(values_match);
+
+    std::sort(values.begin(), values.end());
+    std::vector<std::size_t> indices(size);
+    std::iota(indices.begin(), indices.end(), std::size_t(0));
+    HPX_TEST(values == indices);
+}
+
+void test_sort_by_key_radix()
+{
+    using namespace hpx::execution;
+
+    std::size_t const sizes[] = {0, 1, 100, 10000, HPX_SORT_BY_KEY_TEST_SIZE};
+    for (std::size_t size : sizes)
+    {
+        // signed keys
+        test_sort_by_key_radix(par, std::int16_t(), size);
+        test_sort_by_key_radix(par, int(), size);
+        test_sort_by_key_radix(par_unseq, std::int64_t(), size);
+        test_sort_by_key_radix(par(task), int(), size);
+
+        // floating point keys
+        test_sort_by_key_radix(par, float(), size);
+        test_sort_by_key_radix(par, double(), size);
+        test_sort_by_key_radix(par(task), float(), size);
+
+        // descending keys
+        test_sort_by_key_radix(par, int(), size, std::greater<>());
+        test_sort_by_key_radix(par, std::uint32_t(), size, std::greater<>());
+        test_sort_by_key_radix(par, float(), size, std::greater<float>());
+        test_sort_by_key_radix(
+            par(task), double(), size, std::greater<double>());
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void test_sort_by_key1()
 {
@@ -301,6 +413,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::srand(seed);
 
     test_sort_by_key1();
+    test_sort_by_key_radix();
     sort_by_key_benchmark();
 
     return hpx::local::finalize();
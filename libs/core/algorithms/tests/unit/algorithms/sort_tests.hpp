@@ -13,6 +13,7 @@
 
 #include "test_utils.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iomanip>
@@ -209,6 +210,30 @@ void test_sort1_async(ExPolicy&& policy, T, Compare comp = Compare())
     HPX_TEST(is_sorted);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// sort arithmetic values spanning the whole range of the type (including
+// negative values), compare with the result of std::sort
+template <typename ExPolicy, typename T, typename Compare = std::less<T>>
+void test_sort_radix(
+    ExPolicy&& policy, T, std::size_t size, Compare comp = Compare())
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+    msg(typeid(ExPolicy).name(), typeid(T).name(), typeid(Compare).name(), sync,
+        random);
+    std::cout << "\n";
+
+    std::vector<T> c(size);
+    rnd_fill<T>(c, (std::numeric_limits<T>::lowest)() / 2,
+        (std::numeric_limits<T>::max)() / 2, T(std::rand()));
+
+    std::vector<T> expected(c);
+    std::sort(expected.begin(), expected.end(), comp);
+
+    hpx::sort(std::forward<ExPolicy>(policy), c.begin(), c.end(), comp);
+    HPX_TEST(c == expected);
+}
+
 // test exceptions
 template <typename ExPolicy, typename T>
 void test_sort_exception(ExPolicy&& policy, T)
@@ -0,0 +1,156 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that a policy adapted with adapt_static_placement assigns contiguous
+// ranges of chunks to the worker threads, that the ranges are balanced if the
+// number of chunks is not divisible by the number of workers, and that the
+// same chunks are placed onto the same workers on every invocation.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/util/adapt_static_placement.hpp>
+
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+std::vector<std::size_t> chunk_to_worker(
+    ExPolicy const& policy, std::size_t num_chunks)
+{
+    std::vector<std::size_t> chunks(num_chunks);
+    std::iota(chunks.begin(), chunks.end(), std::size_t(0));
+
+    std::vector<std::size_t> workers(num_chunks, std::size_t(-1));
+    hpx::parallel::execution::bulk_sync_execute(
+        policy.executor(),
+        [&](std::size_t chunk) {
+            workers[chunk] = hpx::get_worker_thread_num();
+        },
+        chunks);
+
+    return workers;
+}
+
+void test_chunk_placement(std::size_t num_chunks)
+{
+    std::size_t const num_workers = hpx::get_num_worker_threads();
+
+    auto const policy = hpx::execution::experimental::adapt_static_placement(
+        hpx::execution::par);
+
+    std::vector<std::size_t> const workers =
+        chunk_to_worker(policy, num_chunks);
+
+    for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+    {
+        HPX_TEST_LT(workers[chunk], num_workers);
+    }
+
+    // if there are fewer chunks than workers, the first chunk may be run by
+    // the calling thread, the placement is verified only if all workers
+    // receive chunks
+    if (num_chunks < num_workers)
+    {
+        return;
+    }
+
+    // worker w is assigned the chunks [w * n / p, (w + 1) * n / p), the
+    // number of chunks per worker differs by at most one
+    for (std::size_t worker = 0; worker != num_workers; ++worker)
+    {
+        std::size_t const begin = worker * num_chunks / num_workers;
+        std::size_t const end = (worker + 1) * num_chunks / num_workers;
+
+        HPX_TEST_LTE(num_chunks / num_workers, end - begin);
+        HPX_TEST_LTE(end - begin, (num_chunks + num_workers - 1) / num_workers);
+
+        for (std::size_t chunk = begin; chunk != end; ++chunk)
+        {
+            HPX_TEST_EQ_MSG(workers[chunk], worker,
+                "chunk " + std::to_string(chunk) + " of " +
+                    std::to_string(num_chunks));
+        }
+    }
+
+    // the chunks are not stolen, repeated invocations give the same mapping
+    for (int i = 0; i != 3; ++i)
+    {
+        HPX_TEST(chunk_to_worker(policy, num_chunks) == workers);
+    }
+}
+
+// the chunks of an algorithm are placed in the same way, the workers process
+// contiguous index ranges in the order of their numbers
+void test_algorithm_placement(std::size_t count, std::size_t chunk_size)
+{
+    auto const policy = hpx::execution::experimental::adapt_static_placement(
+        hpx::execution::par.with(
+            hpx::execution::experimental::static_chunk_size(chunk_size)));
+
+    auto const run = [&]() {
+        std::vector<std::size_t> workers(count, std::size_t(-1));
+        hpx::experimental::for_loop(policy, std::size_t(0), count,
+            [&](std::size_t i) { workers[i] = hpx::get_worker_thread_num(); });
+        return workers;
+    };
+
+    std::vector<std::size_t> const workers = run();
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        HPX_TEST_LTE(workers[i - 1], workers[i]);
+    }
+
+    HPX_TEST(run() == workers);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::size_t const num_workers = hpx::get_num_worker_threads();
+
+    // fewer, as many, and more chunks than workers, including counts not
+    // divisible by the number of workers
+    std::vector<std::size_t> const num_chunks = {1, num_workers - 1,
+        num_workers, num_workers + 1, 2 * num_workers - 1, 3 * num_workers + 2,
+        7 * num_workers + 3, 64 * num_workers};
+
+    for (std::size_t n : num_chunks)
+    {
+        if (n != 0)
+        {
+            test_chunk_placement(n);
+        }
+    }
+
+    // the last chunk is not full
+    std::size_t const chunk_size = 16;
+    test_algorithm_placement(3 * num_workers * chunk_size + chunk_size / 2,
+        chunk_size);
+    test_algorithm_placement(
+        7 * num_workers * chunk_size + chunk_size - 1, chunk_size);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default, this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,709 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_cache concurrent_cache.hpp hpx/cache/concurrent_cache.hpp
+    ///
+    /// \brief The \a concurrent_cache implements a local (non-distributed)
+    ///        cache which is safe to be used concurrently from any number of
+    ///        threads.
+    ///
+    /// The cache is split into \a NumShards independent shards, each of which
+    /// is protected by its own mutex and placed on its own cache line. Keys
+    /// are distributed over the shards based on their hash value. Each shard
+    /// stores its entries in an open-addressing hash table (linear probing,
+    /// backward shift deletion), no memory is allocated for individual
+    /// entries.
+    ///
+    /// Entries are evicted using the CLOCK algorithm, an approximation of
+    /// LRU: a hit merely sets the 'referenced' bit of the entry, and the
+    /// eviction hand skips (and clears) referenced entries before evicting
+    /// the first unreferenced one. In contrast to \a lru_cache no list has
+    /// to be reordered on a hit.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. Each shard maintains its
+    ///                       own instance (see \a accumulate_statistics).
+    /// \tparam Hash          The hash function used for the keys.
+    /// \tparam KeyEqual      The function used to compare keys for equality.
+    /// \tparam Mutex         The type of the mutex protecting a shard.
+    /// \tparam NumShards     The number of shards, must be a power of two.
+    HPX_CORE_MODULE_EXPORT_EXTERN template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+        typename Mutex = std::mutex, std::size_t NumShards = 16>
+    class concurrent_cache
+    {
+        static_assert(NumShards != 0 && (NumShards & (NumShards - 1)) == 0,
+            "the number of shards must be a power of two");
+
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using statistics_type = Statistics;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using mutex_type = Mutex;
+        using size_type = std::size_t;
+
+        static constexpr std::size_t num_shards = NumShards;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+        static constexpr int log2(std::size_t n) noexcept
+        {
+            int bits = 0;
+            while ((std::size_t(1) << bits) < n)
+                ++bits;
+            return bits;
+        }
+
+        static constexpr int shard_bits = log2(NumShards);
+        static constexpr int min_table_bits = 3;
+
+        struct slot
+        {
+            std::optional<entry_pair> value;
+            std::uint64_t hash = 0;
+            bool referenced = false;
+        };
+
+        struct shard
+        {
+            mutable mutex_type mtx;
+            std::vector<slot> table;
+            int table_bits = 0;
+            size_type count = 0;
+            size_type max_count = 0;
+            size_type hand = 0;
+            statistics_type statistics;
+        };
+
+        // Spread the bits of the hash value, the high bits select the shard,
+        // the following bits select the home slot inside the shard's table.
+        static std::uint64_t mix(std::uint64_t h) noexcept
+        {
+            return h * 0x9e3779b97f4a7c15ull;
+        }
+
+        static std::size_t shard_index(std::uint64_t h) noexcept
+        {
+            if constexpr (shard_bits == 0)
+            {
+                return 0;
+            }
+            else
+            {
+                return static_cast<std::size_t>(h >> (64 - shard_bits));
+            }
+        }
+
+        static std::size_t home_slot(shard const& s, std::uint64_t h) noexcept
+        {
+            return static_cast<std::size_t>(
+                (h << shard_bits) >> (64 - s.table_bits));
+        }
+
+        static constexpr std::size_t table_mask(shard const& s) noexcept
+        {
+            return (std::size_t(1) << s.table_bits) - 1;
+        }
+
+        std::uint64_t hash_key(key_type const& key) const
+        {
+            return mix(static_cast<std::uint64_t>(hash_(key)));
+        }
+
+        shard& get_shard(std::uint64_t h) noexcept
+        {
+            return shards_[shard_index(h)].data_;
+        }
+
+        shard const& get_shard(std::uint64_t h) const noexcept
+        {
+            return shards_[shard_index(h)].data_;
+        }
+
+        // maximum number of entries per shard for the given overall size, zero
+        // means unlimited
+        static constexpr size_type shard_capacity(size_type max_size) noexcept
+        {
+            return max_size == 0 ? 0 : (max_size + NumShards - 1) / NumShards;
+        }
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_cache.
+        ///
+        /// \param max_size   [in] The maximal number of entries this cache is
+        ///                   allowed to hold at any time. The default is zero
+        ///                   (no size limitation). The limit is enforced for
+        ///                   each shard separately, i.e. each of the shards
+        ///                   may hold up to max_size / NumShards entries
+        ///                   (rounded up).
+        ///
+        explicit concurrent_cache(size_type max_size = 0,
+            hasher const& hash = hasher(),
+            key_equal const& equal = key_equal())
+          : max_size_(max_size)
+          , hash_(hash)
+          , equal_(equal)
+        {
+            for (auto& s : shards_)
+            {
+                s.data_.max_count = shard_capacity(max_size);
+                rehash(s.data_, s.data_.max_count);
+            }
+        }
+
+        concurrent_cache(concurrent_cache const&) = delete;
+        concurrent_cache(concurrent_cache&&) = delete;
+        concurrent_cache& operator=(concurrent_cache const&) = delete;
+        concurrent_cache& operator=(concurrent_cache&&) = delete;
+
+        ~concurrent_cache() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \note       The shards are inspected one by one, the result is
+        ///             therefore only a snapshot if the cache is concurrently
+        ///             modified.
+        ///
+        /// \returns The current size of this cache instance.
+        [[nodiscard]] size_type size() const
+        {
+            size_type result = 0;
+            for (auto const& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx);
+                result += s.data_.count;
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \returns    The maximum number of entries this cache instance is
+        ///             currently allowed to hold. If this number is zero the
+        ///             cache has no limitation with regard to a maximum size.
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return max_size_.load(std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        void reserve(size_type max_size)
+        {
+            max_size_.store(max_size, std::memory_order_relaxed);
+
+            size_type const max_count = shard_capacity(max_size);
+            for (auto& sd : shards_)
+            {
+                shard& s = sd.data_;
+                std::lock_guard<mutex_type> l(s.mtx);
+
+                s.max_count = max_count;
+                while (max_count != 0 && s.count > max_count)
+                {
+                    evict(s);
+                }
+                rehash(s, (std::max) (max_count, s.count));
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param key    [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \note         This function does not mark the entry as recently
+        ///               used.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        [[nodiscard]] bool holds_key(key_type const& key) const
+        {
+            std::uint64_t const h = hash_key(key);
+            shard const& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx);
+            return find(s, key, h) != npos;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey[out] Return the full real key found in the cache
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            std::uint64_t const h = hash_key(key);
+            shard& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx);
+            update_on_exit update(s.statistics, statistics::method::get_entry);
+
+            std::size_t const pos = find(s, key, h);
+            if (pos == npos)
+            {
+                // Got miss
+                s.statistics.got_miss();    // update statistics
+                return false;
+            }
+
+            slot& sl = s.table[pos];
+            sl.referenced = true;
+
+            // update statistics
+            s.statistics.got_hit();
+
+            // got hit
+            realkey = sl.value->first;
+            entry = sl.value->second;
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a false if the cache already
+        ///               holds an entry for the given key (which is left
+        ///               unchanged), otherwise it returns \a true.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        bool insert(key_type const& key, Entry_&& entry)
+        {
+            std::uint64_t const h = hash_key(key);
+            shard& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx);
+            update_on_exit update(
+                s.statistics, statistics::method::insert_entry);
+
+            if (find(s, key, h) != npos)
+            {
+                return false;
+            }
+
+            insert_nonexist(s, key, h, HPX_FORWARD(Entry_, entry));
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache. If the key was not
+        ///               found, the entry is added to the cache.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        void update(key_type const& key, Entry_&& entry)
+        {
+            std::uint64_t const h = hash_key(key);
+            shard& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx);
+            update_on_exit update(
+                s.statistics, statistics::method::update_entry);
+
+            // Is it already in the cache?
+            std::size_t const pos = find(s, key, h);
+            if (pos == npos)
+            {
+                // got miss
+                s.statistics.got_miss();    // update statistics
+                insert_nonexist(s, key, h, HPX_FORWARD(Entry_, entry));
+                return;
+            }
+
+            // got hit!
+            slot& sl = s.table[pos];
+            sl.value->second = HPX_FORWARD(Entry_, entry);
+            sl.referenced = true;
+
+            // update statistics
+            s.statistics.got_hit();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will not succeed.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated, otherwise it returns \a false.
+        ///               If the entry currently is not held by the cache it is
+        ///               added and the return value reflects the outcome of
+        ///               the corresponding insert operation.
+        template <typename F, typename Entry_,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>, int> =
+                0>
+        bool update_if(key_type const& key, Entry_&& entry, F&& f)
+        {
+            std::uint64_t const h = hash_key(key);
+            shard& s = get_shard(h);
+
+            std::lock_guard<mutex_type> l(s.mtx);
+            update_on_exit update(
+                s.statistics, statistics::method::update_entry);
+
+            // Is it already in the cache?
+            std::size_t const pos = find(s, key, h);
+            if (pos == npos)
+            {
+                // got miss
+                s.statistics.got_miss();    // update statistics
+                insert_nonexist(s, key, h, HPX_FORWARD(Entry_, entry));
+                return true;
+            }
+
+            slot& sl = s.table[pos];
+            if (f(key, sl.value->first))
+                return false;
+
+            // got hit!
+            sl.value->second = HPX_FORWARD(Entry_, entry);
+            sl.referenced = true;
+
+            // update statistics
+            s.statistics.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               currently held in the cache (as an \a entry_pair).
+        ///               An entry is removed from the cache whenever the
+        ///               value returned from this invocation is \a true. The
+        ///               shard holding the entry is locked during the
+        ///               invocation.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            size_type erased = 0;
+            for (auto& sd : shards_)
+            {
+                shard& s = sd.data_;
+
+                std::lock_guard<mutex_type> l(s.mtx);
+                update_on_exit update(
+                    s.statistics, statistics::method::erase_entry);
+
+                for (std::size_t pos = 0; pos != s.table.size();)
+                {
+                    slot& sl = s.table[pos];
+                    if (sl.value && ep(*sl.value))
+                    {
+                        ++erased;
+
+                        // the slot is refilled by backward shifting, look at
+                        // the same position again
+                        remove(s, pos);
+
+                        // update statistics
+                        s.statistics.got_eviction();
+                    }
+                    else
+                    {
+                        ++pos;
+                    }
+                }
+            }
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \returns      This function returns the number of removed entries.
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (auto& sd : shards_)
+            {
+                shard& s = sd.data_;
+
+                std::lock_guard<mutex_type> l(s.mtx);
+                erased += s.count;
+                for (slot& sl : s.table)
+                {
+                    sl = slot();
+                }
+                s.count = 0;
+                s.hand = 0;
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Combine the statistics collected by all shards
+        ///
+        /// \param f      [in] A callable taking a reference to an instance of
+        ///               \a statistics_type and returning a value. It is
+        ///               invoked once for each shard while the shard is
+        ///               locked.
+        ///
+        /// \returns      This function returns the sum of the values returned
+        ///               by all invocations of \a f.
+        template <typename F>
+        auto accumulate_statistics(F&& f)
+        {
+            using result_type =
+                std::decay_t<std::invoke_result_t<F&, statistics_type&>>;
+
+            result_type result = result_type();
+            for (auto& sd : shards_)
+            {
+                shard& s = sd.data_;
+
+                std::lock_guard<mutex_type> l(s.mtx);
+                result += f(s.statistics);
+            }
+            return result;
+        }
+
+    private:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        std::size_t find(
+            shard const& s, key_type const& key, std::uint64_t h) const
+        {
+            std::size_t const mask = table_mask(s);
+            for (std::size_t pos = home_slot(s, h);; pos = (pos + 1) & mask)
+            {
+                slot const& sl = s.table[pos];
+                if (!sl.value)
+                    return npos;
+
+                if (sl.hash == h && equal_(sl.value->first, key))
+                    return pos;
+            }
+        }
+
+        template <typename Entry_>
+        void insert_nonexist(
+            shard& s, key_type const& key, std::uint64_t h, Entry_&& entry)
+        {
+            // Do we need to evict a cache entry?
+            if (s.max_count != 0 && s.count >= s.max_count)
+            {
+                evict(s);
+            }
+            else if (s.max_count == 0 && 2 * (s.count + 1) > s.table.size())
+            {
+                rehash(s, 2 * (s.count + 1));
+            }
+
+            std::size_t const mask = table_mask(s);
+            std::size_t pos = home_slot(s, h);
+            while (s.table[pos].value)
+            {
+                pos = (pos + 1) & mask;
+            }
+
+            slot& sl = s.table[pos];
+            sl.value.emplace(key, HPX_FORWARD(Entry_, entry));
+            sl.hash = h;
+            sl.referenced = false;
+            ++s.count;
+
+            // update statistics
+            s.statistics.got_insertion();
+        }
+
+        // Remove the entry stored at the given position, move subsequent
+        // entries of the same probe sequence back to keep lookups correct.
+        static void remove(shard& s, std::size_t pos)
+        {
+            std::size_t const mask = table_mask(s);
+
+            s.table[pos].value.reset();
+            --s.count;
+
+            std::size_t hole = pos;
+            for (std::size_t next = (pos + 1) & mask; s.table[next].value;
+                next = (next + 1) & mask)
+            {
+                std::size_t const home = home_slot(s, s.table[next].hash);
+
+                // move the entry if its home slot is not in (hole, next]
+                if (((next - home) & mask) >= ((next - hole) & mask))
+                {
+                    s.table[hole] = HPX_MOVE(s.table[next]);
+                    s.table[next].value.reset();
+                    hole = next;
+                }
+            }
+        }
+
+        // Evict one entry using the CLOCK algorithm.
+        void evict(shard& s)
+        {
+            HPX_ASSERT(s.count != 0);
+
+            std::size_t const mask = table_mask(s);
+            while (true)
+            {
+                slot& sl = s.table[s.hand];
+                if (sl.value)
+                {
+                    if (!sl.referenced)
+                    {
+                        remove(s, s.hand);
+                        s.statistics.got_eviction();
+                        return;
+                    }
+                    sl.referenced = false;
+                }
+                s.hand = (s.hand + 1) & mask;
+            }
+        }
+
+        // Resize the table of the given shard to be able to hold at least the
+        // given number of entries with a load factor of at most 1/2.
+        static void rehash(shard& s, size_type count)
+        {
+            int bits = log2(2 * count);
+            if (bits < min_table_bits)
+                bits = min_table_bits;
+            if (bits > 64 - shard_bits)
+                bits = 64 - shard_bits;
+
+            if (bits == s.table_bits)
+                return;
+
+            std::vector<slot> old_table(std::size_t(1) << bits);
+            std::swap(old_table, s.table);
+            s.table_bits = bits;
+            s.hand = 0;
+
+            std::size_t const mask = table_mask(s);
+            for (slot& sl : old_table)
+            {
+                if (!sl.value)
+                    continue;
+
+                std::size_t pos = home_slot(s, sl.hash);
+                while (s.table[pos].value)
+                {
+                    pos = (pos + 1) & mask;
+                }
+                s.table[pos] = HPX_MOVE(sl);
+            }
+        }
+
+    private:
+        std::atomic<size_type> max_size_;
+        hasher hash_;
+        key_equal equal_;
+
+        std::array<util::cache_line_data<shard>, NumShards> shards_;
+    };
+}    // namespace hpx::util::cache
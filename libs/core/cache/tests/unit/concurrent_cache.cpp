@@ -0,0 +1,228 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/cache.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    constexpr data(char const* const k, char const* const v) noexcept
+      : key(k)
+      , value(v)
+    {
+    }
+
+    char const* const key;
+    char const* const value;
+};
+
+data cache_entries[] = {data("white", "255,255,255"),
+    data("yellow", "255,255,0"), data("green", "0,255,0"),
+    data("blue", "0,0,255"), data("magenta", "255,0,255"),
+    data("black", "0,0,0"), data(nullptr, nullptr)};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert()
+{
+    using cache_type = hpx::util::cache::concurrent_cache<std::string,
+        std::string, hpx::util::cache::statistics::local_statistics>;
+
+    cache_type c;
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.capacity());
+
+    // insert all items into the cache
+    for (data const* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST(!c.insert(d->key, d->value));
+    }
+
+    // there should be 6 items in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(6), c.size());
+
+    for (data const* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        std::string realkey, value;
+        HPX_TEST(c.holds_key(d->key));
+        HPX_TEST(c.get_entry(d->key, realkey, value));
+        HPX_TEST_EQ(realkey, std::string(d->key));
+        HPX_TEST_EQ(value, std::string(d->value));
+    }
+
+    std::string value;
+    HPX_TEST(!c.get_entry("red", value));
+
+    using statistics_type = hpx::util::cache::statistics::local_statistics;
+    HPX_TEST_EQ(c.accumulate_statistics(
+                    [](statistics_type& s) { return s.hits(false); }),
+        static_cast<std::size_t>(6));
+    HPX_TEST_EQ(c.accumulate_statistics(
+                    [](statistics_type& s) { return s.misses(false); }),
+        static_cast<std::size_t>(1));
+    HPX_TEST_EQ(c.accumulate_statistics(
+                    [](statistics_type& s) { return s.insertions(false); }),
+        static_cast<std::size_t>(6));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_update_and_erase()
+{
+    using cache_type =
+        hpx::util::cache::concurrent_cache<std::string, std::string>;
+
+    cache_type c;
+    for (data const* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        c.update(d->key, d->value);
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(6), c.size());
+
+    c.update("yellow", "255,0,0");
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(6), c.size());
+
+    std::string yellow;
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "255,0,0");
+
+    // update_if does not replace the value if the predicate returns true
+    HPX_TEST(!c.update_if("yellow", "0,0,0",
+        [](std::string const&, std::string const&) { return true; }));
+    HPX_TEST(c.update_if("yellow", "255,255,0",
+        [](std::string const&, std::string const&) { return false; }));
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "255,255,0");
+
+    HPX_TEST_EQ(c.erase([](cache_type::entry_pair const& p) {
+        return p.first == "blue" || p.first == "black";
+    }),
+        static_cast<cache_type::size_type>(2));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(4), c.size());
+    HPX_TEST(!c.holds_key("blue"));
+    HPX_TEST(c.holds_key("green"));
+
+    HPX_TEST_EQ(c.clear(), static_cast<cache_type::size_type>(4));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_eviction()
+{
+    // a single shard to make the eviction order predictable
+    using cache_type = hpx::util::cache::concurrent_cache<std::size_t,
+        std::size_t, hpx::util::cache::statistics::local_statistics,
+        std::hash<std::size_t>, std::equal_to<std::size_t>, std::mutex, 1>;
+
+    cache_type c(4);
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.insert(i, i));
+    }
+
+    // mark all but the entry '2' as recently used
+    std::size_t value = 0;
+    HPX_TEST(c.get_entry(0, value));
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST(c.get_entry(3, value));
+
+    // inserting a new entry must evict the only unreferenced one
+    HPX_TEST(c.insert(4, 4));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(4), c.size());
+    HPX_TEST(!c.holds_key(2));
+    HPX_TEST(c.holds_key(0));
+    HPX_TEST(c.holds_key(1));
+    HPX_TEST(c.holds_key(3));
+    HPX_TEST(c.holds_key(4));
+
+    // shrinking the cache evicts entries
+    c.reserve(2);
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(2), c.size());
+
+    // growing the cache keeps all entries
+    c.reserve(100);
+    for (std::size_t i = 10; i != 100; ++i)
+    {
+        HPX_TEST(c.insert(i, i));
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(92), c.size());
+    for (std::size_t i = 10; i != 100; ++i)
+    {
+        HPX_TEST(c.get_entry(i, value));
+        HPX_TEST_EQ(value, i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    using cache_type =
+        hpx::util::cache::concurrent_cache<std::size_t, std::size_t>;
+
+    constexpr std::size_t num_threads = 4;
+    constexpr std::size_t num_keys = 1000;
+
+    cache_type c(num_keys * num_threads);
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            for (std::size_t i = 0; i != num_keys; ++i)
+            {
+                std::size_t const key = t * num_keys + i;
+                c.update(key, key);
+
+                std::size_t value = 0;
+                if (c.get_entry(key, value))
+                {
+                    HPX_TEST_EQ(value, key);
+                }
+
+                // erase every tenth entry again
+                if (i % 10 == 0)
+                {
+                    c.erase([key](cache_type::entry_pair const& p) {
+                        return p.first == key;
+                    });
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_LTE(c.size(), num_keys * num_threads);
+    for (std::size_t key = 0; key != num_keys * num_threads; ++key)
+    {
+        std::size_t value = 0;
+        if (c.get_entry(key, value))
+        {
+            HPX_TEST_NEQ(key % 10, static_cast<std::size_t>(0));
+            HPX_TEST_EQ(value, key);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert();
+    test_update_and_erase();
+    test_eviction();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
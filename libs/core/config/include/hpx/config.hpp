@@ -356,6 +356,13 @@
 #  define HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_STAGED 0
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of pending tasks the local_workrequesting_scheduler hands
+// over in response to a single steal-half request.
+#if !defined(HPX_WORKREQUESTING_MAX_STEAL_BATCH_SIZE)
+#  define HPX_WORKREQUESTING_MAX_STEAL_BATCH_SIZE 64
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Minimum number of staged tasks to add to work items queue.
 #if !defined(HPX_THREAD_QUEUE_MIN_ADD_NEW_COUNT)
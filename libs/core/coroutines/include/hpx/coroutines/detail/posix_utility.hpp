@@ -32,6 +32,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 
 // include unistd.h conditionally to check for POSIX version. Not all OSs have the
 // unistd header...
@@ -81,7 +82,7 @@ namespace hpx::threads::coroutines::detail::posix {
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
-    inline void* alloc_stack(std::size_t size)
+    inline void* map_stack(std::size_t size)
     {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
@@ -149,6 +150,14 @@ namespace hpx::threads::coroutines::detail::posix {
         // page.
         if ((reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull)) != *watermark)
         {
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+            // pooled stacks are decommitted only beyond the number of stacks
+            // the pool keeps committed
+            if (use_stack_pool && stack_pool_keep_committed(stack, size))
+            {
+                return false;
+            }
+#endif
             // We never free up the first page, as it's initialized only when the
             // stack is created.
             ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
@@ -158,7 +167,7 @@ namespace hpx::threads::coroutines::detail::posix {
         return false;
     }
 
-    inline void free_stack(void* stack, std::size_t size)
+    inline void unmap_stack(void* stack, std::size_t size)
     {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
@@ -176,6 +185,29 @@ namespace hpx::threads::coroutines::detail::posix {
 #endif
     }
 
+    inline void* alloc_stack(std::size_t size)
+    {
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+        if (use_stack_pool)
+        {
+            return stack_pool_allocate(size);
+        }
+#endif
+        return map_stack(size);
+    }
+
+    inline void free_stack(void* stack, std::size_t size)
+    {
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+        if (use_stack_pool)
+        {
+            stack_pool_deallocate(stack, size);
+            return;
+        }
+#endif
+        unmap_stack(stack, size);
+    }
+
 #else
     // non-mmap()
 
@@ -0,0 +1,79 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/config/defines.hpp>
+
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// The stack pool recycles the memory used for coroutine stacks instead of
+// mapping and unmapping it for every thread object. Each OS thread keeps a
+// free list of stacks per size class (one class for each of the distinct
+// stack sizes in use, i.e. for the sizes selected by thread_stacksize). Empty
+// free lists are refilled in batches, either from the stacks other threads
+// have given back or by carving a new arena into batch_size stacks. Arenas
+// are bound to the NUMA domain of the thread that creates them.
+//
+// Stacks given back to a free list stay committed as long as the list holds
+// no more than watermark stacks. Any stacks beyond that are handed to the
+// global pool, after their pages have been released to the OS. Stacks of
+// thread objects which are recycled without being freed are decommitted by
+// reset_stack() only once the OS thread keeps more than watermark recycled
+// stacks committed.
+namespace hpx::threads::coroutines::detail::posix {
+
+    struct stack_pool_parameters
+    {
+        // number of stacks carved from a newly mapped arena
+        std::size_t batch_size = 16;
+
+        // number of stacks a free list holds before decommitting stacks
+        std::size_t watermark = 64;
+
+        // called for each new arena, used for binding its memory to the NUMA
+        // domain of the calling thread
+        void (*bind_arena)(void* addr, std::size_t len) = nullptr;
+    };
+
+    // this global variable is used to control whether the stack pool will be
+    // used or not
+    HPX_CORE_EXPORT extern bool use_stack_pool;
+
+    HPX_CORE_EXPORT void configure_stack_pool(
+        stack_pool_parameters const& params) noexcept;
+
+    // Allocate and free a stack of the given size, the size does not include
+    // the guard page (if any)
+    HPX_CORE_EXPORT void* stack_pool_allocate(std::size_t size);
+    HPX_CORE_EXPORT void stack_pool_deallocate(
+        void* stack, std::size_t size) noexcept;
+
+    // Returns whether the given recycled stack may stay committed, i.e.
+    // whether the calling thread keeps no more than watermark recycled stacks
+    // committed
+    HPX_CORE_EXPORT bool stack_pool_keep_committed(
+        void* stack, std::size_t size) noexcept;
+
+    // Statistics exposed through performance counters
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_hit_count(bool reset) noexcept;
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_miss_count(bool reset) noexcept;
+
+    // hit rate in 0.01%
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_hit_rate(bool reset) noexcept;
+
+    // number of bytes of the memory mapped for pooled stacks which are
+    // currently resident in physical memory
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_resident_bytes(
+        bool reset) noexcept;
+}    // namespace hpx::threads::coroutines::detail::posix
+
+#endif
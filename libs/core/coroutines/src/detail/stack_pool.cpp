@@ -0,0 +1,502 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/config/defines.hpp>
+
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::coroutines::detail::posix {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // this global variable is used to control whether the stack pool will be
+    // used or not
+    bool use_stack_pool = false;
+
+    namespace {
+
+        // all stack sizes used at runtime are derived from the four
+        // configured thread_stacksize values, this leaves ample room
+        constexpr std::size_t max_size_classes = 8;
+
+        struct size_class_data
+        {
+            std::mutex mtx;
+            std::vector<void*> stacks;    // decommitted stacks
+        };
+
+        // The hit and miss counts are kept per OS thread, they are written by
+        // the owning thread only (without read-modify-write operations) and
+        // are summed up when read.
+        struct thread_counters
+        {
+            std::atomic<std::int64_t> hits{0};
+            std::atomic<std::int64_t> misses{0};
+        };
+
+        void increment(std::atomic<std::int64_t>& counter) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+        }
+
+        struct global_stack_pool
+        {
+            std::array<std::atomic<std::size_t>, max_size_classes> sizes{};
+            std::array<size_class_data, max_size_classes> classes;
+
+            stack_pool_parameters params;
+
+            // the counters of all live threads, and the counts of the threads
+            // which have exited already
+            std::mutex counters_mtx;
+            std::vector<thread_counters*> counters;
+            std::int64_t retired_hits = 0;
+            std::int64_t retired_misses = 0;
+
+            // all arenas mapped so far, used for computing the resident size
+            std::mutex arenas_mtx;
+            std::vector<std::pair<void*, std::size_t>> arenas;
+        };
+
+        // The pool is intentionally leaked, stacks may be released by
+        // thread-local caches during static destruction.
+        global_stack_pool& get_global_pool() noexcept
+        {
+            static global_stack_pool* pool = new global_stack_pool();
+            return *pool;
+        }
+
+        constexpr std::size_t invalid_size_class = std::size_t(-1);
+
+        // Return the size class for the given stack size, registers a new
+        // class if needed and possible.
+        std::size_t get_size_class(std::size_t size, bool create) noexcept
+        {
+            global_stack_pool& pool = get_global_pool();
+            for (std::size_t i = 0; i != max_size_classes; ++i)
+            {
+                std::size_t current =
+                    pool.sizes[i].load(std::memory_order_acquire);
+                if (current == size)
+                    return i;
+
+                if (current == 0)
+                {
+                    if (!create)
+                        return invalid_size_class;
+
+                    if (pool.sizes[i].compare_exchange_strong(
+                            current, size, std::memory_order_acq_rel) ||
+                        current == size)
+                    {
+                        return i;
+                    }
+                }
+            }
+            return invalid_size_class;
+        }
+
+        std::size_t guard_size() noexcept
+        {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+            return use_guard_pages ? EXEC_PAGESIZE : 0;
+#else
+            return 0;
+#endif
+        }
+
+        // Hand the given stacks to the global pool, decommitting them first.
+        void release_stacks(std::size_t size_class, void* const* first,
+            void* const* last) noexcept
+        {
+            global_stack_pool& pool = get_global_pool();
+            std::size_t const size =
+                pool.sizes[size_class].load(std::memory_order_relaxed);
+
+            for (void* const* it = first; it != last; ++it)
+            {
+                ::madvise(*it, size, MADV_DONTNEED);
+            }
+
+            size_class_data& data = pool.classes[size_class];
+            std::lock_guard<std::mutex> l(data.mtx);
+            try
+            {
+                data.stacks.insert(data.stacks.end(), first, last);
+            }
+            catch (...)
+            {
+                // leak the stacks, this is the best we can do without
+                // throwing
+            }
+        }
+
+        // Map a new arena holding batch_size stacks and add them to the given
+        // free list.
+        void map_arena(std::size_t size, std::vector<void*>& stacks)
+        {
+            global_stack_pool& pool = get_global_pool();
+
+            std::size_t const guard = guard_size();
+            std::size_t const stride = size + guard;
+            std::size_t const count =
+                pool.params.batch_size != 0 ? pool.params.batch_size : 1;
+            std::size_t const len = stride * count;
+
+            void* arena = ::mmap(nullptr, len, PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                MAP_PRIVATE | MAP_ANON,
+#else
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                -1, 0);
+
+            if (arena == MAP_FAILED)
+            {
+                throw std::runtime_error(
+                    "mmap() failed to allocate thread stack arena");
+            }
+
+            if (pool.params.bind_arena != nullptr)
+            {
+                // NUMA binding is an optimization only, ignore failures
+                try
+                {
+                    pool.params.bind_arena(arena, len);
+                }
+                catch (...)
+                {
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> l(pool.arenas_mtx);
+                try
+                {
+                    pool.arenas.emplace_back(arena, len);
+                }
+                catch (...)
+                {
+                    // the arena will not be accounted for in the statistics
+                }
+            }
+
+            stacks.reserve(stacks.size() + count);
+
+            // hand out the stacks in address order, lowest address last
+            char* base = static_cast<char*>(arena);
+            for (std::size_t i = count; i != 0; --i)
+            {
+                char* slot = base + (i - 1) * stride;
+                if (guard != 0)
+                {
+                    ::mprotect(slot, guard, PROT_NONE);
+                }
+                stacks.push_back(slot + guard);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct local_stack_cache
+        {
+            local_stack_cache()
+            {
+                global_stack_pool& pool = get_global_pool();
+                std::lock_guard<std::mutex> l(pool.counters_mtx);
+                try
+                {
+                    pool.counters.push_back(&counters);
+                }
+                catch (...)
+                {
+                    // the counts of this thread will not be accounted for in
+                    // the statistics
+                }
+            }
+
+            local_stack_cache(local_stack_cache const&) = delete;
+            local_stack_cache(local_stack_cache&&) = delete;
+            local_stack_cache& operator=(local_stack_cache const&) = delete;
+            local_stack_cache& operator=(local_stack_cache&&) = delete;
+
+            ~local_stack_cache()
+            {
+                {
+                    global_stack_pool& pool = get_global_pool();
+                    std::lock_guard<std::mutex> l(pool.counters_mtx);
+                    auto const it = std::find(
+                        pool.counters.begin(), pool.counters.end(), &counters);
+                    if (it != pool.counters.end())
+                    {
+                        pool.retired_hits += counters.hits.load();
+                        pool.retired_misses += counters.misses.load();
+                        pool.counters.erase(it);
+                    }
+                }
+
+                for (std::size_t i = 0; i != max_size_classes; ++i)
+                {
+                    std::vector<void*>& s = stacks[i];
+                    if (!s.empty())
+                    {
+                        release_stacks(i, s.data(), s.data() + s.size());
+                    }
+                }
+            }
+
+            void* allocate(std::size_t size_class, std::size_t size)
+            {
+                global_stack_pool& pool = get_global_pool();
+
+                std::vector<void*>& s = stacks[size_class];
+                if (s.empty())
+                {
+                    // try to refill from the stacks released by others
+                    size_class_data& data = pool.classes[size_class];
+                    {
+                        std::lock_guard<std::mutex> l(data.mtx);
+                        std::size_t const n =
+                            (std::min) (data.stacks.size(),
+                                pool.params.batch_size != 0 ?
+                                    pool.params.batch_size :
+                                    1);
+                        s.insert(s.end(), data.stacks.end() - n,
+                            data.stacks.end());
+                        data.stacks.resize(data.stacks.size() - n);
+                    }
+
+                    if (s.empty())
+                    {
+                        increment(counters.misses);
+                        map_arena(size, s);
+                    }
+                    else
+                    {
+                        increment(counters.hits);
+                    }
+                }
+                else
+                {
+                    increment(counters.hits);
+                }
+
+                void* stack = s.back();
+                s.pop_back();
+                return stack;
+            }
+
+            void deallocate(std::size_t size_class, void* stack) noexcept
+            {
+                global_stack_pool& pool = get_global_pool();
+
+                std::vector<void*>& s = stacks[size_class];
+                try
+                {
+                    s.push_back(stack);
+                }
+                catch (...)
+                {
+                    release_stacks(size_class, &stack, &stack + 1);
+                    return;
+                }
+
+                // hand the coldest stacks to the global pool once the free
+                // list exceeds its watermark
+                std::size_t const watermark = pool.params.watermark;
+                if (s.size() > watermark)
+                {
+                    std::size_t const n = s.size() - watermark / 2;
+                    release_stacks(size_class, s.data(), s.data() + n);
+                    s.erase(s.begin(), s.begin() + n);
+                }
+            }
+
+            // Recycled stacks are kept committed as long as this thread has
+            // kept no more than watermark other stacks committed.
+            bool keep_committed(void* stack) noexcept
+            {
+                if (std::find(committed.begin(), committed.end(), stack) !=
+                    committed.end())
+                {
+                    return true;
+                }
+
+                if (committed.size() < get_global_pool().params.watermark)
+                {
+                    try
+                    {
+                        committed.push_back(stack);
+                        return true;
+                    }
+                    catch (...)
+                    {
+                    }
+                }
+                return false;
+            }
+
+            std::array<std::vector<void*>, max_size_classes> stacks;
+
+            // stacks of recycled thread objects which were not decommitted,
+            // the addresses are not removed once the stacks are freed, this
+            // merely keeps a recycled stack at the same address committed
+            std::vector<void*> committed;
+
+            thread_counters counters;
+        };
+
+        local_stack_cache& get_local_cache()
+        {
+            static thread_local local_stack_cache cache;
+            return cache;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void configure_stack_pool(stack_pool_parameters const& params) noexcept
+    {
+        get_global_pool().params = params;
+    }
+
+    void* stack_pool_allocate(std::size_t size)
+    {
+        std::size_t const size_class = get_size_class(size, true);
+        if (size_class == invalid_size_class)
+        {
+            return map_stack(size);
+        }
+        return get_local_cache().allocate(size_class, size);
+    }
+
+    void stack_pool_deallocate(void* stack, std::size_t size) noexcept
+    {
+        std::size_t const size_class = get_size_class(size, false);
+        if (size_class == invalid_size_class)
+        {
+            unmap_stack(stack, size);
+            return;
+        }
+        get_local_cache().deallocate(size_class, stack);
+    }
+
+    bool stack_pool_keep_committed(void* stack, std::size_t size) noexcept
+    {
+        if (get_size_class(size, false) == invalid_size_class)
+        {
+            return false;
+        }
+        return get_local_cache().keep_committed(stack);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        using thread_counter_type =
+            std::atomic<std::int64_t> thread_counters::*;
+        using retired_counter_type = std::int64_t global_stack_pool::*;
+
+        // a concurrent increment may be lost if the counters are reset
+        std::int64_t sum_counters(thread_counter_type counter,
+            retired_counter_type retired, bool reset) noexcept
+        {
+            global_stack_pool& pool = get_global_pool();
+            std::lock_guard<std::mutex> l(pool.counters_mtx);
+
+            std::int64_t result = pool.*retired;
+            for (thread_counters* c : pool.counters)
+            {
+                result += util::get_and_reset_value(c->*counter, reset);
+            }
+            if (reset)
+            {
+                pool.*retired = 0;
+            }
+            return result;
+        }
+    }    // namespace
+
+    std::int64_t get_stack_pool_hit_count(bool reset) noexcept
+    {
+        return sum_counters(
+            &thread_counters::hits, &global_stack_pool::retired_hits, reset);
+    }
+
+    std::int64_t get_stack_pool_miss_count(bool reset) noexcept
+    {
+        return sum_counters(&thread_counters::misses,
+            &global_stack_pool::retired_misses, reset);
+    }
+
+    std::int64_t get_stack_pool_hit_rate(bool) noexcept
+    {
+        std::int64_t const hits = get_stack_pool_hit_count(false);
+        std::int64_t const misses = get_stack_pool_miss_count(false);
+        if (hits + misses == 0)
+            return 0;
+        return (hits * 10000) / (hits + misses);
+    }
+
+    std::int64_t get_stack_pool_resident_bytes(bool) noexcept
+    {
+        global_stack_pool& pool = get_global_pool();
+
+        // ask the OS which pages of the arenas are currently resident, in
+        // chunks of at most max_pages pages at a time
+        constexpr std::size_t max_pages = 4096;
+#if defined(__FreeBSD__)
+        char pages[max_pages];
+#else
+        unsigned char pages[max_pages];
+#endif
+
+        std::int64_t resident = 0;
+
+        std::lock_guard<std::mutex> l(pool.arenas_mtx);
+        for (auto const& [arena, len] : pool.arenas)
+        {
+            char* base = static_cast<char*>(arena);
+            std::size_t const num_pages = len / EXEC_PAGESIZE;
+            for (std::size_t first = 0; first < num_pages; first += max_pages)
+            {
+                std::size_t const n =
+                    (std::min) (num_pages - first, max_pages);
+                if (::mincore(base + first * EXEC_PAGESIZE, n * EXEC_PAGESIZE,
+                        pages) != 0)
+                {
+                    continue;
+                }
+
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    if (pages[i] & 1)
+                    {
+                        resident += EXEC_PAGESIZE;
+                    }
+                }
+            }
+        }
+        return resident;
+    }
+}    // namespace hpx::threads::coroutines::detail::posix
+
+#endif
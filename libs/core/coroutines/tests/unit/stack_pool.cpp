@@ -0,0 +1,152 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/config/defines.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+constexpr std::size_t batch_size = 4;
+constexpr std::size_t watermark = 8;
+
+std::size_t stack_size()
+{
+    return 16 * EXEC_PAGESIZE;
+}
+
+void touch_stack(void* stack)
+{
+    std::memset(stack, 0xcd, stack_size());
+}
+
+void test_reuse()
+{
+    std::int64_t const misses = posix::get_stack_pool_miss_count(false);
+
+    void* stack = posix::alloc_stack(stack_size());
+    HPX_TEST(stack != nullptr);
+    touch_stack(stack);
+
+    // the first allocation maps a new arena
+    HPX_TEST_EQ(posix::get_stack_pool_miss_count(false), misses + 1);
+
+    // freed stacks are handed out again by the same thread
+    posix::free_stack(stack, stack_size());
+    void* stack2 = posix::alloc_stack(stack_size());
+    HPX_TEST_EQ(stack, stack2);
+    HPX_TEST_EQ(posix::get_stack_pool_miss_count(false), misses + 1);
+
+    posix::free_stack(stack2, stack_size());
+}
+
+void test_batches()
+{
+    std::int64_t const misses = posix::get_stack_pool_miss_count(false);
+
+    std::vector<void*> stacks;
+    std::set<void*> unique;
+    for (std::size_t i = 0; i != 4 * watermark; ++i)
+    {
+        void* stack = posix::alloc_stack(stack_size());
+        touch_stack(stack);
+        stacks.push_back(stack);
+        unique.insert(stack);
+    }
+    HPX_TEST_EQ(unique.size(), stacks.size());
+
+    // all stacks are carved from arenas of batch_size stacks each
+    HPX_TEST_LTE(posix::get_stack_pool_miss_count(false) - misses,
+        static_cast<std::int64_t>(4 * watermark / batch_size));
+
+    std::int64_t const resident = posix::get_stack_pool_resident_bytes(false);
+    for (void* stack : stacks)
+    {
+        posix::free_stack(stack, stack_size());
+    }
+
+    // stacks beyond the watermark have been released to the OS
+    HPX_TEST_LT(posix::get_stack_pool_resident_bytes(false), resident);
+
+    // other threads pick up the released stacks before mapping new ones, the
+    // counts of exited threads are retained
+    std::int64_t const hits_before = posix::get_stack_pool_hit_count(false);
+    std::int64_t const misses_before = posix::get_stack_pool_miss_count(false);
+    std::thread([]() {
+        void* stack = posix::alloc_stack(stack_size());
+        touch_stack(stack);
+        posix::free_stack(stack, stack_size());
+    }).join();
+    HPX_TEST_EQ(posix::get_stack_pool_miss_count(false), misses_before);
+    HPX_TEST_EQ(posix::get_stack_pool_hit_count(false), hits_before + 1);
+
+    HPX_TEST_LTE(posix::get_stack_pool_hit_rate(false), 10000);
+}
+
+void test_keep_committed()
+{
+    // run on a new thread, which has not kept any recycled stacks committed
+    std::thread([]() {
+        std::vector<void*> stacks;
+        for (std::size_t i = 0; i != watermark + 1; ++i)
+        {
+            void* stack = posix::alloc_stack(stack_size());
+            posix::watermark_stack(stack, stack_size());
+            touch_stack(stack);
+            stacks.push_back(stack);
+        }
+
+        // up to watermark recycled stacks stay committed, the stacks beyond
+        // that are decommitted
+        for (std::size_t i = 0; i != watermark; ++i)
+        {
+            HPX_TEST(!posix::reset_stack(stacks[i], stack_size()));
+        }
+        HPX_TEST(posix::reset_stack(stacks[watermark], stack_size()));
+
+        // a stack kept committed before stays committed when it is recycled
+        // again
+        touch_stack(stacks[0]);
+        HPX_TEST(!posix::reset_stack(stacks[0], stack_size()));
+
+        for (void* stack : stacks)
+        {
+            posix::free_stack(stack, stack_size());
+        }
+    }).join();
+}
+
+int main()
+{
+    posix::stack_pool_parameters params;
+    params.batch_size = batch_size;
+    params.watermark = watermark;
+    posix::configure_stack_pool(params);
+    posix::use_stack_pool = true;
+
+    test_reuse();
+    test_batches();
+    test_keep_committed();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
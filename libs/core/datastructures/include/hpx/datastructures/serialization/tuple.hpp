@@ -14,9 +14,11 @@
 #include <hpx/modules/type_support.hpp>
 #include <hpx/serialization/detail/non_default_constructible.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/serialization/detail/serialize_bitwise.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_trivially_measurable.hpp>
 
 #include <cstddef>
 #include <memory>
@@ -38,6 +40,12 @@ namespace hpx::traits {
             !is_bitwise_serializable_v<::hpx::tuple<Ts...>>>
     {
     };
+
+    template <typename... Ts>
+    struct is_trivially_measurable<::hpx::tuple<Ts...>>
+      : ::hpx::util::all_of<hpx::traits::is_trivially_measurable<Ts>...>
+    {
+    };
 }    // namespace hpx::traits
 
 namespace hpx::util::detail {
@@ -67,6 +75,12 @@ namespace hpx::util::detail {
                 ...);
 #endif
         }
+
+        static bool call_bitwise(Archive& ar, hpx::tuple<Ts...>& t)
+        {
+            return hpx::serialization::detail::serialize_bitwise(
+                ar, t, hpx::get<Is>(t)...);
+        }
     };
 
     template <typename Archive, std::size_t... Is, typename... Ts>
@@ -144,6 +158,20 @@ namespace hpx::serialization {
     void serialize(Archive& ar, hpx::tuple<Ts...>& t, unsigned int version)
     {
         using Is = hpx::util::make_index_pack_t<sizeof...(Ts)>;
+
+        // copy tuples of bitwise serializable values bitwise
+        constexpr bool optimized =
+            (serialization::detail::is_bitwise_element_v<Ts> && ...);
+
+        if constexpr (optimized)
+        {
+            if (hpx::util::detail::serialize_with_index_pack<Archive, Is,
+                    Ts...>::call_bitwise(ar, t))
+            {
+                return;
+            }
+        }
+
         hpx::util::detail::serialize_with_index_pack<Archive, Is, Ts...>::call(
             ar, t, version);
     }
@@ -31,12 +31,14 @@
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/modules/topology.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/synchronization/event.hpp>
 #include <hpx/synchronization/latch.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -67,6 +69,12 @@ namespace hpx::execution::experimental {
     /// worker threads is a slow operation the executor should be reused
     /// whenever possible for multiple adjacent parallel algorithms or
     /// invocations of bulk_(a)sync_execute.
+    ///
+    /// With idle_policy::adaptive the executor instead learns the typical
+    /// time between parallel regions and lets idle worker threads spin only
+    /// if the next region is expected soon. Worker threads that stay idle
+    /// for longer are suspended until the next region starts, which frees
+    /// their cores for other work at the cost of a higher wake-up latency.
     class fork_join_executor
     {
     public:
@@ -80,6 +88,17 @@ namespace hpx::execution::experimental {
             dynamic,
         };
 
+        /// Policy used by the worker threads of the fork_join_executor while
+        /// waiting for the next parallel region. idle_policy::fixed spins and
+        /// yields to other work every yield_delay; idle_policy::adaptive
+        /// chooses between spinning, yielding, and suspending the worker
+        /// threads based on the observed time between parallel regions.
+        enum class idle_policy : std::uint8_t
+        {
+            fixed,
+            adaptive,
+        };
+
         /// \cond NOINTERNAL
         using execution_category = hpx::execution::parallel_execution_tag;
         using executor_parameters_type =
@@ -128,6 +147,11 @@ namespace hpx::execution::experimental {
                 void* argument_pack_;
                 void* results_;
                 hpx::latch* sync_with_main_thread_;
+
+                // Used to wake up the thread if it was suspended while waiting
+                // for the next parallel region (idle_policy::adaptive only).
+                std::atomic<bool> parked_ = false;
+                hpx::lcos::local::event wakeup_;
             };
 
             // Can't apply 'using' here as the type needs to be forward
@@ -148,8 +172,14 @@ namespace hpx::execution::experimental {
             threads::thread_stacksize stacksize_ =
                 threads::thread_stacksize::small_;
             loop_schedule schedule_ = loop_schedule::static_;
+            idle_policy idle_policy_ = idle_policy::fixed;
             std::uint64_t yield_delay_;
 
+            // Moving average of the time between parallel regions and the
+            // end of the last region (idle_policy::adaptive only).
+            std::atomic<std::uint64_t> average_gap_;
+            std::uint64_t last_region_end_ = 0;
+
             std::size_t main_thread_;
             std::size_t num_threads_;
             hpx::threads::mask_type pu_mask_;
@@ -217,6 +247,127 @@ namespace hpx::execution::experimental {
                 return current;
             }
 
+            // Idle worker threads are suspended if no new parallel region
+            // has started after this multiple of the yield delay.
+            static constexpr std::uint64_t park_delay_factor = 10;
+
+            // Wait for the next parallel region, adapting to the expected
+            // time between parallel regions: spin only if the next region is
+            // expected to start soon, yield to other work for a while, and
+            // finally suspend the thread until it is woken up by
+            // wake_up_parked.
+            static thread_state wait_for_work_adaptive(region_data& data,
+                std::uint64_t const yield_delay,
+                std::uint64_t const expected_gap)
+            {
+                auto current = data.state_.load(std::memory_order_acquire);
+                if (HPX_LIKELY(current != thread_state::idle))
+                {
+                    return current;
+                }
+
+                auto const context = hpx::execution_base::this_thread::agent();
+
+                // If regions are rare, suspending early costs little compared
+                // to the time between regions.
+                std::uint64_t const park_delay =
+                    park_delay_factor * yield_delay;
+                std::uint64_t const spin_limit =
+                    (std::min) (2 * expected_gap, yield_delay);
+                std::uint64_t const park_limit =
+                    expected_gap > park_delay ? yield_delay : park_delay;
+
+                std::uint64_t const base_time = util::hardware::timestamp();
+                while (HPX_LIKELY(current == thread_state::idle))
+                {
+                    std::uint64_t const elapsed =
+                        util::hardware::timestamp() - base_time;
+                    if (elapsed < spin_limit)
+                    {
+                        for (int i = 0; i < 256; ++i)
+                        {
+                            HPX_SMT_PAUSE;
+
+                            // Use atomic acquire only after atomic relaxed
+                            // suggests that we should stop iterating.
+                            if (HPX_UNLIKELY(data.state_.load(
+                                                 std::memory_order_relaxed) !=
+                                    thread_state::idle))
+                            {
+                                break;
+                            }
+                        }
+                    }
+                    else if (elapsed < park_limit)
+                    {
+                        context.yield();
+                    }
+                    else
+                    {
+                        data.wakeup_.reset();
+                        data.parked_.store(true, std::memory_order_relaxed);
+
+                        // pairs with the fence in wake_up_parked: either the
+                        // new state is visible here or the waking thread sees
+                        // that this thread is parked
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        if (data.state_.load(std::memory_order_relaxed) ==
+                            thread_state::idle)
+                        {
+                            data.wakeup_.wait();
+                        }
+
+                        data.parked_.store(false, std::memory_order_relaxed);
+                    }
+
+                    current = data.state_.load(std::memory_order_acquire);
+                }
+                return current;
+            }
+
+            void wake_up_parked(region_data& data) const
+            {
+                if (idle_policy_ != idle_policy::adaptive)
+                {
+                    return;
+                }
+
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (data.parked_.load(std::memory_order_relaxed))
+                {
+                    data.wakeup_.set();
+                }
+            }
+
+            // Update the moving average of the time between parallel regions
+            // with the time since the end of the last region.
+            void begin_region() noexcept
+            {
+                if (idle_policy_ != idle_policy::adaptive ||
+                    last_region_end_ == 0)
+                {
+                    return;
+                }
+
+                std::uint64_t const now = util::hardware::timestamp();
+                std::uint64_t const gap =
+                    now > last_region_end_ ? now - last_region_end_ : 0;
+
+                // the most recent gap is weighted by 1/8
+                std::uint64_t const average =
+                    average_gap_.load(std::memory_order_relaxed);
+                average_gap_.store(
+                    average - average / 8 + gap / 8, std::memory_order_relaxed);
+            }
+
+            void end_region() noexcept
+            {
+                if (idle_policy_ == idle_policy::adaptive)
+                {
+                    last_region_end_ = util::hardware::timestamp();
+                }
+            }
+
             std::string generate_annotation(
                 std::size_t const index, char const* default_name) const
             {
@@ -247,6 +398,8 @@ namespace hpx::execution::experimental {
                 hpx::spinlock& exception_mutex_;
                 std::exception_ptr& exception_;
                 std::uint64_t yield_delay_;
+                idle_policy const idle_policy_;
+                std::atomic<std::uint64_t> const& average_gap_;
 
                 // Changing data for each parallel region.
                 region_data_type& region_data_;
@@ -267,6 +420,20 @@ namespace hpx::execution::experimental {
                     return data.state_.load(std::memory_order_relaxed);
                 }
 
+                // wait as long the state is 'idle'
+                thread_state wait_for_work(region_data& data) const
+                {
+                    if (idle_policy_ == idle_policy::adaptive)
+                    {
+                        return shared_data::wait_for_work_adaptive(data,
+                            yield_delay_,
+                            average_gap_.load(std::memory_order_relaxed));
+                    }
+                    return shared_data::wait_state_this_thread_while(
+                        data.state_, thread_state::idle, yield_delay_,
+                        std::equal_to<>());
+                }
+
                 void operator()() const noexcept
                 {
                     region_data& data = region_data_[thread_index_].data_;
@@ -275,10 +442,7 @@ namespace hpx::execution::experimental {
                         get_state_this_thread(data) == thread_state::starting);
                     set_state_this_thread(data, thread_state::idle);
 
-                    // wait as long the state is 'idle'
-                    auto state = shared_data::wait_state_this_thread_while(
-                        data.state_, thread_state::idle, yield_delay_,
-                        std::equal_to<>());
+                    auto state = wait_for_work(data);
 
                     HPX_ASSERT(!priority_bound_ ||
                         thread_index_ == hpx::get_worker_thread_num());
@@ -296,10 +460,7 @@ namespace hpx::execution::experimental {
                                 exception_mutex_, exception_);
                         }
 
-                        // wait as long the state is 'idle'
-                        state = shared_data::wait_state_this_thread_while(
-                            data.state_, thread_state::idle, yield_delay_,
-                            std::equal_to<>());
+                        state = wait_for_work(data);
 
                         HPX_ASSERT(!priority_bound_ ||
                             thread_index_ == hpx::get_worker_thread_num());
@@ -323,6 +484,7 @@ namespace hpx::execution::experimental {
                 {
                     region_data_[t].data_.state_.store(
                         state, std::memory_order_release);
+                    wake_up_parked(region_data_[t].data_);
                     HPX_SMT_PAUSE;
                 }
             }
@@ -495,6 +657,8 @@ namespace hpx::execution::experimental {
                                 .exception_mutex_ = exception_mutex_,
                                 .exception_ = exception_,
                                 .yield_delay_ = yield_delay_,
+                                .idle_policy_ = idle_policy_,
+                                .average_gap_ = average_gap_,
                                 .region_data_ = region_data_,
                                 .queues_ = queues_,
                                 .priority_bound_ = priority_bound});
@@ -553,14 +717,17 @@ namespace hpx::execution::experimental {
             explicit shared_data(threads::thread_priority const priority,
                 threads::thread_stacksize const stacksize,
                 loop_schedule const sched,
-                std::chrono::nanoseconds const yield_delay)
+                std::chrono::nanoseconds const yield_delay,
+                idle_policy const policy)
               : pool_(threads::detail::get_self_or_default_pool())
               , priority_(priority)
               , stacksize_(stacksize)
               , schedule_(sched)
+              , idle_policy_(policy)
               , yield_delay_(static_cast<std::uint64_t>(
                     static_cast<double>(yield_delay.count()) /
                     pool_->timestamp_scale()))
+              , average_gap_(yield_delay_)
               , num_threads_(pool_->get_os_thread_count())
               , pu_mask_(full_mask(num_threads_))
               , region_data_(get_region_data_size(num_threads_, pool_))
@@ -574,14 +741,17 @@ namespace hpx::execution::experimental {
                 threads::thread_stacksize const stacksize,
                 loop_schedule const sched,
                 std::chrono::nanoseconds const yield_delay,
+                idle_policy const policy,
                 hpx::threads::mask_cref_type pu_mask)
               : pool_(threads::detail::get_self_or_default_pool())
               , priority_(priority)
               , stacksize_(stacksize)
               , schedule_(sched)
+              , idle_policy_(policy)
               , yield_delay_(static_cast<std::uint64_t>(
                     static_cast<double>(yield_delay.count()) /
                     pool_->timestamp_scale()))
+              , average_gap_(yield_delay_)
               , num_threads_(hpx::threads::count(pu_mask))
               , pu_mask_(pu_mask)
               , region_data_(get_region_data_size(num_threads_, pool_))
@@ -626,6 +796,7 @@ namespace hpx::execution::experimental {
                 return pool_ == rhs.pool_ && priority_ == rhs.priority_ &&
                     stacksize_ == rhs.stacksize_ &&
                     schedule_ == rhs.schedule_ &&
+                    idle_policy_ == rhs.idle_policy_ &&
                     yield_delay_ == rhs.yield_delay_ &&
                     pu_mask_ == rhs.pu_mask_;
             }
@@ -926,6 +1097,7 @@ namespace hpx::execution::experimental {
                     // NOLINTEND(bugprone-multi-level-implicit-pointer-conversion)
 
                     data.state_.store(state, std::memory_order_release);
+                    wake_up_parked(data);
                 }
                 return func;
             }
@@ -958,6 +1130,7 @@ namespace hpx::execution::experimental {
                         // NOLINTEND(bugprone-multi-level-implicit-pointer-conversion)
 
                         data.state_.store(state, std::memory_order_release);
+                        wake_up_parked(data);
                         return t;
                     }
                 }
@@ -1003,6 +1176,10 @@ namespace hpx::execution::experimental {
 #endif
                 exception_ = std::exception_ptr();
 
+                begin_region();
+                auto on_exit_region =
+                    hpx::experimental::scope_exit([this] { end_region(); });
+
                 // Set the data for this parallel region
                 auto argument_pack =
                     hpx::forward_as_tuple(HPX_FORWARD(Ts, ts)...);
@@ -1121,6 +1298,10 @@ namespace hpx::execution::experimental {
 #endif
                 exception_ = std::exception_ptr();
 
+                begin_region();
+                auto on_exit_region =
+                    hpx::experimental::scope_exit([this] { end_region(); });
+
                 auto args = hpx::make_tuple(first, size);
 
                 // do things differently if the main thread is not participating
@@ -1290,13 +1471,16 @@ namespace hpx::execution::experimental {
         /// \param sched     The loop schedule of the parallel regions.
         /// \param yield_delay The time after which the executor yields to other
         ///        work if it has not received any new work for execution.
+        /// \param policy    The policy used by idle worker threads while
+        ///                  waiting for the next parallel region.
         explicit fork_join_executor(
             threads::thread_priority priority = threads::thread_priority::bound,
             threads::thread_stacksize stacksize =
                 threads::thread_stacksize::small_,
             loop_schedule sched = loop_schedule::dynamic,
             std::chrono::nanoseconds yield_delay = std::chrono::microseconds(
-                300))
+                300),
+            idle_policy policy = idle_policy::fixed)
         {
             if (stacksize == threads::thread_stacksize::nostack)
             {
@@ -1308,7 +1492,7 @@ namespace hpx::execution::experimental {
             }
 
             shared_data_ = std::make_shared<shared_data>(
-                priority, stacksize, sched, yield_delay);
+                priority, stacksize, sched, yield_delay, policy);
         }
 
         /// \brief Construct a fork_join_executor.
@@ -1320,13 +1504,16 @@ namespace hpx::execution::experimental {
         /// \param sched     The loop schedule of the parallel regions.
         /// \param yield_delay The time after which the executor yields to other
         ///        work if it has not received any new work for execution.
+        /// \param policy    The policy used by idle worker threads while
+        ///                  waiting for the next parallel region.
         explicit fork_join_executor(hpx::threads::mask_cref_type pu_mask,
             threads::thread_priority priority = threads::thread_priority::bound,
             threads::thread_stacksize stacksize =
                 threads::thread_stacksize::small_,
             loop_schedule sched = loop_schedule::dynamic,
             std::chrono::nanoseconds yield_delay = std::chrono::microseconds(
-                300))
+                300),
+            idle_policy policy = idle_policy::fixed)
         {
             if (stacksize == threads::thread_stacksize::nostack)
             {
@@ -1338,7 +1525,7 @@ namespace hpx::execution::experimental {
             }
 
             shared_data_ = std::make_shared<shared_data>(
-                priority, stacksize, sched, yield_delay, pu_mask);
+                priority, stacksize, sched, yield_delay, policy, pu_mask);
         }
 
         friend fork_join_executor tag_invoke(
@@ -1393,6 +1580,9 @@ namespace hpx::execution::experimental {
     HPX_CORE_EXPORT std::ostream& operator<<(
         std::ostream& os, fork_join_executor::loop_schedule schedule);
 
+    HPX_CORE_EXPORT std::ostream& operator<<(
+        std::ostream& os, fork_join_executor::idle_policy policy);
+
     /// \cond NOINTERNAL
     template <>
     struct is_bulk_one_way_executor<fork_join_executor> : std::true_type
@@ -34,4 +34,29 @@ namespace hpx::execution::experimental {
 
         return os;
     }
+
+    std::ostream& operator<<(
+        std::ostream& os, fork_join_executor::idle_policy policy)
+    {
+        switch (policy)
+        {
+        case fork_join_executor::idle_policy::fixed:
+            os << "fixed";
+            break;
+        case fork_join_executor::idle_policy::adaptive:
+            os << "adaptive";
+            break;
+        default:
+            os << "<unknown>";
+            break;
+        }
+
+        os << " ("
+           << static_cast<
+                  std::underlying_type_t<fork_join_executor::idle_policy>>(
+                  policy)
+           << ")";
+
+        return os;
+    }
 }    // namespace hpx::execution::experimental
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdlib>
 #include <iostream>
@@ -103,6 +104,27 @@ void test_bulk_async(ExecutorArgs&&... args)
     HPX_TEST_EQ(count1.load(), 2 * n);
 }
 
+// Leave the executor idle between parallel regions for long enough for its
+// worker threads to be suspended (with idle_policy::adaptive).
+template <typename... ExecutorArgs>
+void test_bulk_sync_idle(ExecutorArgs&&... args)
+{
+    std::cerr << "test_bulk_sync_idle\n";
+
+    count1 = 0;
+    constexpr std::size_t n = 107;
+    std::vector<int> v(n);
+    std::iota(std::begin(v), std::end(v), std::rand());
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(i % 2 ? 1 : 10));
+        hpx::parallel::execution::bulk_sync_execute(exec, &bulk_test, v, 42);
+        HPX_TEST_EQ(count1.load(), (i + 1) * n);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int bulk_test_with_result(int val, int passed_through)    //-V813
 {
@@ -445,30 +467,47 @@ void static_check_executor()
         "is_bulk_two_way_executor_v<fork_join_executor>");
 }
 
-template <typename... ExecutorArgs>
 void test_executor(hpx::threads::thread_priority priority,
     hpx::threads::thread_stacksize stacksize,
-    fork_join_executor::loop_schedule schedule)
+    fork_join_executor::loop_schedule schedule,
+    fork_join_executor::idle_policy policy)
 {
     std::cerr << "testing fork_join_executor with priority = " << priority
               << ", stacksize = " << stacksize << ", schedule = " << schedule
-              << "\n";
-    test_bulk_sync(priority, stacksize, schedule);
-    test_bulk_async(priority, stacksize, schedule);
-    test_bulk_sync_exception(priority, stacksize, schedule);
-    test_bulk_async_exception(priority, stacksize, schedule);
-
-    test_bulk_sync_with_result(priority, stacksize, schedule);
-    test_bulk_async_with_result(priority, stacksize, schedule);
-    test_bulk_sync_exception_with_result(priority, stacksize, schedule);
-    test_bulk_async_exception_with_result(priority, stacksize, schedule);
-
-    test_invoke_sync_homogeneous(priority, stacksize, schedule);
-    test_invoke_sync(priority, stacksize, schedule);
-    test_invoke_sync_homogeneous_exception(priority, stacksize, schedule);
-    test_invoke_sync_exception(priority, stacksize, schedule);
-
-    test_processing_mask(priority, stacksize, schedule);
+              << ", idle policy = " << policy << "\n";
+
+    std::chrono::nanoseconds const yield_delay = std::chrono::microseconds(300);
+
+    test_bulk_sync(priority, stacksize, schedule, yield_delay, policy);
+    test_bulk_async(priority, stacksize, schedule, yield_delay, policy);
+    test_bulk_sync_exception(
+        priority, stacksize, schedule, yield_delay, policy);
+    test_bulk_async_exception(
+        priority, stacksize, schedule, yield_delay, policy);
+
+    test_bulk_sync_with_result(
+        priority, stacksize, schedule, yield_delay, policy);
+    test_bulk_async_with_result(
+        priority, stacksize, schedule, yield_delay, policy);
+    test_bulk_sync_exception_with_result(
+        priority, stacksize, schedule, yield_delay, policy);
+    test_bulk_async_exception_with_result(
+        priority, stacksize, schedule, yield_delay, policy);
+
+    test_invoke_sync_homogeneous(
+        priority, stacksize, schedule, yield_delay, policy);
+    test_invoke_sync(priority, stacksize, schedule, yield_delay, policy);
+    test_invoke_sync_homogeneous_exception(
+        priority, stacksize, schedule, yield_delay, policy);
+    test_invoke_sync_exception(
+        priority, stacksize, schedule, yield_delay, policy);
+
+    test_processing_mask(priority, stacksize, schedule, yield_delay, policy);
+
+    // use a short yield delay to make sure the worker threads are suspended
+    // between the parallel regions
+    test_bulk_sync_idle(priority, stacksize, schedule,
+        std::chrono::microseconds(10), policy);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -496,8 +535,12 @@ int hpx_main()
                      fork_join_executor::loop_schedule::dynamic,
                  })
             {
+                for (auto const policy : {
+                         fork_join_executor::idle_policy::fixed,
+                         fork_join_executor::idle_policy::adaptive,
+                     })
                 {
-                    test_executor(priority, stacksize, schedule);
+                    test_executor(priority, stacksize, schedule, policy);
                 }
             }
         }
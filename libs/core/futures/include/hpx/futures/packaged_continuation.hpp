@@ -299,6 +299,38 @@ namespace hpx::lcos::detail {
                 });
         }
 
+    private:
+        // The completion handler attached to the future this continuation
+        // depends on. It holds nothing but the references to the continuation
+        // (which owns the continuation function) and to the shared state of
+        // the predecessor, which allows for it to be stored in the small
+        // buffer of the type-erased callback. As the first completion handler
+        // is stored inline in the predecessor's shared state, attaching a
+        // continuation does not allocate any memory beyond the continuation
+        // itself (as long as the spawner is stateless). The spawner is handed
+        // on with the value category it was attached with.
+        template <bool Unwrap, typename Spawner>
+        struct on_completed_handler
+        {
+            hpx::intrusive_ptr<continuation> this_;
+            traits::detail::shared_state_ptr_for_t<Future> state;
+            bool run_async;
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Spawner> spawner;
+
+            void operator()()
+            {
+                if (run_async)
+                {
+                    this_->template async<Unwrap>(
+                        HPX_MOVE(state), HPX_FORWARD(Spawner, spawner));
+                }
+                else
+                {
+                    this_->template run<Unwrap>(HPX_MOVE(state));
+                }
+            }
+        };
+
     public:
         ///////////////////////////////////////////////////////////////////////
         template <bool Unwrap, typename Spawner, typename Future_,
@@ -325,19 +357,10 @@ namespace hpx::lcos::detail {
 
             ptr->execute_deferred();
             ptr->set_on_completed(
-                [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
-                    policy = HPX_FORWARD(Policy, policy),
-                    spawner = HPX_FORWARD(Spawner, spawner)]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
-                    {
-                        this_->template async<Unwrap>(
-                            HPX_MOVE(state), HPX_FORWARD(Spawner, spawner));
-                    }
-                    else
-                    {
-                        this_->template run<Unwrap>(HPX_MOVE(state));
-                    }
-                });
+                on_completed_handler<Unwrap, Spawner>{
+                    HPX_MOVE(this_), HPX_MOVE(state),
+                    hpx::detail::has_async_policy(policy),
+                    HPX_FORWARD(Spawner, spawner)});
         }
 
     protected:
@@ -0,0 +1,89 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Attaching a continuation to a future should not require to allocate memory
+// for the completion handler in addition to the shared state of the
+// continuation.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> num_allocations(0);
+
+void* operator new(std::size_t size)
+{
+    ++num_allocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr int chain_length = 100;
+
+// returns the number of allocations needed for attaching and running the
+// continuations, this excludes the shared state of the promise
+template <typename Policy>
+std::size_t run_chain(Policy policy)
+{
+    hpx::promise<int> p;
+    hpx::future<int> f = p.get_future();
+
+    std::size_t const before = num_allocations.load();
+    for (int i = 0; i != chain_length; ++i)
+    {
+        f = f.then(policy, [](hpx::future<int>&& f) { return f.get() + 1; });
+    }
+
+    p.set_value(0);
+    HPX_TEST_EQ(f.get(), chain_length);
+
+    return num_allocations.load() - before;
+}
+
+template <typename Policy>
+void test_then_allocations(Policy policy)
+{
+    // the shared states of the continuations are allocated from a thread
+    // local cache, warm it up first
+    run_chain(policy);
+
+    // the shared states of the continuations are served from the cache and
+    // the completion handlers are stored inline in the shared states of their
+    // predecessors, thus no allocation is needed at all (before, each
+    // continuation caused at least one allocation)
+    HPX_TEST_EQ(run_chain(policy), std::size_t(0));
+}
+
+int hpx_main()
+{
+    test_then_allocations(hpx::launch::sync);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -92,6 +92,16 @@ namespace hpx {
             HPX_CORE_EXPORT hpx::program_options::options_description const&
             default_desc(char const*);
 
+            // Apply the [hpx.stacks] settings related to the pooled stack
+            // allocator, does nothing if the pool is not available
+            HPX_CORE_EXPORT void configure_stack_pool(
+                hpx::util::runtime_configuration const& cfg);
+
+            // Select the service used for timed thread suspension and apply
+            // the resolution of the timer wheel
+            HPX_CORE_EXPORT void configure_timer_wheel(
+                hpx::util::runtime_configuration const& cfg);
+
             // Utilities to init the thread_pools of the resource partitioner
             using rp_callback_type =
                 hpx::function<void(hpx::resource::partitioner&,
@@ -10,6 +10,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/command_line_handling_local/command_line_handling_local.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/functional/bind_front.hpp>
@@ -43,11 +44,14 @@
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/set_thread_state_timed.hpp>
+#include <hpx/topology/topology.hpp>
 
 #if defined(HPX_NATIVE_MIC) || defined(__bgq__)
 #include <cstdlib>
 #endif
 
+#include <chrono>
 #include <cstddef>
 #include <exception>
 #include <functional>
@@ -233,6 +237,45 @@ namespace hpx {
         ///////////////////////////////////////////////////////////////////////////
         namespace detail {
 
+            ///////////////////////////////////////////////////////////////////////
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+            // bind a newly mapped stack arena to the NUMA domain(s) the
+            // calling worker thread is running on
+            static void bind_stack_arena(void* addr, std::size_t len)
+            {
+                static threads::topology const& topo =
+                    threads::create_topology();
+                threads::hwloc_bitmap_ptr const nodeset =
+                    topo.cpuset_to_nodeset(topo.get_cpubind_mask());
+                topo.set_area_membind_nodeset(addr, len, nodeset->get_bmp());
+            }
+#endif
+
+            void configure_stack_pool(
+                [[maybe_unused]] hpx::util::runtime_configuration const& cfg)
+            {
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+                namespace posix = threads::coroutines::detail::posix;
+
+                posix::stack_pool_parameters params;
+                params.batch_size = cfg.get_stack_pool_batch_size();
+                params.watermark = cfg.get_stack_pool_watermark();
+                params.bind_arena = &bind_stack_arena;
+
+                posix::configure_stack_pool(params);
+                posix::use_stack_pool = cfg.use_stack_pool();
+#endif
+            }
+
+            void configure_timer_wheel(
+                hpx::util::runtime_configuration const& cfg)
+            {
+                threads::detail::set_timer_wheel_resolution(
+                    std::chrono::microseconds(
+                        cfg.get_timer_wheel_resolution()));
+                threads::detail::use_timer_wheel = cfg.use_timer_wheel();
+            }
+
             ///////////////////////////////////////////////////////////////////////
             void activate_global_options(
                 local::detail::command_line_handling& cmdline)
@@ -242,6 +285,8 @@ namespace hpx {
                 threads::coroutines::detail::posix::use_guard_pages =
                     cmdline.rtcfg_.use_stack_guard_pages();
 #endif
+                configure_stack_pool(cmdline.rtcfg_);
+                configure_timer_wheel(cmdline.rtcfg_);
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
                 {
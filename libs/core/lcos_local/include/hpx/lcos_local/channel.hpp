@@ -9,8 +9,11 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/datastructures/optional.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/packaged_task.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/iterator_support/iterator_facade.hpp>
 #include <hpx/lcos_local/receive_buffer.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
@@ -21,7 +24,10 @@
 #include <hpx/synchronization/no_mutex.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <iterator>
@@ -30,6 +36,19 @@
 
 namespace hpx::lcos::local {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Tags selecting the implementation of the channel with unlimited buffer.
+    // The default, locked_channel_policy, protects the buffer with a spinlock
+    // and supports explicit generations. The lockfree_channel_policy avoids
+    // locking on the common path but does not support explicit generations.
+    struct locked_channel_policy
+    {
+    };
+
+    struct lockfree_channel_policy
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
 
@@ -248,6 +267,436 @@ namespace hpx::lcos::local {
             bool closed_;
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Unlimited channel which does not acquire a lock on its common path.
+        // Every set and every get draws a ticket from its own counter, the
+        // n-th set is paired with the n-th get through the slot with index n.
+        // Whichever side arrives at the slot first leaves its value (set) or
+        // a promise (get) behind, the other side completes the exchange. A
+        // get has to wait only if the channel is empty, i.e. if the matching
+        // set has not happened yet. Explicit generations are not supported.
+        //
+        // The slots are stored in a list of segments. A segment is retired
+        // once all of its slots have been used by both sides. Retired
+        // segments are reused by the same channel and are released only when
+        // the channel is destroyed, this guarantees that a stale pointer to a
+        // segment can always be dereferenced. Segments are looked up, linked,
+        // and retired under a spinlock which happens only once every
+        // segment_size operations for each side.
+        template <typename T>
+        class lockfree_unlimited_channel : public channel_impl_base<T>
+        {
+            using mutex_type = hpx::spinlock;
+
+            static constexpr std::size_t segment_size = 32;
+            static constexpr std::size_t closed_bit = ~(~std::size_t(0) >> 1);
+            static constexpr std::size_t invalid_id = std::size_t(-1);
+
+            enum slot_state : std::uint8_t
+            {
+                empty = 0,      // no side has arrived yet
+                full = 1,       // the value was stored by set
+                waiting = 2,    // a promise was stored by get
+                closed = 3      // the channel was closed, no value will arrive
+            };
+
+            struct slot
+            {
+                std::atomic<std::uint8_t> state{empty};
+
+                // constructed by set only, T does not need to be default
+                // constructible
+                hpx::optional<T> value;
+                hpx::optional<hpx::promise<T>> waiter;
+            };
+
+            struct segment
+            {
+                // index of the first slot divided by segment_size
+                std::atomic<std::size_t> id{invalid_id};
+
+                // number of slots used by both sides
+                std::atomic<std::size_t> used{0};
+
+                segment* next = nullptr;
+                std::array<slot, segment_size> slots;
+            };
+
+        public:
+            HPX_NON_COPYABLE(lockfree_unlimited_channel);
+
+        public:
+            lockfree_unlimited_channel()
+              : head_(0)
+              , tail_(0)
+              , first_(new segment)
+              , last_(first_)
+              , free_(nullptr)
+            {
+                first_->id.store(0, std::memory_order_relaxed);
+                head_segment_.data_.store(first_, std::memory_order_relaxed);
+                tail_segment_.data_.store(first_, std::memory_order_relaxed);
+            }
+
+            ~lockfree_unlimited_channel()
+            {
+                delete_segments(first_);
+                delete_segments(free_);
+            }
+
+        protected:
+            hpx::future<T> get(std::size_t generation, bool blocking)
+            {
+                if (generation != std::size_t(-1))
+                {
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                            "hpx::lcos::local::channel::get",
+                            "this channel does not support explicit "
+                            "generations"));
+                }
+
+                if (blocking && this->use_count() == 1 && is_empty())
+                {
+                    if (is_closed())
+                    {
+                        return closed_and_empty();
+                    }
+
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                            "hpx::lcos::local::channel::get",
+                            "this channel is empty and is not accessible "
+                            "by any other thread causing a deadlock"));
+                }
+
+                // Drawing a ticket and checking for the channel being closed
+                // is ordered with respect to close (which does the opposite)
+                // making sure that all gets not seeing the channel closed will
+                // be canceled by close.
+                std::size_t const ticket = head_.data_.fetch_add(1);
+                std::size_t const tail = tail_.data_.load();
+                if ((tail & closed_bit) != 0 && ticket >= (tail & ~closed_bit))
+                {
+                    return closed_and_empty();
+                }
+
+                return receive(ticket);
+            }
+
+            bool try_get(std::size_t generation, hpx::future<T>* f = nullptr)
+            {
+                if (f == nullptr || generation != std::size_t(-1))
+                {
+                    if (is_closed() && is_empty())
+                    {
+                        return false;
+                    }
+
+                    if (f != nullptr)
+                    {
+                        *f = get(generation, false);
+                    }
+                    return true;
+                }
+
+                // another get may have received the last value in between,
+                // so the check has to be based on the drawn ticket
+                std::size_t const ticket = head_.data_.fetch_add(1);
+                std::size_t const tail = tail_.data_.load();
+                if ((tail & closed_bit) != 0 && ticket >= (tail & ~closed_bit))
+                {
+                    return false;
+                }
+
+                *f = receive(ticket);
+                return true;
+            }
+
+            hpx::future<void> set(std::size_t generation, T&& t)
+            {
+                if (generation != std::size_t(-1))
+                {
+                    return hpx::make_exceptional_future<void>(
+                        HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                            "hpx::lcos::local::channel::set",
+                            "this channel does not support explicit "
+                            "generations"));
+                }
+
+                std::size_t ticket =
+                    tail_.data_.load(std::memory_order_relaxed);
+                do
+                {
+                    if ((ticket & closed_bit) != 0)
+                    {
+                        return hpx::make_exceptional_future<void>(
+                            HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                                "hpx::lcos::local::channel::set",
+                                "attempting to write to a closed channel"));
+                    }
+                } while (
+                    !tail_.data_.compare_exchange_weak(ticket, ticket + 1));
+
+                send(ticket, HPX_MOVE(t));
+                return hpx::make_ready_future();
+            }
+
+            std::size_t close(bool /*force_delete_entries*/ = false)
+            {
+                std::size_t const tail = tail_.data_.fetch_or(closed_bit);
+                if ((tail & closed_bit) != 0)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                        "hpx::lcos::local::channel::close",
+                        "attempting to close an already closed channel");
+                    return 0;
+                }
+
+                std::size_t const head = head_.data_.load();
+                if (head <= tail)
+                {
+                    return 0;
+                }
+
+                // all pending requests that can't be satisfied have to be
+                // canceled at this point
+                std::exception_ptr const e =
+                    HPX_GET_EXCEPTION(hpx::error::future_cancelled,
+                        hpx::throwmode::lightweight, "hpx::lcos::local::close",
+                        "canceled waiting on this entry");
+
+                std::size_t canceled = 0;
+                for (std::size_t ticket = tail; ticket != head; ++ticket)
+                {
+                    segment* seg = find_segment(
+                        head_segment_.data_, ticket / segment_size);
+                    slot& s = seg->slots[ticket % segment_size];
+
+                    std::uint8_t state = empty;
+                    if (!s.state.compare_exchange_strong(state, closed))
+                    {
+                        HPX_ASSERT(state == waiting);
+                        s.waiter->set_exception(e);
+                        release_slot(seg);
+                        ++canceled;
+                    }
+                }
+                return canceled;
+            }
+
+        private:
+            bool is_empty() const noexcept
+            {
+                return head_.data_.load() >=
+                    (tail_.data_.load() & ~closed_bit);
+            }
+
+            bool is_closed() const noexcept
+            {
+                return (tail_.data_.load() & closed_bit) != 0;
+            }
+
+            static hpx::future<T> closed_and_empty()
+            {
+                return hpx::make_exceptional_future<T>(
+                    HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                        "hpx::lcos::local::channel::get",
+                        "this channel is empty and was closed"));
+            }
+
+            hpx::future<T> receive(std::size_t ticket)
+            {
+                segment* seg =
+                    find_segment(head_segment_.data_, ticket / segment_size);
+                slot& s = seg->slots[ticket % segment_size];
+
+                std::uint8_t state = s.state.load(std::memory_order_acquire);
+                if (state == empty)
+                {
+                    // the value has not arrived yet, leave a promise behind
+                    s.waiter.emplace();
+                    hpx::future<T> f = s.waiter->get_future();
+                    if (s.state.compare_exchange_strong(state, waiting))
+                    {
+                        return f;
+                    }
+
+                    // the value has arrived (or the channel was closed) in
+                    // the meantime
+                    if (state == full)
+                    {
+                        s.waiter->set_value(HPX_MOVE(*s.value));
+                        s.value.reset();
+                    }
+                    else
+                    {
+                        HPX_ASSERT(state == closed);
+                        s.waiter->set_exception(
+                            HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                                "hpx::lcos::local::channel::get",
+                                "this channel is empty and was closed"));
+                    }
+                    release_slot(seg);
+                    return f;
+                }
+
+                hpx::future<T> f;
+                if (state == full)
+                {
+                    f = hpx::make_ready_future(HPX_MOVE(*s.value));
+                    s.value.reset();
+                }
+                else
+                {
+                    HPX_ASSERT(state == closed);
+                    f = closed_and_empty();
+                }
+                release_slot(seg);
+                return f;
+            }
+
+            void send(std::size_t ticket, T&& t)
+            {
+                segment* seg =
+                    find_segment(tail_segment_.data_, ticket / segment_size);
+                slot& s = seg->slots[ticket % segment_size];
+
+                s.value.emplace(HPX_MOVE(t));
+
+                std::uint8_t state = empty;
+                if (!s.state.compare_exchange_strong(state, full))
+                {
+                    // a get is already waiting for this value
+                    HPX_ASSERT(state == waiting);
+                    s.waiter->set_value(HPX_MOVE(*s.value));
+                    s.value.reset();
+                    release_slot(seg);
+                }
+            }
+
+            // Return the segment with the given id, the segment is guaranteed
+            // not to be retired as long as the caller has not released its
+            // slot.
+            segment* find_segment(std::atomic<segment*>& hint, std::size_t id)
+            {
+                // the hint may refer to a retired (and possibly reused)
+                // segment, in which case its id doesn't match
+                segment* seg = hint.load(std::memory_order_acquire);
+                if (seg->id.load(std::memory_order_acquire) == id)
+                {
+                    return seg;
+                }
+
+                std::lock_guard<mutex_type> l(mtx_);
+
+                seg = first_;
+                HPX_ASSERT(seg->id.load(std::memory_order_relaxed) <= id);
+                while (seg->id.load(std::memory_order_relaxed) != id)
+                {
+                    if (seg->next == nullptr)
+                    {
+                        seg->next = allocate_segment(
+                            seg->id.load(std::memory_order_relaxed) + 1);
+                        last_ = seg->next;
+                    }
+                    seg = seg->next;
+                }
+
+                hint.store(seg, std::memory_order_release);
+                return seg;
+            }
+
+            // Mark one slot of the given segment as being used by both sides,
+            // retire all leading segments which are not used anymore
+            void release_slot(segment* seg)
+            {
+                if (seg->used.fetch_add(1, std::memory_order_acq_rel) + 1 !=
+                    segment_size)
+                {
+                    return;
+                }
+
+                std::lock_guard<mutex_type> l(mtx_);
+                while (first_ != last_ &&
+                    first_->used.load(std::memory_order_acquire) ==
+                        segment_size)
+                {
+                    segment* retired = first_;
+                    first_ = retired->next;
+
+                    for (slot& s : retired->slots)
+                    {
+                        s.state.store(empty, std::memory_order_relaxed);
+                        s.value.reset();
+                        s.waiter.reset();
+                    }
+                    retired->used.store(0, std::memory_order_relaxed);
+                    retired->id.store(invalid_id, std::memory_order_release);
+
+                    retired->next = free_;
+                    free_ = retired;
+                }
+            }
+
+            // the lock must be held if the channel is in use
+            segment* allocate_segment(std::size_t id)
+            {
+                segment* seg = free_;
+                if (seg != nullptr)
+                {
+                    free_ = seg->next;
+                    seg->next = nullptr;
+                }
+                else
+                {
+                    seg = new segment;
+                }
+
+                seg->id.store(id, std::memory_order_release);
+                return seg;
+            }
+
+            static void delete_segments(segment* seg) noexcept
+            {
+                while (seg != nullptr)
+                {
+                    segment* next = seg->next;
+                    delete seg;
+                    seg = next;
+                }
+            }
+
+        private:
+            // keep the counters and the segment hints of both sides in
+            // separate cache lines, the tail counter holds the closed flag
+            hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
+            hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
+            hpx::util::cache_aligned_data<std::atomic<segment*>> head_segment_;
+            hpx::util::cache_aligned_data<std::atomic<segment*>> tail_segment_;
+
+            mutable mutex_type mtx_;
+            segment* first_;    // oldest segment not retired yet
+            segment* last_;     // most recently linked segment
+            segment* free_;     // retired segments available for reuse
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T, typename Policy>
+        struct unlimited_channel_impl;
+
+        template <typename T>
+        struct unlimited_channel_impl<T, locked_channel_policy>
+        {
+            using type = unlimited_channel<T>;
+        };
+
+        template <typename T>
+        struct unlimited_channel_impl<T, lockfree_channel_policy>
+        {
+            using type = lockfree_unlimited_channel<T>;
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename T>
         class one_element_queue_async
@@ -564,7 +1013,7 @@ namespace hpx::lcos::local {
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename T = void>
+    template <typename T = void, typename Policy = locked_channel_policy>
     class channel;
 
     template <typename T = void>
@@ -804,8 +1253,8 @@ namespace hpx::lcos::local {
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
-    // channel with unlimited buffer
-    template <typename T>
+    // channel with unlimited buffer, the Policy selects its implementation
+    template <typename T, typename Policy>
     class channel : protected detail::channel_base<T>
     {
         using base_type = detail::channel_base<T>;
@@ -819,7 +1268,8 @@ namespace hpx::lcos::local {
         using value_type = T;
 
         channel()
-          : base_type(new detail::unlimited_channel<T>())
+          : base_type(
+                new typename detail::unlimited_channel_impl<T, Policy>::type())
         {
         }
 
@@ -869,7 +1319,8 @@ namespace hpx::lcos::local {
         friend class send_channel<T>;
 
     public:
-        receive_channel(channel<T> const& c)
+        template <typename Policy>
+        receive_channel(channel<T, Policy> const& c)
           : base_type(c.get_channel_impl())
         {
         }
@@ -891,7 +1342,8 @@ namespace hpx::lcos::local {
         using base_type = detail::channel_base<T>;
 
     public:
-        send_channel(channel<T> const& c)
+        template <typename Policy>
+        send_channel(channel<T, Policy> const& c)
           : base_type(c.get_channel_impl())
         {
         }
@@ -930,8 +1382,8 @@ namespace hpx::lcos::local {
 
     ///////////////////////////////////////////////////////////////////////////
     // forward declare specializations
-    template <>
-    class channel<void>;
+    template <typename Policy>
+    class channel<void, Policy>;
 
     template <>
     class receive_channel<void>;
@@ -1090,8 +1542,8 @@ namespace hpx::lcos::local {
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
-    template <>
-    class channel<void> : protected detail::channel_base<void>
+    template <typename Policy>
+    class channel<void, Policy> : protected detail::channel_base<void>
     {
         using base_type = detail::channel_base<void>;
 
@@ -1104,7 +1556,8 @@ namespace hpx::lcos::local {
         using value_type = void;
 
         channel()
-          : base_type(new detail::unlimited_channel<util::unused_type>())
+          : base_type(new typename detail::unlimited_channel_impl<
+                util::unused_type, Policy>::type())
         {
         }
 
@@ -1153,7 +1606,8 @@ namespace hpx::lcos::local {
         friend class send_channel<void>;
 
     public:
-        receive_channel(channel<void> const& c)
+        template <typename Policy>
+        receive_channel(channel<void, Policy> const& c)
           : base_type(c.get_channel_impl())
         {
         }
@@ -1175,7 +1629,8 @@ namespace hpx::lcos::local {
         using base_type = detail::channel_base<void>;
 
     public:
-        send_channel(channel<void> const& c)
+        template <typename Policy>
+        send_channel(channel<void, Policy> const& c)
           : base_type(c.get_channel_impl())
         {
         }
@@ -0,0 +1,126 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of hpx::lcos::local::channel if
+// several producers send to a single consumer (fan-in). It compares the
+// default (locked) implementation with the lock-free one selected by
+// lockfree_channel_policy.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/lcos_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t num_values = 100000;
+std::uint64_t num_producers = 0;
+std::uint64_t repetitions = 5;
+
+template <typename Policy>
+double measure_fan_in()
+{
+    using channel_type = hpx::lcos::local::channel<std::uint64_t, Policy>;
+
+    double best_time = 0.0;
+    for (std::uint64_t r = 0; r != repetitions; ++r)
+    {
+        channel_type c;
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        std::vector<hpx::future<void>> producers;
+        producers.reserve(num_producers);
+        for (std::uint64_t p = 0; p != num_producers; ++p)
+        {
+            producers.push_back(hpx::async([c]() mutable {
+                for (std::uint64_t i = 0; i != num_values; ++i)
+                {
+                    c.set(i);
+                }
+            }));
+        }
+
+        // consume all values, the consumer has to wait whenever the channel
+        // runs empty
+        std::uint64_t sum = 0;
+        for (std::uint64_t i = 0; i != num_values * num_producers; ++i)
+        {
+            sum += c.get(hpx::launch::sync);
+        }
+
+        hpx::wait_all(producers);
+
+        std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+
+        if (sum != num_producers * (num_values * (num_values - 1) / 2))
+        {
+            std::cout << "Error!\n";
+        }
+
+        double const elapsed = static_cast<double>(end - start) / 1e9;
+        if (r == 0 || elapsed < best_time)
+            best_time = elapsed;
+    }
+    return best_time;
+}
+
+template <typename Policy>
+void run_benchmark(char const* name)
+{
+    double const elapsed = measure_fan_in<Policy>();
+    double const num_ops = static_cast<double>(num_values * num_producers);
+
+    std::cout << "channel: " << name << ", producers: " << num_producers
+              << ", values: " << num_values * num_producers
+              << ", time: " << elapsed
+              << " [s], throughput: " << num_ops / elapsed << " [op/s]"
+              << std::endl;
+
+    hpx::util::print_cdash_timing(
+        (std::string("ChannelFanIn_") + name).c_str(), elapsed);
+}
+
+int hpx_main()
+{
+    if (num_producers == 0)
+    {
+        num_producers = hpx::get_num_worker_threads();
+    }
+
+    run_benchmark<hpx::lcos::local::locked_channel_policy>("locked");
+    run_benchmark<hpx::lcos::local::lockfree_channel_policy>("lockfree");
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("values", value<std::uint64_t>(&num_values)->default_value(100000),
+         "number of values sent by each producer (default: 100000)")
+        ("producers", value<std::uint64_t>(&num_producers)->default_value(0),
+         "number of producers (default: number of worker threads)")
+        ("repetitions", value<std::uint64_t>(&repetitions)->default_value(5),
+         "number of times to repeat the benchmark (default: 5)");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
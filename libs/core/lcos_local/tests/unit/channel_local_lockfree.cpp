@@ -0,0 +1,413 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+
+template <typename T = void>
+using lockfree_channel =
+    hpx::lcos::local::channel<T, hpx::lcos::local::lockfree_channel_policy>;
+
+///////////////////////////////////////////////////////////////////////////////
+void sum(std::vector<int> const& s, hpx::lcos::local::send_channel<int> c)
+{
+    c.set(std::accumulate(s.begin(), s.end(), 0));    // send sum to channel
+}
+
+void calculate_sum()
+{
+    std::vector<int> s = {7, 2, 8, -9, 4, 0};
+    lockfree_channel<int> c;
+
+    hpx::post(&sum,
+        std::vector<int>(
+            s.begin(), s.begin() + static_cast<std::ptrdiff_t>(s.size() / 2)),
+        c);
+    hpx::post(&sum,
+        std::vector<int>(
+            s.begin() + static_cast<std::ptrdiff_t>(s.size() / 2), s.end()),
+        c);
+
+    int x = c.get(hpx::launch::sync);    // receive from c
+    int y = c.get(hpx::launch::sync);
+
+    int expected = std::accumulate(s.begin(), s.end(), 0);
+    HPX_TEST_EQ(expected, x + y);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// values are received in the order they were sent, even if the receiver has
+// to wait for them
+void ordering()
+{
+    constexpr int num_values = 1000;
+
+    lockfree_channel<int> c;
+
+    std::vector<hpx::future<int>> received;
+    received.reserve(num_values);
+    for (int i = 0; i != num_values / 2; ++i)
+    {
+        received.push_back(c.get());
+    }
+
+    for (int i = 0; i != num_values; ++i)
+    {
+        c.set(i);
+    }
+
+    for (int i = num_values / 2; i != num_values; ++i)
+    {
+        received.push_back(c.get());
+    }
+
+    for (int i = 0; i != num_values; ++i)
+    {
+        HPX_TEST_EQ(received[i].get(), i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// many producers send to many consumers, every value has to be received
+// exactly once and in the order it was sent by its producer
+void fan_in()
+{
+    constexpr std::size_t num_producers = 8;
+    constexpr std::size_t num_consumers = 4;
+    constexpr std::size_t num_values = 10000;
+
+    lockfree_channel<std::size_t> c;
+
+    std::vector<hpx::future<void>> producers;
+    for (std::size_t p = 0; p != num_producers; ++p)
+    {
+        producers.push_back(hpx::async([c, p]() mutable {
+            for (std::size_t i = 0; i != num_values; ++i)
+            {
+                c.set(p * num_values + i);
+            }
+        }));
+    }
+
+    std::vector<std::atomic<std::size_t>> received(num_producers * num_values);
+    std::vector<hpx::future<void>> consumers;
+    for (std::size_t i = 0; i != num_consumers; ++i)
+    {
+        consumers.push_back(hpx::async([c, &received]() {
+            std::vector<std::size_t> last(num_producers, 0);
+            while (true)
+            {
+                // waiting consumers are canceled when the channel is closed
+                hpx::error_code ec(hpx::throwmode::lightweight);
+                std::size_t const value = c.get(hpx::launch::sync, ec);
+                if (ec)
+                {
+                    break;
+                }
+
+                ++received[value];
+
+                std::size_t const p = value / num_values;
+                HPX_TEST_LTE(last[p], value % num_values);
+                last[p] = value % num_values + 1;
+            }
+        }));
+    }
+
+    hpx::wait_all(producers);
+    c.close();
+    hpx::wait_all(consumers);
+
+    for (auto const& r : received)
+    {
+        HPX_TEST_EQ(r.load(), std::size_t(1));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ping_void(hpx::lcos::local::send_channel<> pings)
+{
+    pings.set();
+}
+
+void pong_void(hpx::lcos::local::receive_channel<> pings,
+    hpx::lcos::local::send_channel<> pongs, bool& pingponged)
+{
+    pings.get(hpx::launch::sync);
+    pongs.set();
+
+    HPX_TEST(!pingponged);
+    pingponged = true;
+}
+
+void pingpong_void()
+{
+    lockfree_channel<> pings;
+    lockfree_channel<> pongs;
+
+    for (int i = 0; i != 100; ++i)
+    {
+        bool pingponged = false;
+
+        ping_void(pings);
+        pong_void(pings, pongs, pingponged);
+
+        pongs.get(hpx::launch::sync);
+        HPX_TEST(pingponged);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void dispatch_work()
+{
+    lockfree_channel<int> jobs;
+    lockfree_channel<> done;
+
+    std::atomic<int> received_jobs(0);
+    std::atomic<bool> was_closed(false);
+
+    hpx::post([jobs, done, &received_jobs, &was_closed]() mutable {
+        while (true)
+        {
+            hpx::error_code ec(hpx::throwmode::lightweight);
+            int next = jobs.get(hpx::launch::sync, ec);
+            (void) next;
+            if (!ec)
+            {
+                ++received_jobs;
+            }
+            else
+            {
+                was_closed = true;
+                done.set();
+                break;
+            }
+        }
+    });
+
+    for (int j = 1; j <= 3; ++j)
+    {
+        jobs.set(j);
+    }
+
+    jobs.close();
+    done.get(hpx::launch::sync);
+
+    HPX_TEST_EQ(received_jobs.load(), 3);
+    HPX_TEST(was_closed.load());
+}
+
+void close_cancels_waiting()
+{
+    lockfree_channel<int> c;
+
+    hpx::future<int> f1 = c.get();
+    hpx::future<int> f2 = c.get();
+
+    c.set(42);
+    HPX_TEST_EQ(c.close(), std::size_t(1));
+
+    HPX_TEST_EQ(f1.get(), 42);
+
+    bool caught_exception = false;
+    try
+    {
+        f2.get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void channel_range()
+{
+    std::atomic<int> received_elements(0);
+
+    lockfree_channel<std::string> queue;
+    queue.set("one");
+    queue.set("two");
+    queue.set("three");
+    queue.close();
+
+    for (auto const& elem : queue)
+    {
+        (void) elem;
+        ++received_elements;
+    }
+
+    HPX_TEST_EQ(received_elements.load(), 3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void deadlock_test()
+{
+    bool caught_exception = false;
+    try
+    {
+        lockfree_channel<int> c;
+        int value = c.get(hpx::launch::sync);
+        HPX_TEST(false);
+        (void) value;
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void closed_channel_get()
+{
+    bool caught_exception = false;
+    try
+    {
+        lockfree_channel<int> c;
+        c.set(42);
+        c.close();
+
+        HPX_TEST_EQ(c.get(hpx::launch::sync), 42);
+
+        int value = c.get(hpx::launch::sync);
+        HPX_TEST(false);
+        (void) value;
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void closed_channel_set()
+{
+    bool caught_exception = false;
+    try
+    {
+        lockfree_channel<int> c;
+        c.close();
+
+        c.set(42);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void explicit_generation()
+{
+    bool caught_exception = false;
+    try
+    {
+        lockfree_channel<int> c;
+        c.set(42, 122);    // generations are not supported
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// values are constructed in the channel only when they are set, and they are
+// destroyed once they were received or the channel is destroyed
+std::atomic<int> num_instances(0);
+
+struct no_default
+{
+    explicit no_default(int value)
+      : value(value)
+    {
+        ++num_instances;
+    }
+
+    no_default(no_default const& rhs)
+      : value(rhs.value)
+    {
+        ++num_instances;
+    }
+
+    no_default(no_default&& rhs) noexcept
+      : value(rhs.value)
+    {
+        ++num_instances;
+    }
+
+    no_default& operator=(no_default const&) = default;
+    no_default& operator=(no_default&&) = default;
+
+    ~no_default()
+    {
+        --num_instances;
+    }
+
+    int value;
+};
+
+void non_default_constructible()
+{
+    {
+        lockfree_channel<no_default> c;
+        HPX_TEST_EQ(num_instances.load(), 0);
+
+        // values set before and after the get arrived
+        hpx::future<no_default> f = c.get();
+        c.set(no_default(1));
+        c.set(no_default(2));
+        c.set(no_default(3));
+
+        HPX_TEST_EQ(f.get().value, 1);
+        HPX_TEST_EQ(c.get(hpx::launch::sync).value, 2);
+        HPX_TEST_EQ(num_instances.load(), 1);
+    }
+
+    // the value left in the channel was destroyed with it
+    HPX_TEST_EQ(num_instances.load(), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    calculate_sum();
+    ordering();
+    fan_in();
+    pingpong_void();
+    dispatch_work();
+    close_cancels_waiting();
+    channel_range();
+
+    deadlock_test();
+    closed_channel_get();
+    closed_channel_set();
+    explicit_generation();
+    non_default_constructible();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,215 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the elastic_pool_controller suspends the processing units of
+// an idle pool and resumes them once work starts to queue up.
+
+#include <hpx/assert.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/thread_pool_util.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::size_t const max_threads = (std::min) (std::size_t(4),
+    std::size_t(hpx::threads::hardware_concurrency()));
+
+// wait for the given predicate to become true, give up after 10s
+template <typename F>
+bool wait_for(F&& f)
+{
+    hpx::chrono::high_resolution_timer t;
+    while (!f())
+    {
+        if (t.elapsed() > 10.0)
+        {
+            return false;
+        }
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+void busy_wait(std::chrono::microseconds duration)
+{
+    hpx::chrono::high_resolution_timer t;
+    while (t.elapsed_microseconds() < duration.count())
+    {
+    }
+}
+
+int hpx_main()
+{
+    std::size_t const num_threads = hpx::resource::get_num_threads("worker");
+
+    hpx::threads::thread_pool_base& tp =
+        hpx::resource::get_thread_pool("worker");
+
+    hpx::threads::elasticity_parameters params;
+    params.sampling_interval = std::chrono::microseconds(500);
+    params.suspend_after = 10;
+    params.min_active_processing_units = 1;
+
+    {
+        hpx::threads::elastic_pool_controller controller(tp, params);
+
+        // the idle pool shrinks down to the minimal number of processing
+        // units
+        HPX_TEST(wait_for([&]() {
+            return controller.get_num_suspended_processing_units() ==
+                num_threads - 1;
+        }));
+        HPX_TEST_EQ(tp.get_active_os_thread_count(), std::size_t(1));
+        HPX_TEST_EQ(controller.get_num_suspensions(), num_threads - 1);
+
+        // a burst of work makes it grow again
+        hpx::execution::parallel_executor exec(&tp);
+
+        std::vector<hpx::future<void>> fs;
+        fs.reserve(num_threads * 1000);
+        for (std::size_t i = 0; i != num_threads * 1000; ++i)
+        {
+            fs.push_back(hpx::async(
+                exec, []() { busy_wait(std::chrono::microseconds(100)); }));
+        }
+
+        if (num_threads > 1)
+        {
+            HPX_TEST(wait_for(
+                [&]() { return controller.get_num_resumptions() != 0; }));
+        }
+
+        hpx::wait_all(fs);
+
+        // stopping the controller resumes all processing units it has
+        // suspended
+        controller.stop();
+
+        HPX_TEST_EQ(controller.get_num_suspended_processing_units(),
+            std::size_t(0));
+        HPX_TEST_EQ(tp.get_active_os_thread_count(), num_threads);
+    }
+
+    {
+        // processing units are not suspended below the given minimum
+        params.min_active_processing_units = num_threads;
+
+        hpx::threads::elastic_pool_controller controller(tp, params);
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        HPX_TEST_EQ(controller.get_num_suspensions(), std::size_t(0));
+        HPX_TEST_EQ(tp.get_active_os_thread_count(), num_threads);
+    }
+
+    return hpx::local::finalize();
+}
+
+int hpx_main_elasticity_disabled()
+{
+    // the controller refuses pools that do not support suspending processing
+    // units
+    bool caught_exception = false;
+    try
+    {
+        hpx::threads::elastic_pool_controller controller(
+            hpx::resource::get_thread_pool("worker"));
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(int argc, char* argv[],
+    hpx::resource::scheduling_policy scheduler,
+    hpx::threads::policies::scheduler_mode mode, int (*f)())
+{
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=" + std::to_string(max_threads)};
+    init_args.rp_callback = [scheduler, mode](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("worker", scheduler, mode);
+
+        std::size_t const worker_pool_threads =
+            rp.get_number_requested_threads() - 1;
+        std::size_t worker_pool_threads_added = 0;
+
+        for (hpx::resource::numa_domain const& d : rp.numa_domains())
+        {
+            for (hpx::resource::core const& c : d.cores())
+            {
+                for (hpx::resource::pu const& p : c.pus())
+                {
+                    if (worker_pool_threads_added < worker_pool_threads)
+                    {
+                        rp.add_resource(p, "worker");
+                        ++worker_pool_threads_added;
+                    }
+                }
+            }
+        }
+    };
+
+    HPX_TEST_EQ(hpx::local::init(f, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_ASSERT(max_threads >= 2);
+
+    std::vector<hpx::resource::scheduling_policy> schedulers = {
+        hpx::resource::scheduling_policy::local,
+        hpx::resource::scheduling_policy::local_priority_fifo,
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+        hpx::resource::scheduling_policy::local_priority_lifo,
+        hpx::resource::scheduling_policy::abp_priority_fifo,
+        hpx::resource::scheduling_policy::abp_priority_lifo,
+#endif
+        hpx::resource::scheduling_policy::static_,
+        hpx::resource::scheduling_policy::static_priority,
+        hpx::resource::scheduling_policy::shared_priority,
+
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+        hpx::resource::scheduling_policy::local_workrequesting_fifo,
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+        hpx::resource::scheduling_policy::local_workrequesting_lifo,
+#endif
+        hpx::resource::scheduling_policy::local_workrequesting_mc,
+#endif
+    };
+
+    for (auto const scheduler : schedulers)
+    {
+        test_scheduler(argc, argv, scheduler,
+            hpx::threads::policies::scheduler_mode::default_ |
+                hpx::threads::policies::scheduler_mode::enable_elasticity,
+            &hpx_main);
+    }
+
+    test_scheduler(argc, argv,
+        hpx::resource::scheduling_policy::local_priority_fifo,
+        hpx::threads::policies::scheduler_mode(
+            hpx::threads::policies::scheduler_mode::default_ &
+            ~hpx::threads::policies::scheduler_mode::enable_elasticity),
+        &hpx_main_elasticity_disabled);
+
+    return hpx::util::report_errors();
+}
@@ -110,8 +110,18 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // Configuration of the pooled allocator for coroutine stacks
+        bool use_stack_pool() const;
+        std::size_t get_stack_pool_batch_size() const;
+        std::size_t get_stack_pool_watermark() const;
 #endif
 
+        // Configuration of the service used for timed thread suspension,
+        // the resolution of the timer wheel is given in microseconds
+        bool use_timer_wheel() const;
+        std::uint64_t get_timer_wheel_resolution() const;
+
         // return trace_depth for stack-backtraces
         std::size_t trace_depth() const;
 
@@ -176,6 +176,8 @@ namespace hpx::util {
             "${HPX_MAX_IDLE_BACKOFF_TIME:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_IDLE_BACKOFF_TIME_MAX)) "}",
 #endif
+            "timer_service = ${HPX_TIMER_SERVICE:asio}",
+            "timer_wheel_resolution = ${HPX_TIMER_WHEEL_RESOLUTION:100}",
             "default_scheduler_mode = ${HPX_DEFAULT_SCHEDULER_MODE}",
 
         /// If HPX_HAVE_ATTACH_DEBUGGER_ON_TEST_FAILURE is set,
@@ -218,6 +220,9 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_stack_pool = ${HPX_USE_STACK_POOL:0}",
+            "stack_pool_batch_size = ${HPX_STACK_POOL_BATCH_SIZE:16}",
+            "stack_pool_watermark = ${HPX_STACK_POOL_WATERMARK:64}",
 #endif
 
             "[hpx.threadpools]",
@@ -1105,8 +1110,60 @@ namespace hpx::util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_pool() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_stack_pool", 0) !=
+                0;
+        }
+        return false;    // default is false
+    }
+
+    std::size_t runtime_configuration::get_stack_pool_batch_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "stack_pool_batch_size", 16);
+        }
+        return 16;
+    }
+
+    std::size_t runtime_configuration::get_stack_pool_watermark() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "stack_pool_watermark", 64);
+        }
+        return 64;
+    }
 #endif
 
+    bool runtime_configuration::use_timer_wheel() const
+    {
+        if (util::section const* sec = get_section("hpx"); nullptr != sec)
+        {
+            return sec->get_entry("timer_service", "asio") == "wheel";
+        }
+        return false;    // default is to use the asio timer service
+    }
+
+    std::uint64_t runtime_configuration::get_timer_wheel_resolution() const
+    {
+        if (util::section const* sec = get_section("hpx"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::uint64_t>(
+                *sec, "timer_wheel_resolution", 100);
+        }
+        return 100;
+    }
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
@@ -21,6 +21,12 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
+#include <hpx/topology/topology.hpp>
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#endif
 
 #include <algorithm>
 #include <atomic>
@@ -87,6 +93,11 @@
 // case tasks do not need to be copied. While steal-half is important to tackle
 // fine-grained parallelism, polling is necessary to achieve short message
 // handling delays when workers schedule long-running tasks.
+//
+// A victim answering a steal-half request hands over half of its pending tasks
+// (at most HPX_WORKREQUESTING_MAX_STEAL_BATCH_SIZE) as a single message. Steal
+// requests are first sent to workers of the NUMA domain of the thief, workers
+// of other NUMA domains are asked only after all local workers were asked.
 
 namespace hpx::threads::policies {
 
@@ -310,6 +321,22 @@ namespace hpx::threads::policies {
             std::uint32_t steal_requests_received_ = 0;
             std::uint32_t steal_requests_discarded_ = 0;
 #endif
+
+            // cores outside of the NUMA domain of this core, they are asked
+            // for work only after all cores of the same domain were asked
+            mask_type remote_victims_ = mask_type();
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+            // time the outstanding steal request was sent
+            std::uint64_t steal_request_time_ = 0;
+
+            // statistics of the received batches of stolen tasks (accessed by
+            // the performance counters)
+            std::atomic<std::uint64_t> steal_latency_ = 0;
+            std::atomic<std::uint64_t> steal_latency_count_ = 0;
+            std::atomic<std::uint64_t> num_steal_batches_ = 0;
+            std::atomic<std::uint64_t> num_stolen_tasks_ = 0;
+#endif
         };
 
     public:
@@ -615,6 +642,72 @@ namespace hpx::threads::policies {
             count += d.queue_->get_num_stolen_to_staged(reset);
             return count + d.bound_queue_->get_num_stolen_to_staged(reset);
         }
+
+        // Sum of the times (in nanoseconds) between sending a steal request
+        // and receiving the tasks stolen in response to it, and the number of
+        // the measured requests.
+        std::int64_t get_cumulative_steal_latency(
+            std::size_t num_thread, bool reset) override
+        {
+            std::uint64_t latency = 0;
+            for_each_scheduler_data(num_thread, [&](scheduler_data& d) {
+                latency += util::get_and_reset_value(d.steal_latency_, reset);
+            });
+            return static_cast<std::int64_t>(latency);
+        }
+
+        std::int64_t get_num_steal_latency_samples(
+            std::size_t num_thread, bool reset) override
+        {
+            std::uint64_t samples = 0;
+            for_each_scheduler_data(num_thread, [&](scheduler_data& d) {
+                samples +=
+                    util::get_and_reset_value(d.steal_latency_count_, reset);
+            });
+            return static_cast<std::int64_t>(samples);
+        }
+
+        // Number of tasks received in response to steal requests, and the
+        // number of answered steal requests.
+        std::int64_t get_num_stolen_tasks(
+            std::size_t num_thread, bool reset) override
+        {
+            std::uint64_t tasks = 0;
+            for_each_scheduler_data(num_thread, [&](scheduler_data& d) {
+                tasks += util::get_and_reset_value(d.num_stolen_tasks_, reset);
+            });
+            return static_cast<std::int64_t>(tasks);
+        }
+
+        std::int64_t get_num_steal_batches(
+            std::size_t num_thread, bool reset) override
+        {
+            std::uint64_t batches = 0;
+            for_each_scheduler_data(num_thread, [&](scheduler_data& d) {
+                batches +=
+                    util::get_and_reset_value(d.num_steal_batches_, reset);
+            });
+            return static_cast<std::int64_t>(batches);
+        }
+
+    private:
+        template <typename F>
+        void for_each_scheduler_data(std::size_t num_thread, F&& f)
+        {
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    f(data_[i].data_);
+                }
+                return;
+            }
+
+            HPX_ASSERT(num_thread < num_queues_);
+            f(data_[num_thread].data_);
+        }
+
+    public:
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -883,31 +976,33 @@ namespace hpx::threads::policies {
 
             // Send tasks from our queue to the requesting core, depending on
             // what's requested, either one task or half of the available tasks
+            // (rounded up and limited to the maximal batch size)
             std::size_t max_num_to_steal = 1;
             if (req.stealhalf_)
             {
-                max_num_to_steal = d.queue_->get_pending_queue_length(
-                                       std::memory_order_relaxed) /
-                    2;
+                std::size_t const pending =
+                    static_cast<std::size_t>(d.queue_->get_pending_queue_length(
+                        std::memory_order_relaxed));
+                max_num_to_steal = (std::min) ((pending + 1) / 2,
+                    static_cast<std::size_t>(
+                        HPX_WORKREQUESTING_MAX_STEAL_BATCH_SIZE));
             }
 
             if (max_num_to_steal != 0)
             {
                 task_data thrds(d.num_thread_);
-                thrds.tasks_.reserve(max_num_to_steal);
+                thrds.tasks_.resize(max_num_to_steal);
+
+                // dequeue all tasks of the batch at once
+                std::size_t const num_stolen =
+                    d.queue_->get_next_threads(thrds.tasks_.begin(),
+                        static_cast<std::int64_t>(max_num_to_steal), false,
+                        true);
+                thrds.tasks_.resize(num_stolen);
 
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                thread_id_ref_type thrd;
-                while (max_num_to_steal-- != 0 &&
-                    d.queue_->get_next_thread(thrd, false, true))
-                {
-                    d.queue_->increment_num_stolen_from_pending();
-                    thrds.tasks_.push_back(HPX_MOVE(thrd));
-                    thrd = thread_id_ref_type{};
-                }
-#else
-                d.queue_->get_next_threads(
-                    thrds.tasks_.begin(), thrds.tasks_.size(), false, true);
+                d.queue_->increment_num_stolen_from_pending(
+                    thrds.tasks_.size());
 #endif
 
                 // we are ready to send at least one task
@@ -1477,10 +1572,11 @@ namespace hpx::threads::policies {
         }
 #endif
 
-        // return a random victim for the current stealing operation
-        std::size_t random_victim(steal_request const& req) noexcept
+        // return a random core that is not marked in the given mask
+        std::size_t random_victim(
+            std::size_t thief, mask_cref_type victims) noexcept
         {
-            std::size_t result;
+            std::size_t result = static_cast<std::size_t>(-1);
 
             {
                 // generate at most 3 random numbers before resorting to more
@@ -1492,8 +1588,7 @@ namespace hpx::threads::policies {
                 do
                 {
                     result = uniform(gen_);
-                    if (result != req.num_thread_ &&
-                        !test(req.victims_, result))
+                    if (result != thief && !test(victims, result))
                     {
                         HPX_ASSERT(result < num_queues_);
                         return result;
@@ -1504,14 +1599,13 @@ namespace hpx::threads::policies {
             // to avoid infinite trials we randomly select one of the possible
             // victims
             std::uniform_int_distribution<std::int16_t> uniform(0,
-                static_cast<std::int16_t>(
-                    num_queues_ - count(req.victims_) - 1));
+                static_cast<std::int16_t>(num_queues_ - count(victims) - 1));
 
             // generate one more random number
             std::size_t selected_victim = uniform(gen_);
             for (std::size_t i = 0; i != num_queues_; ++i)
             {
-                if (!test(req.victims_, i))
+                if (!test(victims, i))
                 {
                     if (selected_victim == 0)
                     {
@@ -1522,12 +1616,30 @@ namespace hpx::threads::policies {
                 }
             }
 
-            HPX_ASSERT(result < num_queues_ && result != req.num_thread_ &&
-                !test(req.victims_, result));
+            HPX_ASSERT(result < num_queues_ && result != thief &&
+                !test(victims, result));
 
             return result;
         }
 
+        // return a random victim for the current stealing operation, prefer
+        // the cores of the NUMA domain of the thief as the stolen tasks will
+        // run there
+        std::size_t random_victim(steal_request const& req) noexcept
+        {
+            mask_cref_type remote_victims =
+                data_[req.num_thread_].data_.remote_victims_;
+            if (any(remote_victims))
+            {
+                mask_type const victims = req.victims_ | remote_victims;
+                if (count(victims) != num_queues_)
+                {
+                    return random_victim(req.num_thread_, victims);
+                }
+            }
+            return random_victim(req.num_thread_, req.victims_);
+        }
+
         // return the number of the next victim core
         std::size_t next_victim([[maybe_unused]] scheduler_data& d,
             steal_request const& req) noexcept
@@ -1613,6 +1725,10 @@ namespace hpx::threads::policies {
                     d.num_thread_, d.tasks_, d.victims_, idle, d.stealhalf_);
                 std::size_t victim = next_victim(d, req);
 
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+                d.steal_request_time_ =
+                    hpx::chrono::high_resolution_clock::now();
+#endif
                 ++d.requested_;
                 data_[victim].data_.requests_->set(HPX_MOVE(req));
 #if defined(HPX_HAVE_WORKREQUESTING_STEAL_STATISTICS)
@@ -1638,6 +1754,18 @@ namespace hpx::threads::policies {
                 // if at least one thrd was received
                 if (!thrds.tasks_.empty())
                 {
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+                    d.steal_latency_.fetch_add(
+                        hpx::chrono::high_resolution_clock::now() -
+                            d.steal_request_time_,
+                        std::memory_order_relaxed);
+                    d.steal_latency_count_.fetch_add(
+                        1, std::memory_order_relaxed);
+                    d.num_steal_batches_.fetch_add(
+                        1, std::memory_order_relaxed);
+                    d.num_stolen_tasks_.fetch_add(
+                        thrds.tasks_.size(), std::memory_order_relaxed);
+#endif
                     // Schedule all but the first received task in reverse order
                     // to maintain the sequence of tasks as pulled from the
                     // victims queue.
@@ -1812,6 +1940,24 @@ namespace hpx::threads::policies {
             resize(d.victims_, num_queues_);
             reset(d.victims_);
             set(d.victims_, num_thread);
+
+            // Mark all cores that belong to a different NUMA domain than this
+            // core, steal requests of this core are sent to those only after
+            // all cores of the same NUMA domain have been asked.
+            auto const& topo = create_topology();
+            std::size_t const numa_node = topo.get_numa_node_number(
+                affinity_data_.get_pu_num(num_thread));
+
+            resize(d.remote_victims_, num_queues_);
+            reset(d.remote_victims_);
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                if (topo.get_numa_node_number(affinity_data_.get_pu_num(i)) !=
+                    numa_node)
+                {
+                    set(d.remote_victims_, i);
+                }
+            }
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -0,0 +1,181 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/allocator_support.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The sharded_thread_map holds the ids of all threads managed by a
+    // thread_queue. The ids are distributed over NumShards independent hash
+    // sets, each protected by its own mutex and placed on its own cache line.
+    // Concurrent insertions and removals of different threads will therefore
+    // almost never contend on the same lock.
+    template <typename Mutex, std::size_t NumShards = 16>
+    class sharded_thread_map
+    {
+        static_assert(NumShards != 0 && (NumShards & (NumShards - 1)) == 0,
+            "the number of shards must be a power of two");
+
+        using mutex_type = Mutex;
+        using set_type =
+            std::unordered_set<thread_id_type, std::hash<thread_id_type>,
+                std::equal_to<>, util::internal_allocator<thread_id_type>>;
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            set_type map_;
+        };
+
+        static constexpr std::size_t shard_bits() noexcept
+        {
+            std::size_t bits = 0;
+            while ((std::size_t(1) << bits) < NumShards)
+                ++bits;
+            return bits;
+        }
+
+        // thread ids are addresses, use Fibonacci hashing to make sure that
+        // the (mostly zero) low bits do not determine the shard
+        static std::size_t shard_index(thread_id_type const& id) noexcept
+        {
+            if constexpr (NumShards == 1)
+            {
+                return 0;
+            }
+            else
+            {
+                std::uint64_t const h = std::hash<thread_id_type>()(id);
+                return static_cast<std::size_t>(
+                    (h * 0x9e3779b97f4a7c15ull) >> (64 - shard_bits()));
+            }
+        }
+
+        shard& get_shard(thread_id_type const& id) noexcept
+        {
+            return shards_[shard_index(id)].data_;
+        }
+
+        shard const& get_shard(thread_id_type const& id) const noexcept
+        {
+            return shards_[shard_index(id)].data_;
+        }
+
+    public:
+        static constexpr std::size_t num_shards = NumShards;
+
+        sharded_thread_map() = default;
+
+        sharded_thread_map(sharded_thread_map const&) = delete;
+        sharded_thread_map(sharded_thread_map&&) = delete;
+        sharded_thread_map& operator=(sharded_thread_map const&) = delete;
+        sharded_thread_map& operator=(sharded_thread_map&&) = delete;
+
+        ~sharded_thread_map() = default;
+
+        // Add the given thread id, returns false if it was already present
+        bool insert(thread_id_type const& id)
+        {
+            shard& s = get_shard(id);
+            std::lock_guard<mutex_type> lk(s.mtx_);
+            return s.map_.insert(id).second;
+        }
+
+        // Remove the given thread id, returns false if it was not present
+        bool erase(thread_id_type const& id)
+        {
+            shard& s = get_shard(id);
+            std::lock_guard<mutex_type> lk(s.mtx_);
+            return s.map_.erase(id) != 0;
+        }
+
+        bool contains(thread_id_type const& id) const
+        {
+            shard const& s = get_shard(id);
+            std::lock_guard<mutex_type> lk(s.mtx_);
+            return s.map_.find(id) != s.map_.end();
+        }
+
+        // This acquires the locks of all shards one by one, the result is
+        // therefore only a snapshot
+        std::size_t size() const
+        {
+            std::size_t result = 0;
+            for (auto const& s : shards_)
+            {
+                std::lock_guard<mutex_type> lk(s.data_.mtx_);
+                result += s.data_.map_.size();
+            }
+            return result;
+        }
+
+        // Invoke the given function for each of the stored thread ids. Each
+        // shard is locked while it is being visited, so f must not call back
+        // into this map.
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (auto const& s : shards_)
+            {
+                std::lock_guard<mutex_type> lk(s.data_.mtx_);
+                for (thread_id_type const& id : s.data_.map_)
+                {
+                    f(id);
+                }
+            }
+        }
+
+    private:
+        std::array<util::cache_line_data<shard>, NumShards> shards_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Queuing policy adaptor that switches a thread_queue to sharded
+    // bookkeeping. It behaves like the wrapped Queuing policy as far as the
+    // work-item and task containers are concerned, but additionally makes
+    // the thread_queue keep its thread map in a sharded_thread_map and its
+    // recycled thread objects in lock-free stacks. This removes the
+    // queue-wide mutex from the thread creation and termination paths.
+    //
+    // The adaptor can be passed as the PendingQueuing or StagedQueuing
+    // parameter of any scheduler that is built on top of thread_queue, e.g.
+    //
+    //      local_priority_queue_scheduler<std::mutex, lockfree_fifo,
+    //          sharded_bookkeeping<lockfree_fifo>>
+    //
+    template <typename Queuing = lockfree_fifo, std::size_t NumShards = 16>
+    struct sharded_bookkeeping : Queuing
+    {
+        template <typename Mutex>
+        struct thread_map
+        {
+            using type = sharded_thread_map<Mutex, NumShards>;
+        };
+    };
+
+    namespace detail {
+
+        template <typename Queuing, typename Mutex>
+        using thread_map_t =
+            typename Queuing::template thread_map<Mutex>::type;
+    }    // namespace detail
+}    // namespace hpx::threads::policies
@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/stack.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/allocator_support.hpp>
 #include <hpx/modules/errors.hpp>
@@ -17,6 +18,8 @@
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
+#include <hpx/schedulers/sharded_thread_map.hpp>
+#include <hpx/synchronization/no_mutex.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_data_stackful.hpp>
@@ -47,6 +50,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -86,6 +90,19 @@ namespace hpx::threads::policies {
     //         typedef ... type;
     //     };
     // };
+    //
+    // A queuing policy may additionally expose a nested template
+    //
+    //     template <typename Mutex>
+    //     struct thread_map
+    //     {
+    //         typedef ... type;
+    //     };
+    //
+    // in which case the thread_queue uses sharded bookkeeping: the map of all
+    // threads is of the given type (see sharded_thread_map) and the recycled
+    // thread objects are kept in lock-free stacks. The queue-wide mutex is
+    // then used only to throttle the conversion of staged tasks.
     template <typename Mutex, typename PendingQueuing, typename StagedQueuing,
         typename TerminatedQueuing>
     class thread_queue
@@ -94,14 +111,32 @@ namespace hpx::threads::policies {
         // we use a simple mutex to protect the data members for now
         using mutex_type = Mutex;
 
+        static constexpr bool sharded_bookkeeping =
+            util::is_detected_v<detail::thread_map_t, PendingQueuing,
+                mutex_type> ||
+            util::is_detected_v<detail::thread_map_t, StagedQueuing, mutex_type>;
+
+        using bookkeeping_policy = std::conditional_t<
+            util::is_detected_v<detail::thread_map_t, StagedQueuing,
+                mutex_type>,
+            StagedQueuing, PendingQueuing>;
+
+        // the mutex protecting the thread map and the thread heaps, this is a
+        // no-op if both synchronize themselves
+        using bookkeeping_mutex_type =
+            std::conditional_t<sharded_bookkeeping, hpx::no_mutex, mutex_type>;
+
         // this is the type of the map holding all threads (except depleted
         // ones)
-        using thread_map_type =
+        using thread_map_type = util::detected_or_t<
             std::unordered_set<thread_id_type, std::hash<thread_id_type>,
-                std::equal_to<>, util::internal_allocator<thread_id_type>>;
+                std::equal_to<>, util::internal_allocator<thread_id_type>>,
+            detail::thread_map_t, bookkeeping_policy, mutex_type>;
 
-        using thread_heap_type = std::vector<thread_id_type,
-            util::internal_allocator<thread_id_type>>;
+        using thread_heap_type = std::conditional_t<sharded_bookkeeping,
+            hpx::lockfree::stack<thread_data*>,
+            std::vector<thread_id_type,
+                util::internal_allocator<thread_id_type>>>;
 
         struct task_description
         {
@@ -177,11 +212,11 @@ namespace hpx::threads::policies {
             // ASAN gets confused by reusing threads/stacks
 #if !defined(HPX_HAVE_ADDRESS_SANITIZER)
             // Check for an unused thread object.
-            if (heap && !heap->empty())    //-V522
+            thread_id_type recycled;
+            if (heap && pop_thread_heap(*heap, recycled))    //-V522
             {
                 // Take ownership of the thread object and rebind it.
-                thrd = heap->back();
-                heap->pop_back();
+                thrd = recycled;
                 get_thread_id_data(thrd)->rebind(data);
             }
             else
@@ -208,6 +243,86 @@ namespace hpx::threads::policies {
         static util::internal_allocator<task_description>
             task_description_alloc_;
 
+        static bool pop_thread_heap(
+            thread_heap_type& heap, thread_id_type& thrd) noexcept
+        {
+            if constexpr (sharded_bookkeeping)
+            {
+                thread_data* p = nullptr;
+                if (!heap.pop(p))
+                {
+                    return false;
+                }
+                thrd = thread_id_type(p);
+                return true;
+            }
+            else
+            {
+                if (heap.empty())
+                {
+                    return false;
+                }
+                thrd = heap.back();
+                heap.pop_back();
+                return true;
+            }
+        }
+
+        static void push_thread_heap(
+            thread_heap_type& heap, thread_id_type const& thrd)
+        {
+            if constexpr (sharded_bookkeeping)
+            {
+                heap.push(get_thread_id_data(thrd));
+            }
+            else
+            {
+                heap.push_back(thrd);
+            }
+        }
+
+        bool thread_map_insert(thread_id_type const& thrd)
+        {
+            if constexpr (sharded_bookkeeping)
+            {
+                return thread_map_.insert(thrd);
+            }
+            else
+            {
+                return thread_map_.emplace(thrd).second;
+            }
+        }
+
+        bool thread_map_erase(thread_id_type const& thrd)
+        {
+            if constexpr (sharded_bookkeeping)
+            {
+                return thread_map_.erase(thrd);
+            }
+            else
+            {
+                return thread_map_.erase(thrd) != 0;
+            }
+        }
+
+        // Invoke f for all threads in the thread map
+        template <typename F>
+        void thread_map_for_each(F&& f) const
+        {
+            if constexpr (sharded_bookkeeping)
+            {
+                thread_map_.for_each(HPX_FORWARD(F, f));
+            }
+            else
+            {
+                std::lock_guard<mutex_type> lk(mtx_);
+                for (thread_id_type const& thrd : thread_map_)
+                {
+                    f(thrd);
+                }
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // add new threads if there is some amount of work available
         std::size_t add_new(std::int64_t add_count, thread_queue* addfrom,
@@ -246,8 +361,7 @@ namespace hpx::threads::policies {
                 task_description_alloc_.deallocate(task, 1);
 
                 // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> const p =
-                    thread_map_.emplace(thrd.noref());
+                bool const inserted = thread_map_insert(thrd.noref());
 
                 // 26110: Caller failing to hold lock 'lk'
 #if defined(HPX_MSVC)
@@ -255,7 +369,7 @@ namespace hpx::threads::policies {
 #pragma warning(disable : 26110)
 #endif
 
-                if (HPX_UNLIKELY(!p.second))
+                if (HPX_UNLIKELY(!inserted))
                 {
                     --addfrom->new_tasks_count_.data_;
                     lk.unlock();
@@ -314,7 +428,7 @@ namespace hpx::threads::policies {
             if (HPX_LIKELY(parameters_.max_thread_count_))
             {
                 std::int64_t const count =
-                    static_cast<std::int64_t>(thread_map_.size());
+                    thread_map_count_.load(std::memory_order_relaxed);
                 if (parameters_.max_thread_count_ >=
                     count + parameters_.min_add_new_count_)
                 {    //-V104
@@ -353,23 +467,23 @@ namespace hpx::threads::policies {
 
             if (stacksize == parameters_.small_stacksize_)
             {
-                thread_heap_small_.push_back(thrd);
+                push_thread_heap(thread_heap_small_, thrd);
             }
             else if (stacksize == parameters_.medium_stacksize_)
             {
-                thread_heap_medium_.push_back(thrd);
+                push_thread_heap(thread_heap_medium_, thrd);
             }
             else if (stacksize == parameters_.large_stacksize_)
             {
-                thread_heap_large_.push_back(thrd);
+                push_thread_heap(thread_heap_large_, thrd);
             }
             else if (stacksize == parameters_.huge_stacksize_)
             {
-                thread_heap_huge_.push_back(thrd);
+                push_thread_heap(thread_heap_huge_, thrd);
             }
             else if (stacksize == parameters_.nostack_stacksize_)
             {
-                thread_heap_nostack_.push_back(thrd);
+                push_thread_heap(thread_heap_nostack_, thrd);
             }
             else
             {
@@ -409,7 +523,7 @@ namespace hpx::threads::policies {
                         &get_thread_id_data(tid)->get_queue<thread_queue>() ==
                         this);
 
-                    if (thread_map_.erase(tid) != 0)
+                    if (thread_map_erase(tid))
                     {
                         recycle_thread(tid);
                         --thread_map_count_;
@@ -443,7 +557,7 @@ namespace hpx::threads::policies {
                         &get_thread_id_data(tid)->get_queue<thread_queue>() ==
                         this);
 
-                    if (thread_map_.erase(tid) != 0)
+                    if (thread_map_erase(tid))
                     {
                         recycle_thread(tid);
                         --thread_map_count_;
@@ -461,6 +575,12 @@ namespace hpx::threads::policies {
             if (terminated_items_count_.load(std::memory_order_acquire) == 0)
                 return true;
 
+            if constexpr (sharded_bookkeeping)
+            {
+                // all involved data structures synchronize themselves
+                return cleanup_terminated_locked(delete_all);
+            }
+
             if (delete_all)
             {
                 // do not lock mutex while deleting all threads, do it piece-wise
@@ -501,6 +621,11 @@ namespace hpx::threads::policies {
           , new_tasks_wait_(0)
           , new_tasks_wait_count_(0)
 #endif
+          , thread_heap_small_(0)
+          , thread_heap_medium_(0)
+          , thread_heap_large_(0)
+          , thread_heap_huge_(0)
+          , thread_heap_nostack_(0)
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
@@ -525,20 +650,15 @@ namespace hpx::threads::policies {
 
         ~thread_queue()
         {
-            for (auto const& t : thread_heap_small_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto const& t : thread_heap_medium_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto const& t : thread_heap_large_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto const& t : thread_heap_huge_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto const& t : thread_heap_nostack_)
-                deallocate(get_thread_id_data(t));
+            for (thread_heap_type* heap :
+                {&thread_heap_small_, &thread_heap_medium_,
+                    &thread_heap_large_, &thread_heap_huge_,
+                    &thread_heap_nostack_})
+            {
+                thread_id_type t;
+                while (pop_thread_heap(*heap, t))
+                    deallocate(get_thread_id_data(t));
+            }
         }
 
         thread_queue(thread_queue const&) = delete;
@@ -710,7 +830,8 @@ namespace hpx::threads::policies {
                 // suspended.
                 threads::thread_id_ref_type thrd;
 
-                std::unique_lock<mutex_type> lk(mtx_);
+                bookkeeping_mutex_type& mtx = bookkeeping_mutex();
+                std::unique_lock<bookkeeping_mutex_type> lk(mtx);
 
                 bool const schedule_now =
                     data.initial_state == thread_schedule_state::pending;
@@ -718,10 +839,7 @@ namespace hpx::threads::policies {
                 create_thread_object(thrd, data, lk);
 
                 // add a new entry in the map for this thread
-                std::pair<thread_map_type::iterator, bool> const p =
-                    thread_map_.emplace(thrd.noref());
-
-                if (HPX_UNLIKELY(!p.second))
+                if (HPX_UNLIKELY(!thread_map_insert(thrd.noref())))
                 {
                     lk.unlock();
                     HPX_THROWS_BAD_ALLOC_IF(ec, "thread_queue::create_thread");
@@ -730,7 +848,7 @@ namespace hpx::threads::policies {
                 ++thread_map_count_;
 
                 // this thread has to be in the map now
-                HPX_ASSERT(thread_map_.find(thrd.noref()) != thread_map_.end());
+                HPX_ASSERT(thread_map_contains(thrd.noref()));
                 HPX_ASSERT(
                     &get_thread_id_data(thrd)->get_queue<thread_queue>() ==
                     this);
@@ -920,7 +1038,7 @@ namespace hpx::threads::policies {
             std::size_t const max_items_requested = max_items;
 
             thread_description_ptr tdesc;
-            while (work_items_.pop(tdesc, steal))
+            while (max_items != 0 && work_items_.pop(tdesc, steal))
             {
                 if (get_maintain_queue_wait_times_enabled())
                 {
@@ -1019,26 +1137,19 @@ namespace hpx::threads::policies {
             }
 
             // acquire lock only if absolutely necessary
-            std::lock_guard<mutex_type> lk(mtx_);
-
             std::int64_t num_threads = 0;
-            auto const end = thread_map_.end();
-            for (auto it = thread_map_.begin(); it != end; ++it)
-            {
-                if (get_thread_id_data(*it)->get_state().state() == state)
+            thread_map_for_each([&](thread_id_type const& thrd) {
+                if (get_thread_id_data(thrd)->get_state().state() == state)
                     ++num_threads;
-            }
+            });
             return num_threads;
         }
 
         ///////////////////////////////////////////////////////////////////////
         void abort_all_suspended_threads()
         {
-            std::lock_guard<mutex_type> lk(mtx_);
-            auto const end = thread_map_.end();
-            for (auto it = thread_map_.begin(); it != end; ++it)
-            {
-                auto* const thrd = get_thread_id_data(*it);
+            thread_map_for_each([this](thread_id_type const& id) {
+                auto* const thrd = get_thread_id_data(id);
                 if (thrd->get_state().state() ==
                     thread_schedule_state::suspended)
                 {
@@ -1050,7 +1161,7 @@ namespace hpx::threads::policies {
                     HPX_ASSERT(thrd->count_ > 1);
                     schedule_thread(thread_id_ref_type(thrd));
                 }
-            }
+            });
         }
 
         bool enumerate_threads(hpx::function<bool(thread_id_type)> const& f,
@@ -1073,22 +1184,15 @@ namespace hpx::threads::policies {
 
             if (state == thread_schedule_state::unknown)
             {
-                std::lock_guard<mutex_type> lk(mtx_);
-                auto const end = thread_map_.end();
-                for (auto it = thread_map_.begin(); it != end; ++it)
-                {
-                    ids.push_back(*it);
-                }
+                thread_map_for_each(
+                    [&](thread_id_type const& id) { ids.push_back(id); });
             }
             else
             {
-                std::lock_guard<mutex_type> lk(mtx_);
-                auto const end = thread_map_.end();
-                for (auto it = thread_map_.begin(); it != end; ++it)
-                {
-                    if (get_thread_id_data(*it)->get_state().state() == state)
-                        ids.push_back(*it);
-                }
+                thread_map_for_each([&](thread_id_type const& id) {
+                    if (get_thread_id_data(id)->get_state().state() == state)
+                        ids.push_back(id);
+                });
             }
 
             // now invoke callback function for all matching threads
@@ -1228,9 +1332,20 @@ namespace hpx::threads::policies {
 #else
             if (get_minimal_deadlock_detection_enabled())
             {
-                std::lock_guard<mutex_type> lk(mtx_);
-                return detail::dump_suspended_threads(
-                    num_thread, thread_map_, idle_loop_count, running);
+                if constexpr (sharded_bookkeeping)
+                {
+                    std::vector<thread_id_type> ids;
+                    thread_map_.for_each(
+                        [&](thread_id_type const& id) { ids.push_back(id); });
+                    return detail::dump_suspended_threads(
+                        num_thread, ids, idle_loop_count, running);
+                }
+                else
+                {
+                    std::lock_guard<mutex_type> lk(mtx_);
+                    return detail::dump_suspended_threads(
+                        num_thread, thread_map_, idle_loop_count, running);
+                }
             }
             return false;
 #endif
@@ -1253,7 +1368,7 @@ namespace hpx::threads::policies {
                 "fails you've most likely changed the default without changing "
                 "the code here.");
 
-            std::lock_guard<mutex_type> lk(mtx_);
+            std::lock_guard<bookkeeping_mutex_type> lk(bookkeeping_mutex());
             for (std::int64_t i = 0; i < parameters_.init_threads_count_; ++i)
             {
                 // We don't care about the init parameters since this thread
@@ -1268,7 +1383,7 @@ namespace hpx::threads::policies {
                 HPX_ASSERT(p);
 
                 // Finally, store the thread for later use
-                thread_heap_small_.emplace_back(p);
+                push_thread_heap(thread_heap_small_, thread_id_type(p));
             }
         }
         static constexpr void on_stop_thread(std::size_t) noexcept {}
@@ -1278,10 +1393,38 @@ namespace hpx::threads::policies {
         }
 
     private:
+        bookkeeping_mutex_type& bookkeeping_mutex() const noexcept
+        {
+            if constexpr (sharded_bookkeeping)
+            {
+                return bookkeeping_mtx_;
+            }
+            else
+            {
+                return mtx_;
+            }
+        }
+
+        bool thread_map_contains(thread_id_type const& thrd) const
+        {
+            if constexpr (sharded_bookkeeping)
+            {
+                return thread_map_.contains(thrd);
+            }
+            else
+            {
+                return thread_map_.find(thrd) != thread_map_.end();
+            }
+        }
+
         thread_queue_init_parameters parameters_;
 
         mutable mutex_type mtx_;    // mutex protecting the members
 
+        // used instead of mtx_ for the thread map and the thread heaps in case
+        // of sharded bookkeeping
+        HPX_NO_UNIQUE_ADDRESS mutable hpx::no_mutex bookkeeping_mtx_;
+
         thread_map_type thread_map_;    // mapping of thread id's to HPX-threads
 
         // overall count of work items
@@ -0,0 +1,133 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that schedulers using a thread_queue with sharded bookkeeping run,
+// recycle, and enumerate their threads correctly.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/thread_pools.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t num_tasks = 10000;
+
+std::atomic<std::size_t> count(0);
+
+void spawn_nested(std::size_t levels)
+{
+    ++count;
+    if (levels != 0)
+    {
+        hpx::future<void> f1 = hpx::async(&spawn_nested, levels - 1);
+        hpx::future<void> f2 = hpx::async(&spawn_nested, levels - 1);
+        hpx::wait_all(f1, f2);
+    }
+}
+
+int hpx_main()
+{
+    // run enough tasks to make sure thread objects get recycled
+    {
+        count = 0;
+
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(num_tasks);
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            futures.push_back(hpx::async([]() { ++count; }));
+        }
+        hpx::wait_all(futures);
+
+        HPX_TEST_EQ(count.load(), num_tasks);
+    }
+
+    {
+        count = 0;
+        hpx::async(&spawn_nested, 10).get();
+        HPX_TEST_EQ(count.load(), (std::size_t(1) << 11) - 1);
+    }
+
+    // the current thread must be visible in the thread map
+    {
+        hpx::threads::thread_id_type const self = hpx::threads::get_self_id();
+
+        bool found = false;
+        hpx::threads::enumerate_threads(
+            [&](hpx::threads::thread_id_type id) {
+                if (id == self)
+                    found = true;
+                return true;
+            },
+            hpx::threads::thread_schedule_state::active);
+        HPX_TEST(found);
+    }
+
+    return hpx::local::finalize();
+}
+
+template <typename Scheduler>
+void test_scheduler(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=4"};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            [](hpx::threads::thread_pool_init_parameters thread_pool_init,
+                hpx::threads::policies::thread_queue_init_parameters
+                    thread_queue_init)
+                -> std::unique_ptr<hpx::threads::thread_pool_base> {
+                typename Scheduler::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, std::size_t(-1),
+                    thread_queue_init);
+                std::unique_ptr<Scheduler> scheduler(new Scheduler(init));
+
+                std::unique_ptr<hpx::threads::thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<Scheduler>(
+                        std::move(scheduler), thread_pool_init));
+
+                return pool;
+            });
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo,
+                hpx::threads::policies::sharded_bookkeeping<
+                    hpx::threads::policies::lockfree_fifo>>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_workrequesting_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo,
+                hpx::threads::policies::sharded_bookkeeping<
+                    hpx::threads::policies::lockfree_fifo>>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+#endif
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,139 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the work-requesting scheduler balances the tasks spawned by a
+// single worker while all other workers are idle: every task runs, the idle
+// workers steal tasks, and a steal request is answered with more than one
+// task on average.
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threadmanager.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+constexpr std::size_t num_tasks = 10000;
+
+std::atomic<std::size_t> count(0);
+
+void spawn_all(std::size_t num_workers, std::vector<std::size_t>& workers)
+{
+    // all tasks are placed onto the queue of the first worker
+    auto const exec = hpx::execution::experimental::with_hint(
+        hpx::execution::parallel_executor(),
+        hpx::threads::thread_schedule_hint(std::int16_t(0)));
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async(exec, [&workers, i, num_workers]() {
+            // keep the task busy for long enough to give the idle workers
+            // a chance to steal
+            hpx::chrono::high_resolution_timer t;
+            while (t.elapsed() < 20e-6)
+            {
+            }
+
+            std::size_t const worker = hpx::get_worker_thread_num();
+            HPX_TEST_LT(worker, num_workers);
+            workers[i] = worker;
+            ++count;
+        }));
+    }
+    hpx::wait_all(futures);
+}
+
+int hpx_main()
+{
+    std::size_t const num_workers = hpx::get_num_worker_threads();
+
+    count = 0;
+    std::vector<std::size_t> workers(num_tasks, std::size_t(-1));
+
+    // spawn the tasks from a task running on the first worker, all other
+    // workers are idle
+    auto const exec = hpx::execution::experimental::with_hint(
+        hpx::execution::parallel_executor(),
+        hpx::threads::thread_schedule_hint(std::int16_t(0)));
+    hpx::async(exec, &spawn_all, num_workers, std::ref(workers)).get();
+
+    HPX_TEST_EQ(count.load(), num_tasks);
+    HPX_TEST(std::find(workers.begin(), workers.end(), std::size_t(-1)) ==
+        workers.end());
+
+    if (num_workers > 1)
+    {
+        // some of the tasks were stolen by the other workers
+        HPX_TEST(std::find_if(workers.begin(), workers.end(),
+                     [](std::size_t worker) { return worker != 0; }) !=
+            workers.end());
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+        // the batch size is reported in units of 0.01 tasks
+        hpx::threads::thread_pool_base& pool =
+            hpx::resource::get_thread_pool("default");
+        HPX_TEST_LT(std::int64_t(100),
+            pool.get_average_steal_batch_size(std::size_t(-1), false));
+        HPX_TEST_LT(std::int64_t(100),
+            hpx::threads::get_thread_manager().get_average_steal_batch_size(
+                false));
+        HPX_TEST_LT(std::int64_t(0),
+            hpx::threads::get_thread_manager().get_average_steal_latency(
+                false));
+#endif
+    }
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy scheduler)
+{
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=" +
+        std::to_string(((std::min) (std::size_t(4),
+            std::size_t(hpx::threads::hardware_concurrency()))))};
+    init_args.rp_callback = [scheduler](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", scheduler);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    test_scheduler(argc, argv,
+        hpx::resource::scheduling_policy::local_workrequesting_fifo);
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    test_scheduler(argc, argv,
+        hpx::resource::scheduling_policy::local_workrequesting_lifo);
+#endif
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
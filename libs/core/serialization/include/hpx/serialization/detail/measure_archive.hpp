@@ -0,0 +1,84 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/detail/preprocess_container.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx::serialization::detail {
+
+    // The number of bytes and chunks an archive generates for a given set of
+    // objects.
+    struct archive_size
+    {
+        std::size_t size = 0;
+        std::size_t num_chunks = 0;
+    };
+
+    // Run the given function on a size-counting archive and return the exact
+    // size of the archive data (including the archive header) and the number
+    // of chunks it generates. The flags, the chunking mode, and the zero-copy
+    // threshold have to match the archive used for the actual serialization.
+    // All serialized types have to be trivially measurable (see
+    // traits::is_trivially_measurable).
+    template <typename F>
+    archive_size measure_archive(F&& f, std::uint32_t flags = 0U,
+        bool enable_chunking = false,
+        std::size_t zero_copy_serialization_threshold = 0)
+    {
+        // the counting chunker does not store any chunks
+        std::vector<serialization_chunk> chunks;
+
+        preprocess_container cont;
+        output_archive archive(cont, flags,
+            enable_chunking ? &chunks : nullptr, nullptr,
+            zero_copy_serialization_threshold);
+
+        f(archive);
+        archive.flush();
+
+        return archive_size{cont.size(), archive.get_num_chunks()};
+    }
+
+    // Serialize the objects written by the given function into the (empty)
+    // container in two passes: the first pass measures the archive data, the
+    // second pass writes into a container that was resized exactly once.
+    // Returns the number of bytes written to the archive.
+    template <typename Container, typename F>
+    std::size_t save_presized(Container& cont, F&& f, std::uint32_t flags = 0U,
+        std::vector<serialization_chunk>* chunks = nullptr,
+        std::size_t zero_copy_serialization_threshold = 0)
+    {
+        HPX_ASSERT(cont.empty());
+
+        archive_size const measured = measure_archive(
+            f, flags, chunks != nullptr, zero_copy_serialization_threshold);
+
+        cont.resize(measured.size);
+        if (chunks != nullptr)
+        {
+            chunks->reserve(measured.num_chunks);
+        }
+
+        output_archive archive(
+            cont, flags, chunks, nullptr, zero_copy_serialization_threshold);
+
+        f(archive);
+        archive.flush();
+
+        HPX_ASSERT(cont.size() == measured.size &&
+            archive.bytes_written() == measured.size);
+        return archive.bytes_written();
+    }
+}    // namespace hpx::serialization::detail
@@ -0,0 +1,68 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/serialization/detail/allow_zero_copy_receive.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace hpx::serialization::detail {
+
+    // An input archive tagged with this extra data refers to received
+    // (zero-copy) chunks that are kept alive by the stored owner. Objects
+    // de-serialized from such an archive can reference the chunk memory
+    // directly instead of copying it, as long as they share the ownership.
+    struct received_data_owner
+    {
+        std::shared_ptr<void> data_;
+    };
+
+    // Try to reference the next chunk of the given archive in place. Returns
+    // the address of the chunk data and the owner of the received memory, or
+    // a nullptr if the data has to be copied instead (the archive does not
+    // refer to received chunks, the data is not stored in a separate chunk,
+    // or the chunk is not suitably aligned for T).
+    template <typename T, typename Archive>
+    std::pair<T*, std::shared_ptr<void>> try_load_chunk_view(
+        Archive& ar, std::size_t count)
+    {
+        auto const* owner = ar.template try_get_extra_data<
+            detail::received_data_owner>();
+        if (owner == nullptr || owner->data_ == nullptr ||
+            ar.disable_array_optimization() || ar.endianess_differs() ||
+            ar.template try_get_extra_data<detail::allow_zero_copy_receive>() !=
+                nullptr)
+        {
+            return {nullptr, nullptr};
+        }
+
+        void* data = ar.load_binary_chunk_view(count * sizeof(T), alignof(T));
+        if (data == nullptr)
+        {
+            return {nullptr, nullptr};
+        }
+        return {static_cast<T*>(data), owner->data_};
+    }
+}    // namespace hpx::serialization::detail
+
+// This is explicitly instantiated to ensure that the id is stable across shared
+// libraries.
+template <>
+struct hpx::util::extra_data_helper<
+    hpx::serialization::detail::received_data_owner>
+{
+    HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+    static void reset(
+        serialization::detail::received_data_owner* owner) noexcept
+    {
+        owner->data_.reset();
+    }
+};
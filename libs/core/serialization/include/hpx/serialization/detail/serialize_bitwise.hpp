@@ -0,0 +1,89 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/config/defines.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/access.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_serializable.hpp>
+
+#include <type_traits>
+
+namespace hpx::serialization::detail {
+
+    // The elements of tuple-like types can be copied together with their
+    // enclosing object if they are bitwise serializable values that do not
+    // expose their own serialization functions. References (as used for
+    // brace-initializable structs) and const elements are always serialized
+    // element-wise.
+    template <typename T>
+    inline constexpr bool is_bitwise_element_v = !std::is_reference_v<T> &&
+        !std::is_const_v<T> && !access::has_serialize_v<T> &&
+        !hpx::traits::has_serialize_adl_v<T> &&
+        (hpx::traits::is_bitwise_serializable_v<T> ||
+            !hpx::traits::is_not_bitwise_serializable_v<T>);
+
+    // Returns false if the archive requires a portable, member-wise
+    // representation (array optimizations are disabled or the endianess
+    // differs), in which case nothing may be copied bitwise.
+    template <typename Archive>
+    bool supports_bitwise(Archive const& ar) noexcept
+    {
+#if !defined(HPX_SERIALIZATION_HAVE_ALL_TYPES_ARE_BITWISE_SERIALIZABLE)
+        return !(ar.disable_array_optimization() || ar.endianess_differs());
+#else
+        HPX_ASSERT(
+            !(ar.disable_array_optimization() || ar.endianess_differs()));
+        return true;
+#endif
+    }
+
+    // Copy the object representation of the given (bitwise serializable)
+    // object to or from the archive with a single operation.
+    template <typename Archive, typename T>
+    void serialize_binary(Archive& ar, T& t)
+    {
+        if constexpr (std::is_same_v<Archive, input_archive>)
+        {
+            ar.load_binary(&t, sizeof(T));
+        }
+        else
+        {
+            ar.save_binary(&t, sizeof(T));
+        }
+    }
+
+    // Copy the elements of a tuple of bitwise serializable values. The
+    // tuple itself is copied with a single operation only if it is
+    // trivially copyable, otherwise (as for std::tuple, which has
+    // user-provided assignment operators) the elements are copied one by
+    // one, which also keeps the padding between them off the wire. Returns
+    // false if the archive requires a portable representation, in which
+    // case nothing was serialized.
+    template <typename Archive, typename Tuple, typename... Ts>
+    bool serialize_bitwise(Archive& ar, Tuple& t, Ts&... elements)
+    {
+        if (!supports_bitwise(ar))
+        {
+            return false;
+        }
+
+        if constexpr (std::is_trivially_copyable_v<Tuple>)
+        {
+            serialize_binary(ar, t);
+        }
+        else
+        {
+            (serialize_binary(ar, elements), ...);
+        }
+        return true;
+    }
+}    // namespace hpx::serialization::detail
@@ -15,6 +15,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/serialization/access.hpp>
 #include <hpx/serialization/basic_archive.hpp>
+#include <hpx/serialization/brace_initializable.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 #include <hpx/serialization/detail/raw_ptr.hpp>
 #include <hpx/serialization/input_container.hpp>
@@ -143,8 +144,15 @@ namespace hpx::serialization {
 #if !defined(HPX_SERIALIZATION_HAVE_ALL_TYPES_ARE_BITWISE_SERIALIZABLE)
                     if (disable_array_optimization() || endianess_differs())
                     {
-                        access::serialize(*this, t, 0);
-                        return;
+                        // aggregates are portably serialized member by member,
+                        // other types can't be decomposed and are still copied
+                        if constexpr (std::is_class_v<T> &&
+                            std::is_aggregate_v<T> &&
+                            hpx::traits::has_struct_serialization_v<T>)
+                        {
+                            serialize_struct(*this, t, 0);
+                            return;
+                        }
                     }
 #else
                     HPX_ASSERT(
@@ -310,6 +318,24 @@ namespace hpx::serialization {
             size_ += count;
         }
 
+        // Return the address of the received data of the next chunk if the
+        // given number of bytes can be referenced in place (see
+        // detail::try_load_chunk_view), nullptr otherwise. Nothing is consumed
+        // from the archive if nullptr is returned.
+        [[nodiscard]] void* load_binary_chunk_view(
+            std::size_t count, std::size_t alignment)
+        {
+            if (HPX_UNLIKELY(0 == count || disable_data_chunking()))
+                return nullptr;
+
+            void* data = buffer_->load_binary_chunk_view(count, alignment);
+            if (data != nullptr)
+            {
+                size_ += count;
+            }
+            return data;
+        }
+
     private:
         std::unique_ptr<erased_input_container> buffer_;
     };
@@ -212,6 +212,47 @@ namespace hpx::serialization {
             }
         }
 
+        // Return the address of the received data of the next chunk without
+        // copying it, if possible. Returns nullptr (without consuming the
+        // chunk) if the data was not sent as a separate chunk or if the chunk
+        // data is not suitably aligned.
+        void* load_binary_chunk_view(
+            std::size_t count, std::size_t alignment) override
+        {
+            HPX_ASSERT(static_cast<std::int64_t>(count) >= 0);
+
+            if (chunks_ == nullptr ||
+                count < zero_copy_serialization_threshold_ ||
+                filter_ != nullptr)
+            {
+                return nullptr;
+            }
+
+            HPX_ASSERT(current_chunk_ != static_cast<std::size_t>(-1));
+            if (get_chunk_type(current_chunk_) !=
+                chunk_type::chunk_type_pointer)
+            {
+                return nullptr;
+            }
+
+            if (get_chunk_size(current_chunk_) != count)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "input_container::load_binary_chunk_view",
+                    "archive data bstream data chunk size mismatch");
+            }
+
+            void* buffer = get_chunk_data(current_chunk_).pos_;
+            if (buffer == nullptr ||
+                reinterpret_cast<std::uintptr_t>(buffer) % alignment != 0)
+            {
+                return nullptr;
+            }
+
+            ++current_chunk_;
+            return buffer;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -13,6 +13,7 @@
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_trivially_measurable.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -36,6 +37,20 @@ namespace hpx::traits {
             !is_bitwise_serializable_v<std::pair<Key, Value>>>
     {
     };
+
+    template <typename Key, typename Value>
+    struct is_trivially_measurable<std::pair<Key, Value>>
+      : std::integral_constant<bool,
+            is_trivially_measurable_v<Key> && is_trivially_measurable_v<Value>>
+    {
+    };
+
+    template <typename Key, typename Value, typename Compare,
+        typename Allocator>
+    struct is_trivially_measurable<std::map<Key, Value, Compare, Allocator>>
+      : is_trivially_measurable<std::pair<Key const, Value>>
+    {
+    };
 }    // namespace hpx::traits
 
 namespace hpx::serialization {
@@ -14,6 +14,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/serialization/access.hpp>
 #include <hpx/serialization/basic_archive.hpp>
+#include <hpx/serialization/brace_initializable.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 #include <hpx/serialization/detail/raw_ptr.hpp>
 #include <hpx/serialization/output_container.hpp>
@@ -242,8 +243,15 @@ namespace hpx::serialization {
 #if !defined(HPX_SERIALIZATION_HAVE_ALL_TYPES_ARE_BITWISE_SERIALIZABLE)
                     if (disable_array_optimization() || endianess_differs())
                     {
-                        access::serialize(*this, t, 0);
-                        return;
+                        // aggregates are portably serialized member by member,
+                        // other types can't be decomposed and are still copied
+                        if constexpr (std::is_class_v<T> &&
+                            std::is_aggregate_v<T> &&
+                            hpx::traits::has_struct_serialization_v<T>)
+                        {
+                            serialize_struct(*this, t, 0);
+                            return;
+                        }
                     }
 #else
                     HPX_ASSERT(
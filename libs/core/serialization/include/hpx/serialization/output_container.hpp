@@ -360,18 +360,13 @@ namespace hpx::serialization {
         std::size_t save_binary_chunk(
             void const* address, std::size_t count) override
         {
-            if (count < this->zero_copy_serialization_threshold_)
-            {
-                // fall back to serialization_chunk-less archive
-                HPX_ASSERT(count != 0);
-                filter_->save(address, count);
-                this->current_ += count;
-                return count;
-            }
-            else
-            {
-                return this->base_type::save_binary_chunk(address, count);
-            }
+            // All data has to pass through the filter, including large chunks
+            // that would otherwise be sent using zero-copy serialization. The
+            // receiving end reads all chunks through the filter as well.
+            HPX_ASSERT(count != 0);
+            filter_->save(address, count);
+            this->current_ += count;
+            return count;
         }
 
     protected:
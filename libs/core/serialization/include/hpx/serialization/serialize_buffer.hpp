@@ -12,6 +12,7 @@
 #include <hpx/modules/errors.hpp>
 
 #include <hpx/serialization/array.hpp>
+#include <hpx/serialization/detail/received_data_owner.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/serialize_buffer_fwd.hpp>
@@ -22,6 +23,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 
 namespace hpx::serialization {
 
@@ -390,6 +392,23 @@ namespace hpx::serialization {
         {
             ar >> size_ >> alloc_;    // -V128
 
+            // reference the received data in place, if possible (buffers with
+            // custom allocators always own their memory)
+            if constexpr (std::is_same_v<allocator_type, std::allocator<T>>)
+            {
+                if (size_ != 0)
+                {
+                    auto [data, owner] =
+                        detail::try_load_chunk_view<T>(ar, size_);
+                    if (data != nullptr)
+                    {
+                        data_ = buffer_type(
+                            data, [owner = HPX_MOVE(owner)](T*) noexcept {});
+                        return;
+                    }
+                }
+            }
+
             data_ = buffer_type(
                 detail::array_allocator<allocator_type>()(alloc_, size_),
                 [alloc = this->alloc_, size = this->size_](T* p) noexcept {
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <hpx/modules/type_support.hpp>
+#include <hpx/serialization/detail/serialize_bitwise.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
@@ -57,6 +58,12 @@ namespace hpx::serialization {
                     ...);
 #endif
             }
+
+            static bool call_bitwise(Archive& ar, std::tuple<Ts...>& t)
+            {
+                return hpx::serialization::detail::serialize_bitwise(
+                    ar, t, std::get<Is>(t)...);
+            }
         };
     }    // namespace detail
 
@@ -64,6 +71,20 @@ namespace hpx::serialization {
     void serialize(Archive& ar, std::tuple<Ts...>& t, unsigned int version)
     {
         using Is = hpx::util::make_index_pack_t<sizeof...(Ts)>;
+
+        // copy tuples of bitwise serializable values bitwise
+        constexpr bool optimized =
+            (detail::is_bitwise_element_v<Ts> && ...);
+
+        if constexpr (optimized)
+        {
+            if (detail::std_serialize_with_index_pack<Archive, Is,
+                    Ts...>::call_bitwise(ar, t))
+            {
+                return;
+            }
+        }
+
         detail::std_serialize_with_index_pack<Archive, Is, Ts...>::call(
             ar, t, version);
     }
@@ -8,9 +8,20 @@
 
 #include <hpx/config.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/traits/is_trivially_measurable.hpp>
 
 #include <cstdint>
 #include <string>
+#include <type_traits>
+
+namespace hpx::traits {
+
+    template <typename Char, typename CharTraits, typename Allocator>
+    struct is_trivially_measurable<
+        std::basic_string<Char, CharTraits, Allocator>> : std::true_type
+    {
+    };
+}    // namespace hpx::traits
 
 namespace hpx::serialization {
 
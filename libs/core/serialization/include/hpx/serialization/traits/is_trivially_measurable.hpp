@@ -0,0 +1,38 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+
+#include <type_traits>
+
+namespace hpx::traits {
+
+    // This trait specifies whether the archive size of an object of the given
+    // type can be measured up front by running it through a size-counting
+    // archive (see serialization::detail::measure_archive). Serializing such
+    // types into a preprocessing archive must not have side effects (as it has
+    // for futures or id_types) and must produce the same number of bytes as
+    // the real serialization. Bitwise serializable types and the standard
+    // containers of those are measurable.
+    template <typename T, typename Enable = void>
+    struct is_trivially_measurable
+      : std::integral_constant<bool,
+            is_bitwise_serializable_v<T> && !std::is_pointer_v<T>>
+    {
+    };
+
+    template <typename T>
+    struct is_trivially_measurable<T const> : is_trivially_measurable<T>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_trivially_measurable_v =
+        is_trivially_measurable<T>::value;
+}    // namespace hpx::traits
@@ -16,12 +16,22 @@
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_trivially_measurable.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <vector>
 
+namespace hpx::traits {
+
+    template <typename T, typename Allocator>
+    struct is_trivially_measurable<std::vector<T, Allocator>>
+      : is_trivially_measurable<T>
+    {
+    };
+}    // namespace hpx::traits
+
 namespace hpx::serialization {
 
     template <typename Allocator>
@@ -0,0 +1,164 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/detail/received_data_owner.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_trivially_measurable.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A read-only, contiguous sequence of trivially copyable elements that
+    // can be used as an action argument. On the sending side the view either
+    // references existing memory (which has to stay valid until the parcel
+    // was sent) or owns the data it was constructed from. On the receiving
+    // side, a view that was sent as a separate (zero-copy) chunk references
+    // the received chunk in place and keeps the received memory alive instead
+    // of copying the data into a newly allocated buffer. If the data cannot be
+    // referenced in place (small sizes, no chunking, mismatched alignment) it
+    // is copied into memory owned by the view.
+    template <typename T>
+    class zero_copy_view
+    {
+        static_assert(std::is_trivially_copyable_v<T> &&
+                std::is_default_constructible_v<T> && !std::is_const_v<T>,
+            "zero_copy_view requires a non-const, trivially copyable, and "
+            "default constructible element type");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using const_iterator = T const*;
+        using iterator = const_iterator;
+
+        constexpr zero_copy_view() noexcept = default;
+
+        // reference the given data, the caller has to keep it alive
+        constexpr zero_copy_view(T const* data, std::size_t size) noexcept
+          : data_(data)
+          , size_(size)
+        {
+        }
+
+        // take ownership of the given data
+        explicit zero_copy_view(std::vector<T>&& data)
+          : size_(data.size())
+        {
+            auto owner = std::make_shared<std::vector<T>>(HPX_MOVE(data));
+            data_ = owner->data();
+            owner_ = HPX_MOVE(owner);
+        }
+
+        [[nodiscard]] constexpr T const* data() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] constexpr const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] constexpr const_iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        [[nodiscard]] constexpr T const& operator[](
+            std::size_t idx) const noexcept
+        {
+            HPX_ASSERT(idx < size_);
+            return data_[idx];
+        }
+
+        // Return whether this view shares the ownership of the memory it
+        // refers to (as opposed to referencing memory owned by the caller).
+        [[nodiscard]] bool owns_data() const noexcept
+        {
+            return owner_ != nullptr;
+        }
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void save(Archive& ar, unsigned int const) const
+        {
+            ar << size_;
+            if (size_ != 0)
+            {
+                ar << hpx::serialization::make_array(data_, size_);
+            }
+        }
+
+        template <typename Archive>
+        void load(Archive& ar, unsigned int const)
+        {
+            ar >> size_;
+
+            data_ = nullptr;
+            owner_.reset();
+
+            if (size_ == 0)
+            {
+                return;
+            }
+
+            // reference the received data in place, if possible
+            auto [data, owner] = detail::try_load_chunk_view<T>(ar, size_);
+            if (data != nullptr)
+            {
+                data_ = data;
+                owner_ = HPX_MOVE(owner);
+                return;
+            }
+
+            auto storage = std::make_shared<std::vector<T>>(size_);
+            ar >> hpx::serialization::make_array(storage->data(), size_);
+
+            data_ = storage->data();
+            owner_ = HPX_MOVE(storage);
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+        T const* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::shared_ptr<void> owner_;
+    };
+}    // namespace hpx::serialization
+
+namespace hpx::traits {
+
+    template <typename T>
+    struct is_trivially_measurable<serialization::zero_copy_view<T>>
+      : std::true_type
+    {
+    };
+}    // namespace hpx::traits
@@ -0,0 +1,116 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the throughput of serializing trivially copyable
+// aggregates, tuples, and vectors of those member by member (as done if the
+// archive requires a portable representation) with the throughput of copying
+// them bitwise (tuples are copied element by element, without the padding).
+
+#include <hpx/modules/format.hpp>
+#include <hpx/serialization/brace_initializable.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/std_tuple.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+struct particle
+{
+    double x, y, z;
+    double vx, vy, vz;
+    float mass;
+    std::int32_t id;
+};
+
+template <typename T>
+double measure(T const& value, std::uint32_t flags, std::size_t iterations,
+    std::size_t& size)
+{
+    auto const start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::vector<char> buffer;
+        {
+            hpx::serialization::output_archive archive(buffer, flags);
+            archive << value;
+            size = archive.bytes_written();
+        }
+
+        T loaded;
+        hpx::serialization::input_archive archive(buffer, size);
+        archive >> loaded;
+    }
+    return std::chrono::duration<double>(
+        std::chrono::high_resolution_clock::now() - start)
+        .count();
+}
+
+template <typename T>
+void measure_throughput(
+    char const* name, T const& value, std::size_t iterations)
+{
+    std::size_t size = 0;
+
+    // member-wise serialization
+    double const per_field_time = measure(value,
+        static_cast<std::uint32_t>(
+            hpx::serialization::archive_flags::disable_array_optimization),
+        iterations, size);
+
+    // serialization of the whole objects
+    double const bulk_time = measure(value, 0, iterations, size);
+
+    double const megabytes =
+        static_cast<double>(size * iterations) / (1024.0 * 1024.0);
+
+    std::cout << hpx::util::format(
+        "{}: size = {} bytes, per-field = {:.2f} MB/s, bulk = {:.2f} MB/s\n",
+        name, size, megabytes / per_field_time, megabytes / bulk_time);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "usage: " << argv[0] << " N";
+        std::cout << std::endl << std::endl;
+        std::cout << "arguments: " << std::endl;
+        std::cout << " N  -- number of iterations" << std::endl << std::endl;
+        return 0;
+    }
+
+    std::size_t iterations;
+    try
+    {
+        iterations = hpx::util::from_string<std::size_t>(argv[1]);
+    }
+    catch (std::exception& exc)
+    {
+        std::cerr << "Error: " << exc.what() << std::endl;
+        std::cerr << "First positional argument must be an integer."
+                  << std::endl;
+        return -1;
+    }
+
+    particle const p{1.0, 2.0, 3.0, 0.1, 0.2, 0.3, 42.0f, 7};
+
+    measure_throughput("particle", p, 100 * iterations);
+    measure_throughput("tuple<double, double, double, int>",
+        std::tuple<double, double, double, int>(1.0, 2.0, 3.0, 4),
+        100 * iterations);
+    measure_throughput(
+        "vector<particle>", std::vector<particle>(1 << 14, p), iterations);
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the throughput of serializing vectors, maps, and
+// strings into a container that grows while the data is written with the
+// throughput of measuring the data first and writing it into a container that
+// is allocated only once.
+
+#include <hpx/modules/format.hpp>
+#include <hpx/serialization/detail/measure_archive.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+template <typename T>
+void measure_throughput(
+    char const* name, T const& value, std::size_t iterations)
+{
+    auto const f = [&](hpx::serialization::output_archive& archive) {
+        archive << value;
+    };
+
+    std::size_t size = 0;
+
+    // let the container grow while writing
+    auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::vector<char> buffer;
+        hpx::serialization::output_archive archive(buffer);
+        f(archive);
+        archive.flush();
+        size = buffer.size();
+    }
+    double const grow_time = std::chrono::duration<double>(
+        std::chrono::high_resolution_clock::now() - start)
+                                 .count();
+
+    // measure first, then write into an exactly sized container
+    start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::vector<char> buffer;
+        hpx::serialization::detail::save_presized(buffer, f);
+    }
+    double const presized_time = std::chrono::duration<double>(
+        std::chrono::high_resolution_clock::now() - start)
+                                     .count();
+
+    double const megabytes =
+        static_cast<double>(size * iterations) / (1024.0 * 1024.0);
+
+    std::cout << hpx::util::format(
+        "{}: size = {} bytes, grow = {:.2f} MB/s, presized = {:.2f} MB/s\n",
+        name, size, megabytes / grow_time, megabytes / presized_time);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "usage: " << argv[0] << " N";
+        std::cout << std::endl << std::endl;
+        std::cout << "arguments: " << std::endl;
+        std::cout << " N  -- number of iterations" << std::endl << std::endl;
+        return 0;
+    }
+
+    std::size_t iterations;
+    try
+    {
+        iterations = hpx::util::from_string<std::size_t>(argv[1]);
+    }
+    catch (std::exception& exc)
+    {
+        std::cerr << "Error: " << exc.what() << std::endl;
+        std::cerr << "First positional argument must be an integer."
+                  << std::endl;
+        return -1;
+    }
+
+    measure_throughput(
+        "vector<double>", std::vector<double>(1 << 16, 1.0), iterations);
+
+    measure_throughput("vector<string>",
+        std::vector<std::string>(1 << 10, std::string(64, 'x')), iterations);
+
+    std::map<std::int64_t, std::string> m;
+    for (std::int64_t i = 0; i != (1 << 10); ++i)
+    {
+        m[i] = std::string(static_cast<std::size_t>(i % 128), 'y');
+    }
+    measure_throughput("map<int, string>", m, iterations);
+
+    measure_throughput("string", std::string(1 << 16, 'z'), iterations);
+
+    return 0;
+}
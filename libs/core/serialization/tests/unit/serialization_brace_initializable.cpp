@@ -9,6 +9,7 @@
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstdint>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -77,8 +78,51 @@ bool operator==(const B& b1, const B& b2)
     return std::tie(b1.a, b1.sign) == std::tie(b2.a, b2.sign);
 }
 
+// trivially copyable aggregates are copied as a whole, unless the archive
+// requires a portable (member-wise) representation
+struct C
+{
+    double floating_number;
+    int int_number;
+    char sign;
+};
+
+static_assert(hpx::traits::is_bitwise_serializable_v<C>,
+    "hpx::traits::is_bitwise_serializable_v<C>");
+static_assert(hpx::traits::has_struct_serialization<C>::value,
+    "has_struct_serialization<C>::value");
+
+bool operator==(const C& c1, const C& c2)
+{
+    return std::tie(c1.floating_number, c1.int_number, c1.sign) ==
+        std::tie(c2.floating_number, c2.int_number, c2.sign);
+}
+
+void test_bitwise(std::uint32_t flags)
+{
+    std::vector<char> buf;
+    hpx::serialization::output_archive oar(buf, flags);
+
+    C c{1234.8281, -1919, 'u'};
+    std::vector<C> cs(100, c);
+    oar << c << cs;
+
+    hpx::serialization::input_archive iar(buf, oar.bytes_written());
+
+    C deserialized_c;
+    std::vector<C> deserialized_cs;
+    iar >> deserialized_c >> deserialized_cs;
+
+    HPX_TEST(c == deserialized_c);
+    HPX_TEST(cs == deserialized_cs);
+}
+
 int main()
 {
+    test_bitwise(0);
+    test_bitwise(static_cast<std::uint32_t>(
+        hpx::serialization::archive_flags::disable_array_optimization));
+
     std::vector<char> buf;
     hpx::serialization::output_archive oar(buf);
     hpx::serialization::input_archive iar(buf);
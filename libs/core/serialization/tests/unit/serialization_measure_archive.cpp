@@ -0,0 +1,99 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/detail/measure_archive.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/traits/is_trivially_measurable.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using hpx::serialization::output_archive;
+using hpx::serialization::serialization_chunk;
+
+static_assert(hpx::traits::is_trivially_measurable_v<double>);
+static_assert(hpx::traits::is_trivially_measurable_v<std::string>);
+static_assert(hpx::traits::is_trivially_measurable_v<std::vector<double>>);
+static_assert(
+    hpx::traits::is_trivially_measurable_v<std::map<int, std::string>>);
+static_assert(hpx::traits::is_trivially_measurable_v<
+    std::vector<std::vector<std::string>>>);
+static_assert(!hpx::traits::is_trivially_measurable_v<std::shared_ptr<int>>);
+static_assert(
+    !hpx::traits::is_trivially_measurable_v<std::vector<std::shared_ptr<int>>>);
+
+template <typename T>
+void test_measure(T const& value, bool enable_chunking)
+{
+    std::size_t const threshold = 128;
+    auto const f = [&](output_archive& archive) { archive << value; };
+
+    auto const measured = hpx::serialization::detail::measure_archive(
+        f, 0, enable_chunking, threshold);
+
+    std::vector<char> buffer;
+    std::vector<serialization_chunk> chunks;
+    {
+        output_archive archive(buffer, 0,
+            enable_chunking ? &chunks : nullptr, nullptr, threshold);
+        f(archive);
+        archive.flush();
+
+        HPX_TEST_EQ(measured.num_chunks, archive.get_num_chunks());
+    }
+    HPX_TEST_EQ(measured.size, buffer.size());
+
+    // serializing into a pre-sized buffer creates the same archive data
+    std::vector<char> presized_buffer;
+    std::vector<serialization_chunk> presized_chunks;
+    hpx::serialization::detail::save_presized(presized_buffer, f, 0,
+        enable_chunking ? &presized_chunks : nullptr, threshold);
+
+    HPX_TEST(buffer == presized_buffer);
+    HPX_TEST_EQ(chunks.size(), presized_chunks.size());
+
+    if (!enable_chunking)
+    {
+        T loaded;
+        hpx::serialization::input_archive archive(presized_buffer);
+        archive >> loaded;
+        HPX_TEST(value == loaded);
+    }
+}
+
+template <typename T>
+void test_measure(T const& value)
+{
+    test_measure(value, false);
+    test_measure(value, true);
+}
+
+int main()
+{
+    test_measure(42.0);
+    test_measure(std::string("measure then write"));
+    test_measure(std::vector<double>(1000, 1.0));
+    test_measure(std::vector<std::string>(10, std::string(200, 'x')));
+
+    std::map<int, std::string> m;
+    for (int i = 0; i != 100; ++i)
+    {
+        m[i] = std::string(i, 'y');
+    }
+    test_measure(m);
+
+    return hpx::util::report_errors();
+}
@@ -81,8 +81,38 @@ void test()
     }
 }
 
+// tuples of bitwise serializable values are copied bitwise unless the
+// archive requires a portable representation, the padding between the
+// elements is not written
+void test_bitwise(std::uint32_t flags)
+{
+    std::tuple<int, double, char, std::uint64_t> ot{42, 42.0, 'x', 4242};
+
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer, flags);
+    oarchive << ot;
+    std::size_t size = oarchive.bytes_written();
+
+    {
+        std::vector<char> elements_buffer;
+        hpx::serialization::output_archive elements_archive(
+            elements_buffer, flags);
+        elements_archive << std::get<0>(ot) << std::get<1>(ot)
+                         << std::get<2>(ot) << std::get<3>(ot);
+        HPX_TEST_EQ(size, elements_archive.bytes_written());
+    }
+
+    hpx::serialization::input_archive iarchive(buffer, size);
+    std::tuple<int, double, char, std::uint64_t> it;
+    iarchive >> it;
+    HPX_TEST(ot == it);
+}
+
 int main()
 {
     test();
+    test_bitwise(0);
+    test_bitwise(static_cast<std::uint32_t>(
+        hpx::serialization::archive_flags::disable_array_optimization));
     return hpx::util::report_errors();
 }
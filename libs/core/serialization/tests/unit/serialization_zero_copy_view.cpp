@@ -0,0 +1,168 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/detail/received_data_owner.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/zero_copy_view.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using hpx::serialization::chunk_type;
+using hpx::serialization::input_archive;
+using hpx::serialization::output_archive;
+using hpx::serialization::serialization_chunk;
+using hpx::serialization::zero_copy_view;
+
+constexpr std::size_t threshold = 128;
+
+// Emulate a parcelport that receives all zero-copy chunks into separately
+// allocated buffers: copy the chunk data and let the chunks refer to the copy.
+std::shared_ptr<std::vector<std::vector<double>>> receive_chunks(
+    std::vector<serialization_chunk>& chunks)
+{
+    auto received = std::make_shared<std::vector<std::vector<double>>>();
+    received->reserve(chunks.size());
+    for (auto& c : chunks)
+    {
+        if (c.type_ == chunk_type::chunk_type_pointer)
+        {
+            auto& data = received->emplace_back(c.size_ / sizeof(double));
+            std::memcpy(data.data(), c.data_.cpos_, c.size_);
+            c = hpx::serialization::create_pointer_chunk(data.data(), c.size_);
+        }
+    }
+    return received;
+}
+
+template <typename T>
+void save(T const& value, std::vector<char>& buffer,
+    std::vector<serialization_chunk>* chunks)
+{
+    output_archive oarchive(buffer, 0, chunks, nullptr, threshold);
+    oarchive << value;
+    oarchive.flush();
+}
+
+void test_copy(std::size_t size)
+{
+    std::vector<double> data(size);
+    std::iota(data.begin(), data.end(), 0.0);
+
+    std::vector<char> buffer;
+    save(zero_copy_view<double>(data.data(), data.size()), buffer, nullptr);
+
+    zero_copy_view<double> view;
+    {
+        input_archive iarchive(buffer, buffer.size());
+        iarchive >> view;
+    }
+
+    HPX_TEST_EQ(view.size(), size);
+    HPX_TEST(std::equal(data.begin(), data.end(), view.begin(), view.end()));
+    HPX_TEST(size == 0 || view.owns_data());
+}
+
+void test_view()
+{
+    std::vector<double> data(1000);
+    std::iota(data.begin(), data.end(), 0.0);
+
+    std::vector<char> buffer;
+    std::vector<serialization_chunk> chunks;
+    zero_copy_view<double> const sent{std::vector<double>(data)};
+    HPX_TEST(sent.owns_data());
+    save(sent, buffer, &chunks);
+
+    auto received = receive_chunks(chunks);
+    HPX_TEST_EQ(received->size(), static_cast<std::size_t>(1));
+    double const* received_data = (*received)[0].data();
+
+    zero_copy_view<double> view;
+    {
+        input_archive iarchive(buffer, buffer.size(), &chunks);
+        iarchive
+            .get_extra_data<
+                hpx::serialization::detail::received_data_owner>()
+            .data_ = HPX_MOVE(received);
+        iarchive >> view;
+    }
+
+    // the view references the received chunk and keeps it alive
+    HPX_TEST_EQ(view.data(), received_data);
+    HPX_TEST(view.owns_data());
+    HPX_TEST(std::equal(data.begin(), data.end(), view.begin(), view.end()));
+}
+
+void test_serialize_buffer_view()
+{
+    using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+    std::vector<double> data(1000);
+    std::iota(data.begin(), data.end(), 0.0);
+
+    std::vector<char> buffer;
+    std::vector<serialization_chunk> chunks;
+    save(buffer_type(data.data(), data.size(), buffer_type::reference), buffer,
+        &chunks);
+
+    auto received = receive_chunks(chunks);
+    double const* received_data = (*received)[0].data();
+
+    buffer_type loaded;
+    {
+        input_archive iarchive(buffer, buffer.size(), &chunks);
+        iarchive
+            .get_extra_data<
+                hpx::serialization::detail::received_data_owner>()
+            .data_ = HPX_MOVE(received);
+        iarchive >> loaded;
+    }
+
+    HPX_TEST_EQ(static_cast<double const*>(loaded.data()), received_data);
+    HPX_TEST(std::equal(data.begin(), data.end(), loaded.begin(), loaded.end()));
+}
+
+void test_no_owner()
+{
+    // without an owner for the received data the view copies the data
+    std::vector<double> data(1000, 42.0);
+
+    std::vector<char> buffer;
+    std::vector<serialization_chunk> chunks;
+    save(zero_copy_view<double>(data.data(), data.size()), buffer, &chunks);
+
+    zero_copy_view<double> view;
+    {
+        input_archive iarchive(buffer, buffer.size(), &chunks);
+        iarchive >> view;
+    }
+
+    HPX_TEST_NEQ(view.data(), static_cast<double const*>(data.data()));
+    HPX_TEST(std::equal(data.begin(), data.end(), view.begin(), view.end()));
+}
+
+int main()
+{
+    test_copy(0);
+    test_copy(10);
+    test_copy(1000);
+
+    test_view();
+    test_serialize_buffer_view();
+    test_no_owner();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,155 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads {
+
+    /// Tuning parameters of an \a elastic_pool_controller.
+    ///
+    /// Processing units are suspended one at a time after the pool has had
+    /// idle processing units for \a suspend_after consecutive samples, while
+    /// suspended processing units are resumed (as many as needed to work off
+    /// the backlog) after \a resume_after consecutive samples showing a
+    /// backlog. Choosing \a suspend_after much larger than \a resume_after
+    /// gives the hysteresis that prevents the pool from oscillating.
+    struct elasticity_parameters
+    {
+        /// Interval at which the controller samples the state of the pool.
+        std::chrono::microseconds sampling_interval{1000};
+
+        /// The controller does not suspend processing units if this would
+        /// leave fewer processing units running.
+        std::size_t min_active_processing_units = 1;
+
+        /// Number of consecutive samples the pool has to have idle
+        /// processing units before one of them is suspended.
+        std::size_t suspend_after = 100;
+
+        /// Number of consecutive samples showing a backlog before suspended
+        /// processing units are resumed.
+        std::size_t resume_after = 1;
+
+        /// Number of pending HPX threads per running processing unit above
+        /// which the pool is considered to have a backlog.
+        std::size_t backlog_per_processing_unit = 2;
+
+        /// Fraction of the sampling interval a processing unit may spend
+        /// running background work (e.g., network progress) while still
+        /// being considered idle. This is used only if HPX was configured
+        /// with HPX_WITH_BACKGROUND_THREAD_COUNTERS and
+        /// HPX_WITH_THREAD_IDLE_RATES.
+        double max_background_work = 0.1;
+    };
+
+    /// An elastic_pool_controller adapts the number of running processing
+    /// units of a thread pool to its load. It periodically samples the
+    /// length of the queues and the idle state of the processing units of
+    /// the pool, suspends processing units that stay idle (leaving the cores
+    /// to other processes and allowing them to enter power saving states),
+    /// and resumes them as soon as HPX threads start to queue up.
+    ///
+    /// The controller runs on a separate OS thread, it does not occupy a
+    /// processing unit of the controlled pool. Only processing units
+    /// suspended by the controller itself are resumed by it, all of those
+    /// are resumed when the controller is stopped.
+    ///
+    /// \note Requires that the pool has
+    ///       threads::policies::enable_elasticity set. The controller has to
+    ///       be stopped (or destroyed) before the runtime is stopped.
+    class HPX_CORE_EXPORT elastic_pool_controller
+    {
+    public:
+        /// Start controlling the given thread pool.
+        ///
+        /// \param pool   [in] The thread pool to control.
+        /// \param params [in] The parameters controlling when processing
+        ///               units are suspended and resumed.
+        ///
+        /// \throws hpx::exception if the pool does not support suspending
+        ///         processing units.
+        explicit elastic_pool_controller(thread_pool_base& pool,
+            elasticity_parameters const& params = elasticity_parameters());
+
+        elastic_pool_controller(elastic_pool_controller const&) = delete;
+        elastic_pool_controller(elastic_pool_controller&&) = delete;
+        elastic_pool_controller& operator=(
+            elastic_pool_controller const&) = delete;
+        elastic_pool_controller& operator=(elastic_pool_controller&&) = delete;
+
+        ~elastic_pool_controller();
+
+        /// Stop controlling the pool and resume all processing units that
+        /// were suspended by the controller.
+        void stop();
+
+        /// Return the number of processing units currently suspended by the
+        /// controller.
+        std::size_t get_num_suspended_processing_units() const noexcept
+        {
+            return num_suspended_.load(std::memory_order_relaxed);
+        }
+
+        /// Return how many times the controller has suspended a processing
+        /// unit.
+        std::size_t get_num_suspensions() const noexcept
+        {
+            return num_suspensions_.load(std::memory_order_relaxed);
+        }
+
+        /// Return how many times the controller has resumed a processing
+        /// unit.
+        std::size_t get_num_resumptions() const noexcept
+        {
+            return num_resumptions_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void run();
+        void sample();
+
+        void suspend(std::size_t virt_core);
+        void resume(std::size_t count);
+        void resume_all();
+
+        thread_pool_base& pool_;
+        elasticity_parameters const params_;
+
+        // the following are accessed by the controller thread only
+        std::vector<char> suspended_;
+        std::size_t idle_samples_ = 0;
+        std::size_t backlog_samples_ = 0;
+#if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
+    defined(HPX_HAVE_THREAD_IDLE_RATES)
+        std::vector<std::int64_t> background_work_;
+#endif
+
+        std::atomic<std::size_t> num_suspended_ = 0;
+        std::atomic<std::size_t> num_suspensions_ = 0;
+        std::atomic<std::size_t> num_resumptions_ = 0;
+
+        std::mutex mtx_;
+        std::condition_variable cond_;
+        bool stop_requested_ = false;
+        std::thread thread_;
+    };
+}    // namespace hpx::threads
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,228 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/thread_pool_util/elastic_pool_controller.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace hpx::threads {
+
+    elastic_pool_controller::elastic_pool_controller(
+        thread_pool_base& pool, elasticity_parameters const& params)
+      : pool_(pool)
+      , params_(params)
+      , suspended_(pool.get_os_thread_count(), 0)
+#if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
+    defined(HPX_HAVE_THREAD_IDLE_RATES)
+      , background_work_(pool.get_os_thread_count(), 0)
+#endif
+    {
+        if (!pool_.get_scheduler()->has_scheduler_mode(
+                policies::scheduler_mode::enable_elasticity))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "elastic_pool_controller::elastic_pool_controller",
+                "this thread pool does not support suspending processing "
+                "units");
+        }
+
+        if (params_.sampling_interval.count() <= 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "elastic_pool_controller::elastic_pool_controller",
+                "the sampling interval must be positive");
+        }
+
+#if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
+    defined(HPX_HAVE_THREAD_IDLE_RATES)
+        for (std::size_t i = 0; i != background_work_.size(); ++i)
+        {
+            background_work_[i] = pool_.get_background_work_duration(i, false);
+        }
+#endif
+
+        thread_ = std::thread(&elastic_pool_controller::run, this);
+    }
+
+    elastic_pool_controller::~elastic_pool_controller()
+    {
+        stop();
+    }
+
+    void elastic_pool_controller::stop()
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            stop_requested_ = true;
+        }
+        cond_.notify_all();
+
+        if (thread_.joinable())
+        {
+            thread_.join();
+        }
+    }
+
+    void elastic_pool_controller::run()
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+        while (!cond_.wait_for(l, params_.sampling_interval,
+            [this]() { return stop_requested_; }))
+        {
+            l.unlock();
+            sample();
+            l.lock();
+        }
+        l.unlock();
+
+        // leave the pool the way we found it
+        resume_all();
+    }
+
+    void elastic_pool_controller::sample()
+    {
+        std::size_t const num_threads = suspended_.size();
+
+        mask_type idle_mask = mask_type();
+        resize(idle_mask, num_threads);
+        pool_.get_idle_core_mask(idle_mask);
+
+#if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
+    defined(HPX_HAVE_THREAD_IDLE_RATES)
+        auto const interval = std::chrono::duration_cast<
+            std::chrono::nanoseconds>(params_.sampling_interval)
+                                  .count();
+        auto const max_background_work = static_cast<std::int64_t>(
+            params_.max_background_work * static_cast<double>(interval));
+#endif
+
+        // Find the running processing units and pick the one with the highest
+        // index among those that are idle as the candidate to be suspended.
+        std::size_t running = 0;
+        std::size_t candidate = num_threads;
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            if (pool_.get_state(i) != hpx::state::running)
+            {
+                continue;
+            }
+            ++running;
+
+            bool idle = test(idle_mask, i);
+
+#if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
+    defined(HPX_HAVE_THREAD_IDLE_RATES)
+            // a processing unit that is busy driving background work (e.g.
+            // network progress) is not idle, even if it has no HPX threads
+            std::int64_t const background_work =
+                pool_.get_background_work_duration(i, false);
+            if (background_work - background_work_[i] > max_background_work)
+            {
+                idle = false;
+            }
+            background_work_[i] = background_work;
+#endif
+
+            if (idle)
+            {
+                candidate = i;
+            }
+        }
+
+        std::size_t const backlog_per_pu =
+            (std::max) (params_.backlog_per_processing_unit, std::size_t(1));
+        std::int64_t const queue_length =
+            pool_.get_queue_length(std::size_t(-1), false);
+        std::size_t const backlog =
+            queue_length > 0 ? static_cast<std::size_t>(queue_length) : 0;
+
+        if (backlog > backlog_per_pu * running)
+        {
+            idle_samples_ = 0;
+            if (num_suspended_.load(std::memory_order_relaxed) != 0 &&
+                ++backlog_samples_ >= params_.resume_after)
+            {
+                // resume as many processing units as needed to bring the
+                // backlog per running processing unit below the threshold
+                std::size_t const excess = backlog - backlog_per_pu * running;
+                resume((excess + backlog_per_pu - 1) / backlog_per_pu);
+                backlog_samples_ = 0;
+            }
+        }
+        else if (candidate != num_threads &&
+            running > params_.min_active_processing_units)
+        {
+            backlog_samples_ = 0;
+            if (++idle_samples_ >= params_.suspend_after)
+            {
+                // suspend a single processing unit at a time, this gives
+                // the pool a chance to pick up new work before it shrinks
+                // any further
+                suspend(candidate);
+                idle_samples_ = 0;
+            }
+        }
+        else
+        {
+            idle_samples_ = 0;
+            backlog_samples_ = 0;
+        }
+    }
+
+    void elastic_pool_controller::suspend(std::size_t virt_core)
+    {
+        error_code ec(throwmode::lightweight);
+        pool_.suspend_processing_unit_direct(virt_core, ec);
+        if (ec)
+        {
+            return;
+        }
+
+        suspended_[virt_core] = 1;
+        ++num_suspended_;
+        ++num_suspensions_;
+    }
+
+    void elastic_pool_controller::resume(std::size_t count)
+    {
+        // prefer resuming the processing units with the lowest index, those
+        // are the ones suspended last
+        for (std::size_t i = 0; count != 0 && i != suspended_.size(); ++i)
+        {
+            if (!suspended_[i])
+            {
+                continue;
+            }
+
+            error_code ec(throwmode::lightweight);
+            pool_.resume_processing_unit_direct(i, ec);
+            if (ec)
+            {
+                continue;
+            }
+
+            suspended_[i] = 0;
+            --num_suspended_;
+            ++num_resumptions_;
+            --count;
+        }
+    }
+
+    void elastic_pool_controller::resume_all()
+    {
+        resume(suspended_.size());
+    }
+}    // namespace hpx::threads
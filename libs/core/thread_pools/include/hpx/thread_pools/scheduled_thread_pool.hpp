@@ -225,6 +225,30 @@ namespace hpx::threads::detail {
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_cumulative_steal_latency(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_cumulative_steal_latency(num, reset);
+        }
+
+        std::int64_t get_num_steal_latency_samples(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_latency_samples(
+                num, reset);
+        }
+
+        std::int64_t get_num_stolen_tasks(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_tasks(num, reset);
+        }
+
+        std::int64_t get_num_steal_batches(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_batches(num, reset);
+        }
 #endif
         std::int64_t get_queue_length(
             std::size_t num_thread, bool /* reset */) override
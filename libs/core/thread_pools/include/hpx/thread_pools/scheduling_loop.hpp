@@ -18,6 +18,7 @@
 #include <hpx/threading_base/detail/switch_status.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/set_thread_state_timed.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
 #if defined(HPX_HAVE_ITTNOTIFY) && HPX_HAVE_ITTNOTIFY != 0 &&                  \
@@ -178,6 +179,12 @@ namespace hpx::threads::detail {
 
                 may_exit = false;
 
+                // make sure timers expire even if this thread is never idle
+                if (use_timer_wheel && busy_loop_count % 64 == 0)
+                {
+                    expire_timers();
+                }
+
                 // Only pending HPX threads will be executed. Any non-pending
                 // HPX threads are leftovers from a set_state() call for a
                 // previously pending HPX thread (see comments above).
@@ -505,6 +512,12 @@ namespace hpx::threads::detail {
                     continue;
                 }
 
+                // wake up threads whose timed suspension has expired
+                if (use_timer_wheel && expire_timers() != 0)
+                {
+                    idle_loop_count = 0;
+                }
+
                 if (do_background_work)
                 {
                     // do background work in parcel layer and in agas
@@ -0,0 +1,278 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Intrusive list node for the timer_wheel below, the owner of the timer
+    // derives from it and has to keep it alive until it has either expired
+    // or has been canceled.
+    struct timer_wheel_entry
+    {
+        timer_wheel_entry* prev = nullptr;
+        timer_wheel_entry* next = nullptr;
+
+        // absolute expiration time in ticks of the wheel
+        std::uint64_t expiry = 0;
+
+        // index of the slot this entry is linked into, if any
+        std::uint16_t slot = 0;
+        bool linked = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A hierarchical timing wheel (Varghese and Lauck) with num_levels levels
+    // of 64 slots each. Level L holds the timers expiring within the next
+    // 64^(L+1) ticks, their slot is selected by the corresponding 6 bits of
+    // their expiration time. Whenever the lower level wraps around the next
+    // slot of the level above is redistributed (cascaded) to the lower
+    // levels. Timers expiring beyond the range of the wheel are kept in the
+    // top level and are redistributed until they fit.
+    //
+    // Adding and canceling a timer is O(1), expiring is O(1) per tick and
+    // timer (amortized). The wheel is not thread safe, all accesses have to
+    // be protected by the user.
+    class timer_wheel
+    {
+    public:
+        static constexpr std::size_t slot_bits = 6;
+        static constexpr std::size_t num_slots = std::size_t(1) << slot_bits;
+        static constexpr std::size_t num_levels = 5;
+
+        constexpr timer_wheel() noexcept = default;
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel(timer_wheel&&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel&&) = delete;
+
+        // The next tick which will be expired
+        [[nodiscard]] constexpr std::uint64_t current() const noexcept
+        {
+            return current_;
+        }
+
+        // The number of timers currently held by the wheel
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return count_;
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return count_ == 0;
+        }
+
+        // Restart counting ticks from zero, the wheel has to be empty
+        void reset() noexcept
+        {
+            HPX_ASSERT(count_ == 0);
+            current_ = 0;
+            cascaded_ = false;
+        }
+
+        // Move the wheel forward to the given tick without expiring any
+        // timers, the wheel has to be empty
+        void advance(std::uint64_t now) noexcept
+        {
+            HPX_ASSERT(count_ == 0);
+            if (now > current_)
+            {
+                current_ = now;
+                cascaded_ = false;
+            }
+        }
+
+        // Add the given entry, timers expiring in the past will expire during
+        // the next call to expire(). An empty wheel is not expired and may
+        // lag behind, it is moved forward to the given current tick first to
+        // avoid walking all ticks elapsed since the last timer expired.
+        void add(timer_wheel_entry& e, std::uint64_t expiry,
+            std::uint64_t now = 0) noexcept
+        {
+            HPX_ASSERT(!e.linked);
+
+            if (count_ == 0)
+                advance(now);
+
+            e.expiry = expiry;
+            link(e);
+            ++count_;
+        }
+
+        // Remove the given entry if it has not expired yet, returns whether
+        // the entry was removed
+        bool cancel(timer_wheel_entry& e) noexcept
+        {
+            if (!e.linked)
+                return false;
+
+            unlink(e);
+            --count_;
+            return true;
+        }
+
+        // Expire all timers due at or before the given tick, calls f(e) for
+        // each of them after it has been removed from the wheel. f has to
+        // return false to stop expiring timers, in this case the function
+        // has to be called again to expire the remaining ones. Returns false
+        // if it was stopped.
+        template <typename F>
+        bool expire(std::uint64_t now, F&& f)
+        {
+            if (count_ == 0)
+            {
+                // nothing to do, simply advance the wheel
+                if (now >= current_)
+                    current_ = now + 1;
+                return true;
+            }
+
+            while (current_ <= now)
+            {
+                std::size_t const index = current_ & (num_slots - 1);
+
+                // redistribute the timers of the levels above once the lower
+                // level wraps around, this has to be done only once per tick
+                if (index == 0 && !cascaded_)
+                {
+                    for (std::size_t level = 1; level != num_levels; ++level)
+                    {
+                        std::size_t const i =
+                            (current_ >> (level * slot_bits)) & (num_slots - 1);
+                        cascade(level, i);
+                        if (i != 0)
+                            break;
+                    }
+                    cascaded_ = true;
+                }
+
+                timer_wheel_entry*& head = slots_[index];
+                while (head != nullptr)
+                {
+                    timer_wheel_entry& e = *head;
+                    unlink(e);
+                    --count_;
+
+                    if (!f(e))
+                        return false;
+                }
+
+                ++current_;
+                cascaded_ = false;
+
+                if (count_ == 0 && now >= current_)
+                {
+                    current_ = now + 1;
+                    break;
+                }
+            }
+            return true;
+        }
+
+        // Remove all timers without expiring them, calls f(e) for each of
+        // them after it has been removed from the wheel
+        template <typename F>
+        void clear(F&& f)
+        {
+            for (timer_wheel_entry*& head : slots_)
+            {
+                while (head != nullptr)
+                {
+                    timer_wheel_entry& e = *head;
+                    unlink(e);
+                    --count_;
+
+                    f(e);
+                }
+            }
+        }
+
+    private:
+        void link(timer_wheel_entry& e) noexcept
+        {
+            std::uint64_t const delta =
+                e.expiry > current_ ? e.expiry - current_ : 0;
+
+            std::size_t level = 0;
+            while (level != num_levels - 1 &&
+                delta >= (std::uint64_t(1) << ((level + 1) * slot_bits)))
+            {
+                ++level;
+            }
+
+            // timers beyond the range of the wheel are placed in the last slot
+            // reachable from the current tick
+            std::uint64_t expiry = e.expiry > current_ ? e.expiry : current_;
+            if (level == num_levels - 1)
+            {
+                std::uint64_t const max_delta =
+                    (std::uint64_t(1) << (num_levels * slot_bits)) - 1;
+                if (delta > max_delta)
+                    expiry = current_ + max_delta;
+            }
+
+            std::size_t const index =
+                level * num_slots +
+                ((expiry >> (level * slot_bits)) & (num_slots - 1));
+
+            timer_wheel_entry*& head = slots_[index];
+            e.prev = nullptr;
+            e.next = head;
+            if (head != nullptr)
+                head->prev = &e;
+            head = &e;
+
+            e.slot = static_cast<std::uint16_t>(index);
+            e.linked = true;
+        }
+
+        void unlink(timer_wheel_entry& e) noexcept
+        {
+            HPX_ASSERT(e.linked);
+
+            if (e.prev != nullptr)
+                e.prev->next = e.next;
+            else
+                slots_[e.slot] = e.next;
+
+            if (e.next != nullptr)
+                e.next->prev = e.prev;
+
+            e.prev = nullptr;
+            e.next = nullptr;
+            e.linked = false;
+        }
+
+        void cascade(std::size_t level, std::size_t index) noexcept
+        {
+            timer_wheel_entry* e = slots_[level * num_slots + index];
+            slots_[level * num_slots + index] = nullptr;
+
+            while (e != nullptr)
+            {
+                timer_wheel_entry* next = e->next;
+                e->linked = false;
+                link(*e);
+                e = next;
+            }
+        }
+
+        std::array<timer_wheel_entry*, num_levels * num_slots> slots_{};
+        std::uint64_t current_ = 0;
+        std::size_t count_ = 0;
+        bool cascaded_ = false;
+    };
+}    // namespace hpx::threads::detail
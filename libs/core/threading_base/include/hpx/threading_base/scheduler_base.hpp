@@ -182,6 +182,30 @@ namespace hpx::threads::policies {
             std::size_t num_thread, bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t num_thread, bool reset) = 0;
+
+        // only schedulers that answer steal requests by sending batches of
+        // tasks to the thief collect these, the averages are computed by the
+        // thread pools from the sums and counts
+        virtual std::int64_t get_cumulative_steal_latency(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_latency_samples(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_tasks(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_batches(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_queue_length(
@@ -11,10 +11,13 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/timing.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 
 namespace hpx::threads::detail {
 
@@ -66,4 +69,47 @@ namespace hpx::threads::detail {
             thread_priority::normal, thread_schedule_hint(), started,
             retry_on_active, ec);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // If set, timed thread state changes are managed by a timer wheel which is
+    // driven by the scheduling loops instead of by the asio timer service. In
+    // this case set_thread_state_timed does not create any helper threads and
+    // returns invalid_thread_id.
+    HPX_CORE_EXPORT extern bool use_timer_wheel;
+
+    // Change the granularity of the timer wheel, may be called only while no
+    // timers are pending
+    HPX_CORE_EXPORT void set_timer_wheel_resolution(
+        std::chrono::steady_clock::duration resolution);
+
+    // A pending state change of a thread managed by the timer wheel
+    struct timed_thread_state : timer_wheel_entry
+    {
+        thread_id_ref_type thrd;
+        thread_schedule_state newstate = thread_schedule_state::pending;
+        thread_restart_state newstate_ex = thread_restart_state::timeout;
+        thread_priority priority = thread_priority::normal;
+        thread_schedule_hint schedulehint;
+        bool retry_on_active = true;
+
+        // the timer wheel deletes the timer once it has expired
+        bool owned = false;
+    };
+
+    // Schedule the given state change for the given point in time, the timer
+    // has to be kept alive until it was canceled successfully or until the
+    // thread state has been changed
+    HPX_CORE_EXPORT void add_timer(timed_thread_state& timer,
+        hpx::chrono::steady_time_point const& abs_time);
+
+    // Cancel the given timer, returns false if it has already expired
+    HPX_CORE_EXPORT bool cancel_timer(timed_thread_state& timer) noexcept;
+
+    // Perform the state changes of all expired timers, this is called by the
+    // scheduling loops. Returns the number of expired timers.
+    HPX_CORE_EXPORT std::size_t expire_timers();
+
+    // Remove all pending timers without changing any thread states, this is
+    // called during shutdown
+    HPX_CORE_EXPORT void clear_timers() noexcept;
 }    // namespace hpx::threads::detail
@@ -397,6 +397,39 @@ namespace hpx::threads {
         {
             return 0;
         }
+
+        // the sums and counts the steal averages are computed from, the
+        // thread manager combines them across the pools
+        virtual std::int64_t get_cumulative_steal_latency(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_latency_samples(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_tasks(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_steal_batches(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
+        // Average time (in nanoseconds) between sending a steal request and
+        // receiving the tasks stolen in response to it.
+        std::int64_t get_average_steal_latency(
+            std::size_t thread_num, bool reset);
+
+        // Average number of tasks received in response to one steal request
+        // (in units of 0.01 tasks).
+        std::int64_t get_average_steal_batch_size(
+            std::size_t thread_num, bool reset);
 #endif
         virtual std::int64_t get_thread_count(thread_schedule_state /*state*/,
             thread_priority /*priority*/, std::size_t /*num_thread*/,
@@ -10,6 +10,7 @@
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/thread_support/spinlock.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
 #include <hpx/threading_base/set_thread_state_timed.hpp>
@@ -20,14 +21,188 @@
 #endif
 #include <asio/basic_waitable_timer.hpp>
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <system_error>
 #include <utility>
 
 namespace hpx::threads::detail {
 
+    ///////////////////////////////////////////////////////////////////////////
+    bool use_timer_wheel = false;
+
+    namespace {
+
+        struct timer_wheel_service
+        {
+            hpx::util::detail::spinlock mtx;
+            timer_wheel wheel;
+
+            // number of pending timers, allows for the scheduling loops to
+            // skip reading the clock and acquiring the lock
+            std::atomic<std::size_t> count{0};
+
+            std::chrono::steady_clock::time_point epoch =
+                std::chrono::steady_clock::now();
+            std::chrono::steady_clock::duration resolution =
+                std::chrono::microseconds(100);
+        };
+
+        timer_wheel_service& get_timer_wheel_service()
+        {
+            static timer_wheel_service service;
+            return service;
+        }
+
+        // Convert the given point in time to ticks of the timer wheel, the
+        // expiration time of a timer is rounded up to never wake up threads
+        // too early.
+        std::uint64_t to_ticks(timer_wheel_service const& service,
+            std::chrono::steady_clock::time_point const& t,
+            bool round_up) noexcept
+        {
+            if (t <= service.epoch)
+                return 0;
+
+            auto const d = t - service.epoch;
+            auto ticks = static_cast<std::uint64_t>(d / service.resolution);
+            if (round_up && d % service.resolution != d.zero())
+                ++ticks;
+            return ticks;
+        }
+
+        struct expired_timer
+        {
+            thread_id_ref_type thrd;
+            thread_schedule_state newstate;
+            thread_restart_state newstate_ex;
+            thread_priority priority;
+            thread_schedule_hint schedulehint;
+            bool retry_on_active;
+        };
+    }    // namespace
+
+    void set_timer_wheel_resolution(
+        std::chrono::steady_clock::duration resolution)
+    {
+        timer_wheel_service& service = get_timer_wheel_service();
+
+        std::lock_guard<hpx::util::detail::spinlock> l(service.mtx);
+        HPX_ASSERT(service.wheel.empty());
+
+        service.resolution = resolution > resolution.zero() ?
+            resolution :
+            std::chrono::steady_clock::duration(1);
+        service.epoch = std::chrono::steady_clock::now();
+        service.wheel.reset();
+    }
+
+    void add_timer(timed_thread_state& timer,
+        hpx::chrono::steady_time_point const& abs_time)
+    {
+        timer_wheel_service& service = get_timer_wheel_service();
+
+        // the wheel is not expired while it is empty, it has to be moved
+        // forward to the current tick when the first timer is added
+        std::uint64_t const now =
+            to_ticks(service, std::chrono::steady_clock::now(), false);
+
+        std::lock_guard<hpx::util::detail::spinlock> l(service.mtx);
+        service.wheel.add(
+            timer, to_ticks(service, abs_time.value(), true), now);
+        service.count.store(service.wheel.size(), std::memory_order_relaxed);
+    }
+
+    bool cancel_timer(timed_thread_state& timer) noexcept
+    {
+        timer_wheel_service& service = get_timer_wheel_service();
+
+        std::lock_guard<hpx::util::detail::spinlock> l(service.mtx);
+        bool const result = service.wheel.cancel(timer);
+        service.count.store(service.wheel.size(), std::memory_order_relaxed);
+        return result;
+    }
+
+    std::size_t expire_timers()
+    {
+        timer_wheel_service& service = get_timer_wheel_service();
+        if (service.count.load(std::memory_order_relaxed) == 0)
+        {
+            return 0;
+        }
+
+        std::uint64_t const now =
+            to_ticks(service, std::chrono::steady_clock::now(), false);
+
+        // The thread states are changed outside the lock, the timers
+        // themselves may not be accessed anymore once they have been
+        // removed from the wheel.
+        std::array<expired_timer, 64> expired;
+        std::size_t num_expired = 0;
+
+        bool done = false;
+        while (!done)
+        {
+            std::size_t count = 0;
+            {
+                // another thread is expiring timers already
+                std::unique_lock<hpx::util::detail::spinlock> l(
+                    service.mtx, std::try_to_lock);
+                if (!l.owns_lock())
+                    break;
+
+                done = service.wheel.expire(now, [&](timer_wheel_entry& e) {
+                    auto& timer = static_cast<timed_thread_state&>(e);
+
+                    expired[count] = expired_timer{HPX_MOVE(timer.thrd),
+                        timer.newstate, timer.newstate_ex, timer.priority,
+                        timer.schedulehint, timer.retry_on_active};
+
+                    if (timer.owned)
+                        delete &timer;
+
+                    return ++count != expired.size();
+                });
+
+                service.count.store(
+                    service.wheel.size(), std::memory_order_relaxed);
+            }
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                expired_timer& t = expired[i];
+
+                error_code ec(throwmode::lightweight);    // do not throw
+                detail::set_thread_state(t.thrd.noref(), t.newstate,
+                    t.newstate_ex, t.priority, t.schedulehint,
+                    t.retry_on_active, ec);
+
+                t.thrd = thread_id_ref_type();
+            }
+            num_expired += count;
+        }
+        return num_expired;
+    }
+
+    void clear_timers() noexcept
+    {
+        timer_wheel_service& service = get_timer_wheel_service();
+
+        std::lock_guard<hpx::util::detail::spinlock> l(service.mtx);
+        service.wheel.clear([](timer_wheel_entry& e) {
+            auto& timer = static_cast<timed_thread_state&>(e);
+            timer.thrd = thread_id_ref_type();
+            if (timer.owned)
+                delete &timer;
+        });
+        service.count.store(0, std::memory_order_relaxed);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// This thread function is used by the at_timer thread below to trigger
     /// the required action.
@@ -169,6 +344,31 @@ namespace hpx::threads::detail {
             return invalid_thread_id;
         }
 
+        if (use_timer_wheel)
+        {
+            auto timer = std::make_unique<timed_thread_state>();
+            timer->thrd = thread_id_ref_type(thrd);
+            timer->newstate = newstate;
+            timer->newstate_ex = newstate_ex;
+            timer->priority = priority;
+            timer->schedulehint = schedulehint;
+            timer->retry_on_active = retry_on_active;
+            timer->owned = true;
+
+            add_timer(*timer, abs_time);
+            timer.release();
+
+            if (started != nullptr)
+            {
+                started->store(true);
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return invalid_thread_id;
+        }
+
         // this creates a new thread that creates the timer and handles the
         // requested actions
         thread_init_data data(
@@ -546,14 +546,28 @@ namespace hpx::this_thread {
             threads::detail::reset_backtrace bt(id, ec);
 #endif
 
+            // the timer wheel allows to cancel the timer directly, no helper
+            // thread is involved
+            bool const use_timer_wheel = threads::detail::use_timer_wheel;
+            threads::detail::timed_thread_state timer;
+
             std::atomic<bool> timer_started(false);
-            threads::thread_id_ref_type const timer_id =
-                threads::set_thread_state(id.noref(), abs_time, &timer_started,
-                    threads::thread_schedule_state::pending,
+            threads::thread_id_ref_type timer_id;
+            if (use_timer_wheel)
+            {
+                timer.thrd = id;
+                timer.priority = threads::thread_priority::boost;
+                threads::detail::add_timer(timer, abs_time);
+            }
+            else
+            {
+                timer_id = threads::set_thread_state(id.noref(), abs_time,
+                    &timer_started, threads::thread_schedule_state::pending,
                     threads::thread_restart_state::timeout,
                     threads::thread_priority::boost, true, ec);
-            if (ec)
-                return threads::thread_restart_state::unknown;
+                if (ec)
+                    return threads::thread_restart_state::unknown;
+            }
 
             // We might need to dispatch 'nextid' to it's correct scheduler only
             // if our current scheduler is the same, we should yield to the id
@@ -582,14 +596,21 @@ namespace hpx::this_thread {
                 HPX_ASSERT(statex == threads::thread_restart_state::abort ||
                     statex == threads::thread_restart_state::signaled);
 
-                error_code ec1(throwmode::lightweight);    // do not throw
-                hpx::util::yield_while<true>(
-                    [&timer_started]() { return !timer_started.load(); },
-                    "set_thread_state_timed");
-                threads::set_thread_state(timer_id.noref(),
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::abort,
-                    threads::thread_priority::boost, true, ec1);
+                if (use_timer_wheel)
+                {
+                    threads::detail::cancel_timer(timer);
+                }
+                else
+                {
+                    error_code ec1(throwmode::lightweight);    // do not throw
+                    hpx::util::yield_while<true>(
+                        [&timer_started]() { return !timer_started.load(); },
+                        "set_thread_state_timed");
+                    threads::set_thread_state(timer_id.noref(),
+                        threads::thread_schedule_state::pending,
+                        threads::thread_restart_state::abort,
+                        threads::thread_priority::boost, true, ec1);
+                }
             }
         }
 
@@ -129,6 +129,26 @@ namespace hpx::threads {
             thread_priority::default_, num_thread, reset);
     }
 
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    std::int64_t thread_pool_base::get_average_steal_latency(
+        std::size_t num_thread, bool reset)
+    {
+        std::int64_t const latency =
+            get_cumulative_steal_latency(num_thread, reset);
+        std::int64_t const samples =
+            get_num_steal_latency_samples(num_thread, reset);
+        return samples != 0 ? latency / samples : 0;
+    }
+
+    std::int64_t thread_pool_base::get_average_steal_batch_size(
+        std::size_t num_thread, bool reset)
+    {
+        std::int64_t const tasks = get_num_stolen_tasks(num_thread, reset);
+        std::int64_t const batches = get_num_steal_batches(num_thread, reset);
+        return batches != 0 ? 100 * tasks / batches : 0;
+    }
+#endif
+
     std::size_t thread_pool_base::get_active_os_thread_count() const
     {
         std::size_t active_os_thread_count = 0;
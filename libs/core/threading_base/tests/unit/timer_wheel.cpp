@@ -0,0 +1,310 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using hpx::threads::detail::timer_wheel;
+using hpx::threads::detail::timer_wheel_entry;
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_entry : timer_wheel_entry
+{
+    std::uint64_t expired_at = 0;
+    bool expired = false;
+};
+
+void test_wheel_expire_order()
+{
+    timer_wheel wheel;
+
+    // cover the lower levels of the wheel including their boundaries
+    std::vector<std::uint64_t> const expiries = {0, 1, 63, 64, 65, 4095, 4096,
+        4097, 262143, 262144, 300000, 16777215, 16777216, 16777217};
+
+    std::vector<test_entry> entries(expiries.size());
+    for (std::size_t i = 0; i != expiries.size(); ++i)
+    {
+        wheel.add(entries[i], expiries[i]);
+    }
+    HPX_TEST_EQ(wheel.size(), expiries.size());
+
+    std::uint64_t now = 0;
+    while (!wheel.empty())
+    {
+        wheel.expire(now, [&](timer_wheel_entry& e) {
+            auto& t = static_cast<test_entry&>(e);
+            HPX_TEST(!t.expired);
+            t.expired = true;
+            t.expired_at = now;
+            return true;
+        });
+
+        // advance in uneven steps to exercise expiring several ticks at once
+        now += 1 + (now % 1000);
+        if (now < wheel.current())
+            now = wheel.current();
+    }
+
+    for (test_entry const& t : entries)
+    {
+        HPX_TEST(t.expired);
+        HPX_TEST(!t.linked);
+
+        // no timer may expire early
+        HPX_TEST_LTE(t.expiry, t.expired_at);
+    }
+}
+
+void test_wheel_cancel()
+{
+    timer_wheel wheel;
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, 100000);
+
+    std::vector<test_entry> entries(1000);
+    for (test_entry& t : entries)
+    {
+        wheel.add(t, dist(gen));
+    }
+
+    // cancel every other timer
+    for (std::size_t i = 0; i < entries.size(); i += 2)
+    {
+        HPX_TEST(wheel.cancel(entries[i]));
+        HPX_TEST(!wheel.cancel(entries[i]));
+    }
+    HPX_TEST_EQ(wheel.size(), entries.size() / 2);
+
+    std::size_t count = 0;
+    std::uint64_t now = 0;
+    while (!wheel.empty())
+    {
+        now += 97;
+        wheel.expire(now, [&](timer_wheel_entry& e) {
+            auto& t = static_cast<test_entry&>(e);
+            HPX_TEST_LTE(t.expiry, now);
+            HPX_TEST_LT(now - t.expiry, std::uint64_t(97));
+            t.expired = true;
+            ++count;
+            return true;
+        });
+    }
+    HPX_TEST_EQ(count, entries.size() / 2);
+
+    for (std::size_t i = 0; i != entries.size(); ++i)
+    {
+        HPX_TEST_EQ(entries[i].expired, i % 2 != 0);
+    }
+}
+
+void test_wheel_stop_and_clear()
+{
+    timer_wheel wheel;
+
+    std::vector<test_entry> entries(10);
+    for (test_entry& t : entries)
+    {
+        wheel.add(t, 5);
+    }
+
+    // stop after the third expired timer
+    std::size_t count = 0;
+    HPX_TEST(
+        !wheel.expire(10, [&](timer_wheel_entry&) { return ++count < 3; }));
+    HPX_TEST_EQ(count, std::size_t(3));
+    HPX_TEST_EQ(wheel.size(), entries.size() - 3);
+
+    // timers added in the past expire during the next call
+    test_entry late;
+    wheel.add(late, 1);
+
+    count = 0;
+    HPX_TEST(wheel.expire(10, [&](timer_wheel_entry&) {
+        ++count;
+        return true;
+    }));
+    HPX_TEST_EQ(count, entries.size() - 2);
+    HPX_TEST(wheel.empty());
+
+    for (test_entry& t : entries)
+    {
+        wheel.add(t, 1000000);
+    }
+
+    count = 0;
+    wheel.clear([&](timer_wheel_entry& e) {
+        HPX_TEST(!e.linked);
+        ++count;
+    });
+    HPX_TEST_EQ(count, entries.size());
+    HPX_TEST(wheel.empty());
+}
+
+// an empty wheel is not expired, it is moved forward to the current tick
+// when the first timer is added
+void test_wheel_add_after_idle()
+{
+    timer_wheel wheel;
+
+    test_entry first;
+    wheel.add(first, 10, 0);
+    HPX_TEST(wheel.expire(10, [](timer_wheel_entry&) { return true; }));
+    HPX_TEST(wheel.empty());
+    HPX_TEST_EQ(wheel.current(), std::uint64_t(11));
+
+    // no timers are pending for a long time
+    std::uint64_t const now = 36000000;
+
+    test_entry second;
+    wheel.add(second, now + 100, now);
+    HPX_TEST_EQ(wheel.current(), now);
+
+    // the timer expires on time, only the ticks since it was added are
+    // walked
+    std::size_t count = 0;
+    HPX_TEST(wheel.expire(now + 99, [&](timer_wheel_entry&) {
+        ++count;
+        return true;
+    }));
+    HPX_TEST_EQ(count, std::size_t(0));
+    HPX_TEST_EQ(wheel.current(), now + 100);
+
+    HPX_TEST(wheel.expire(now + 100, [&](timer_wheel_entry&) {
+        ++count;
+        return true;
+    }));
+    HPX_TEST_EQ(count, std::size_t(1));
+    HPX_TEST(wheel.empty());
+
+    // the same applies after the last timer was canceled, a wheel which is
+    // not empty is never moved
+    test_entry third;
+    test_entry fourth;
+    wheel.add(third, now + 1000, now + 500);
+    HPX_TEST_EQ(wheel.current(), now + 500);
+    wheel.add(fourth, now + 2000, now + 600);
+    HPX_TEST_EQ(wheel.current(), now + 500);
+
+    HPX_TEST(wheel.cancel(third));
+    HPX_TEST(wheel.cancel(fourth));
+
+    test_entry fifth;
+    wheel.add(fifth, now + 10100, now + 10000);
+    HPX_TEST_EQ(wheel.current(), now + 10000);
+    HPX_TEST(wheel.cancel(fifth));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sleep_for()
+{
+    constexpr std::size_t num_threads = 100;
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_threads);
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        futures.push_back(hpx::async([i]() {
+            auto const duration = std::chrono::milliseconds(1 + i % 10);
+
+            hpx::chrono::high_resolution_timer t;
+            hpx::this_thread::sleep_for(duration);
+
+            // the thread must not be resumed before the timeout has elapsed
+            HPX_TEST_LTE(
+                std::chrono::duration<double>(duration).count(), t.elapsed());
+        }));
+    }
+
+    hpx::wait_all(futures);
+}
+
+void test_interrupt_sleep_for()
+{
+    bool interrupted = false;
+
+    // the timer has to be canceled if the thread is woken up before the
+    // timeout elapses
+    hpx::thread t([&]() {
+        try
+        {
+            hpx::this_thread::sleep_for(std::chrono::seconds(60));
+        }
+        catch (hpx::thread_interrupted const&)
+        {
+            interrupted = true;
+        }
+    });
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    hpx::chrono::high_resolution_timer timer;
+    t.interrupt();
+    t.join();
+
+    HPX_TEST(interrupted);
+    HPX_TEST_LT(timer.elapsed(), 10.0);
+}
+
+// the first timer after a period without any pending timers fires on time
+void test_sleep_after_idle()
+{
+    for (int i = 0; i != 3; ++i)
+    {
+        // keep the wheel empty, the workers are idle in the meantime
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        auto const duration = std::chrono::milliseconds(10);
+
+        hpx::chrono::high_resolution_timer t;
+        hpx::this_thread::sleep_for(duration);
+        double const elapsed = t.elapsed();
+
+        HPX_TEST_LTE(std::chrono::duration<double>(duration).count(), elapsed);
+        HPX_TEST_LT(elapsed, 1.0);
+    }
+}
+
+int hpx_main()
+{
+    test_sleep_after_idle();
+    test_sleep_for();
+    test_interrupt_sleep_for();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    test_wheel_expire_order();
+    test_wheel_cancel();
+    test_wheel_stop_and_clear();
+    test_wheel_add_after_idle();
+
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all", "hpx.timer_service=wheel"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
@@ -277,6 +277,8 @@ namespace hpx::threads {
         std::int64_t get_num_stolen_from_staged(bool reset) const;
         std::int64_t get_num_stolen_to_pending(bool reset) const;
         std::int64_t get_num_stolen_to_staged(bool reset) const;
+        std::int64_t get_average_steal_latency(bool reset) const;
+        std::int64_t get_average_steal_batch_size(bool reset) const;
 #endif
 
     private:
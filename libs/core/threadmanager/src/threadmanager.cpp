@@ -23,6 +23,7 @@
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/thread_pool_util/thread_pool_suspension_helpers.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
+#include <hpx/threading_base/set_thread_state_timed.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
@@ -1466,6 +1467,34 @@ namespace hpx::threads {
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    // sum the raw values of all pools and divide once, the average of the
+    // per-pool averages would overweight pools with few steal requests
+    std::int64_t threadmanager::get_average_steal_latency(bool reset) const
+    {
+        std::int64_t latency = 0;
+        std::int64_t samples = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            latency +=
+                pool_iter->get_cumulative_steal_latency(all_threads, reset);
+            samples +=
+                pool_iter->get_num_steal_latency_samples(all_threads, reset);
+        }
+        return samples != 0 ? latency / samples : 0;
+    }
+
+    std::int64_t threadmanager::get_average_steal_batch_size(bool reset) const
+    {
+        std::int64_t tasks = 0;
+        std::int64_t batches = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            tasks += pool_iter->get_num_stolen_tasks(all_threads, reset);
+            batches += pool_iter->get_num_steal_batches(all_threads, reset);
+        }
+        return batches != 0 ? 100 * tasks / batches : 0;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1520,6 +1549,12 @@ namespace hpx::threads {
         {
             pool_iter->stop(lk, blocking);
         }
+
+        // release the threads referenced by timers which will never expire
+        if (blocking)
+        {
+            threads::detail::clear_timers();
+        }
         deinit_tss();
     }
 
@@ -118,6 +118,10 @@ namespace hpx::actions {
         /// Return a pointer to the message handler to be used for this action.
         virtual parcelset::policies::message_handler* get_message_handler(
             parcelset::locality const& loc) const = 0;
+
+        /// Return whether the serialized size of the arguments of this action
+        /// can be measured before the arguments are serialized.
+        virtual bool has_trivially_measurable_arguments() const = 0;
 #endif
 
         virtual void load(serialization::input_archive& ar) = 0;
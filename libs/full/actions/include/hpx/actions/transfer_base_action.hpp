@@ -280,6 +280,13 @@ namespace hpx::actions {
             return traits::action_message_handler<derived_type>::call(loc);
         }
 
+        /// Return whether the serialized size of the arguments of this action
+        /// can be measured before the arguments are serialized.
+        bool has_trivially_measurable_arguments() const override
+        {
+            return traits::is_trivially_measurable_v<arguments_base_type>;
+        }
+
     public:
         /// retrieve the N's argument
         template <std::size_t N>
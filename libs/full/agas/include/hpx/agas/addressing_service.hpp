@@ -11,6 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
 #include <hpx/functional/function.hpp>
@@ -64,14 +65,21 @@ namespace hpx { namespace agas {
         // gva cache
         struct gva_cache_key;
 
-        using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
-            hpx::util::cache::statistics::local_full_statistics>;
+        using gva_range_cache_type =
+            hpx::util::cache::lru_cache<gva_cache_key, gva,
+                hpx::util::cache::statistics::local_full_statistics>;
 
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable hpx::shared_mutex gva_cache_mtx_;
-        std::shared_ptr<gva_cache_type> gva_cache_;
+        // addresses of individual objects, lookups do not acquire any lock
+        mutable detail::gva_cache gva_cache_;
+
+        // addresses of ranges of objects, consulted only if the cache above
+        // does not hold the requested entry
+        mutable hpx::shared_mutex gva_range_cache_mtx_;
+        std::shared_ptr<gva_range_cache_type> gva_range_cache_;
+        mutable std::atomic<bool> has_range_entries_;
 
         mutable mutex_type migrated_objects_mtx_;
         migrated_objects_table_type migrated_objects_table_;
@@ -0,0 +1,126 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::agas::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The gva_cache holds the addresses of individual (non-range) global ids
+    // resolved by AGAS. It is optimized for the lookup path: get_entry does
+    // not acquire any lock and does not write to shared memory except for
+    // (rarely) setting the 'referenced' bit of the entry it found.
+    //
+    // The entries are distributed over a number of shards, each of which is
+    // an open-addressing hash table (linear probing, backward shift
+    // deletion) protected by a spinlock for all modifications. Each slot is
+    // guarded by a sequence counter (seqlock): writers make the counter odd
+    // while modifying the slot, readers retry reading a slot until they have
+    // seen the same even counter value before and after copying its
+    // contents. A lookup may therefore miss an entry which is concurrently
+    // being moved by a writer, but it never returns a torn or erased entry
+    // once the erasing operation has finished.
+    //
+    // Whenever a shard's table needs to be resized a new table is published,
+    // the old one is retired and kept alive until the cache is destroyed, as
+    // concurrent readers may still access it. Tables are resized only when
+    // the capacity of the cache is changed or, for caches without a size
+    // limit, if they grow beyond their load factor.
+    //
+    // Entries are evicted using the CLOCK algorithm, an approximation of LRU
+    // which does not require any bookkeeping on a hit apart from setting the
+    // 'referenced' bit.
+    //
+    // Hits and misses are counted per thread (in one of a fixed number of
+    // slots assigned to the threads in a round robin fashion) to avoid
+    // contention between concurrent lookups on the counters.
+    class HPX_EXPORT gva_cache
+    {
+    public:
+        static constexpr std::size_t num_shards = 64;
+
+        explicit gva_cache(std::size_t max_size = 0);
+        ~gva_cache();
+
+        gva_cache(gva_cache const&) = delete;
+        gva_cache(gva_cache&&) = delete;
+        gva_cache& operator=(gva_cache const&) = delete;
+        gva_cache& operator=(gva_cache&&) = delete;
+
+        // Return the number of entries currently held in the cache
+        [[nodiscard]] std::size_t size() const;
+
+        // Access and change the maximum number of entries the cache may hold,
+        // zero means no size limitation. The limit is enforced per shard, the
+        // cache may hold up to num_shards - 1 entries more than requested.
+        [[nodiscard]] std::size_t capacity() const noexcept;
+        void reserve(std::size_t max_size);
+
+        // Look up the gva for the given (stripped) global id, does not block
+        [[nodiscard]] bool get_entry(
+            naming::gid_type const& gid, gva& g) const noexcept;
+
+        // Insert or replace the gva for the given (stripped) global id
+        void update(naming::gid_type const& gid, gva const& g);
+
+        // Remove the entry for the given (stripped) global id, returns false
+        // if the cache held no such entry
+        bool erase(naming::gid_type const& gid);
+
+        // Remove all entries, returns the number of removed entries
+        std::size_t clear();
+
+        // Statistics
+        [[nodiscard]] std::uint64_t hits(bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t misses(bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t insertions(bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t evictions(bool reset) const noexcept;
+
+        [[nodiscard]] std::uint64_t get_entry_count(
+            bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t update_entry_count(
+            bool reset) const noexcept;
+        [[nodiscard]] std::uint64_t erase_entry_count(
+            bool reset) const noexcept;
+
+    private:
+        struct slot;
+        struct table;
+        struct shard;
+        struct shard_statistics;
+        struct lookup_statistics;
+
+        using mutex_type = hpx::spinlock;
+
+        template <typename F>
+        std::uint64_t accumulate(F&& f) const noexcept;
+
+        template <typename F>
+        std::uint64_t accumulate_lookups(F&& f) const noexcept;
+
+        static std::uint64_t hash(naming::gid_type const& gid) noexcept;
+
+        std::atomic<std::size_t> max_size_;
+
+        std::unique_ptr<shard[]> shards_;
+        std::unique_ptr<shard_statistics[]> statistics_;
+        std::unique_ptr<lookup_statistics[]> lookup_statistics_;
+    };
+}    // namespace hpx::agas::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -117,7 +117,8 @@ namespace hpx::agas {
 
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
-      : gva_cache_(new gva_cache_type)
+      : gva_range_cache_(new gva_range_cache_type)
+      , has_range_entries_(false)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
       , refcnt_requests_count_(0)
@@ -132,7 +133,11 @@ namespace hpx::agas {
       , state_(hpx::state::starting)
     {
         if (caching_)
-            gva_cache_->reserve(ini_.get_agas_local_cache_size());
+        {
+            std::size_t const cache_size = ini_.get_agas_local_cache_size();
+            gva_cache_.reserve(cache_size);
+            gva_range_cache_->reserve(cache_size);
+        }
     }
 
     void addressing_service::bootstrap(
@@ -190,8 +195,13 @@ namespace hpx::agas {
         // create the hierarchy based on the topology
         if (caching_)
         {
-            std::size_t const previous = gva_cache_->size();
-            gva_cache_->reserve(cache_size);
+            std::size_t const previous = gva_cache_.capacity();
+            gva_cache_.reserve(cache_size);
+
+            {
+                std::unique_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+                gva_range_cache_->reserve(cache_size);
+            }
 
             LAGAS_(info).format(
                 "addressing_service::adjust_local_cache_size, previous size: "
@@ -1748,19 +1758,53 @@ namespace hpx::agas {
                 "addressing_service::update_cache_entry, gid({1}), count({2})",
                 gid, count);
 
+            if (count == 1)
+            {
+                // An entry covering a range of objects which includes the
+                // given gid collides with the new entry, leave the cache
+                // unchanged in this case. Entries for ranges always have a
+                // count larger than one, any range holding the key is a
+                // collision.
+                if (has_range_entries_.load(std::memory_order_relaxed))
+                {
+                    std::shared_lock<hpx::shared_mutex> lock(
+                        gva_range_cache_mtx_);
+                    if (gva_range_cache_->holds_key(gva_cache_key(gid, 1)))
+                    {
+                        LAGAS_(warning).format(
+                            "addressing_service::update_cache_entry, "
+                            "aborting update due to key collision in cache, "
+                            "new_gid({1}), new_count({2})",
+                            gid, count);
+
+                        if (&ec != &throws)
+                            ec = make_success_code();
+                        return;
+                    }
+                }
+
+                gva_cache_.update(gid, g);
+
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
             gva_cache_key const key(gid, count);
 
             {
-                std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
+                std::unique_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+                has_range_entries_.store(true, std::memory_order_relaxed);
+                if (!gva_range_cache_->update_if(key, g, check_for_collisions))
                 {
                     if (LAGAS_ENABLED(warning))
                     {
                         // Figure out who we collided with.
                         addressing_service::gva_cache_key idbase;
-                        addressing_service::gva_cache_type::entry_type e;
+                        addressing_service::gva_range_cache_type::entry_type
+                            e;
 
-                        if (!gva_cache_->get_entry(key, idbase, e))
+                        if (!gva_range_cache_->get_entry(key, idbase, e))
                         {
                             // This is impossible under sane conditions.
                             lock.unlock();
@@ -1802,10 +1846,24 @@ namespace hpx::agas {
         // don't look at cache if gid is marked as non-cache-able
         HPX_ASSERT(naming::detail::store_in_cache(gid));
 
+        naming::gid_type const id = naming::detail::get_stripped_gid(gid);
+        if (gva_cache_.get_entry(id, gva))
+        {
+            idbase = id;
+            return true;
+        }
+
+        // fall back to the entries describing ranges of objects
+        if (!has_range_entries_.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+
         gva_cache_key const k(gid);
 
-        std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        if (gva_cache_key idbase_key; gva_cache_->get_entry(k, idbase_key, gva))
+        std::unique_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        if (gva_cache_key idbase_key;
+            gva_range_cache_->get_entry(k, idbase_key, gva))
         {
             std::uint64_t const id_msb =
                 naming::detail::strip_internal_bits_from_gid(gid.get_msb());
@@ -1837,7 +1895,7 @@ namespace hpx::agas {
             return;
         }
 
-        // 26115: Failing to release lock 'this->gva_cache_mtx_'
+        // 26115: Failing to release lock 'this->gva_range_cache_mtx_'
 #if defined(HPX_MSVC)
 #pragma warning(push)
 #pragma warning(disable : 26115)
@@ -1847,9 +1905,12 @@ namespace hpx::agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
+            gva_cache_.clear();
 
-            gva_cache_->clear();
+            std::unique_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+
+            gva_range_cache_->clear();
+            has_range_entries_.store(false, std::memory_order_relaxed);
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1896,11 +1957,17 @@ namespace hpx::agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
+            gva_cache_.erase(gid);
 
-            gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
-                return gid == p.first.get_gid();
-            });
+            if (has_range_entries_.load(std::memory_order_relaxed))
+            {
+                std::unique_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+
+                gva_range_cache_->erase(
+                    [&gid](std::pair<gva_cache_key, gva> const& p) {
+                        return gid == p.first.get_gid();
+                    });
+            }
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1927,88 +1994,102 @@ namespace hpx::agas {
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->size();
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_cache_.size() + gva_range_cache_->size();
     }
 
+    // Every lookup which could not be satisfied by gva_cache_ is counted as a
+    // miss there, even if it later hits in gva_range_cache_.
     std::uint64_t addressing_service::get_cache_hits(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_cache_.hits(reset) +
+            gva_range_cache_->get_statistics().hits(reset);
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        std::uint64_t const misses = gva_cache_.misses(reset);
+        std::uint64_t const range_hits =
+            gva_range_cache_->get_statistics().hits(false);
+        return misses > range_hits ? misses - range_hits : 0;
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_cache_.evictions(reset) +
+            gva_range_cache_->get_statistics().evictions(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_cache_.insertions(reset) +
+            gva_range_cache_->get_statistics().insertions(reset);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        // every lookup is performed on gva_cache_ first
+        return gva_cache_.get_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_cache_.insertions(false) +
+            gva_range_cache_->get_statistics().get_insert_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_cache_.update_entry_count(reset) +
+            gva_range_cache_->get_statistics().get_update_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_cache_.erase_entry_count(reset) +
+            gva_range_cache_->get_statistics().get_erase_entry_count(reset);
     }
 
+    // The timings are available for the entries describing ranges of objects
+    // only, measuring the lookups in gva_cache_ would cost more than the
+    // lookups themselves.
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_range_cache_->get_statistics().get_get_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_range_cache_->get_statistics().get_insert_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_range_cache_->get_statistics().get_update_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        std::shared_lock<hpx::shared_mutex> lock(gva_range_cache_mtx_);
+        return gva_range_cache_->get_statistics().get_erase_entry_time(reset);
     }
 
     void addressing_service::register_server_instances()
@@ -0,0 +1,694 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/config/cache_line_size.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::agas::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct gva_cache::slot
+    {
+        // odd while the slot is being modified
+        std::atomic<std::uint64_t> seq{0};
+
+        // an all-zero key marks an empty slot
+        std::atomic<std::uint64_t> key_msb{0};
+        std::atomic<std::uint64_t> key_lsb{0};
+
+        std::atomic<std::uint64_t> prefix_msb{0};
+        std::atomic<std::uint64_t> prefix_lsb{0};
+        std::atomic<std::int32_t> type{0};
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> lva{0};
+        std::atomic<std::uint64_t> offset{0};
+
+        std::atomic<bool> referenced{false};
+
+        // The following functions may be used by the (single) writer only.
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return key_msb.load(std::memory_order_relaxed) == 0 &&
+                key_lsb.load(std::memory_order_relaxed) == 0;
+        }
+
+        [[nodiscard]] bool holds(std::uint64_t msb,
+            std::uint64_t lsb) const noexcept
+        {
+            return key_msb.load(std::memory_order_relaxed) == msb &&
+                key_lsb.load(std::memory_order_relaxed) == lsb;
+        }
+
+        void begin_write() noexcept
+        {
+            seq.store(seq.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        void end_write() noexcept
+        {
+            seq.store(seq.load(std::memory_order_relaxed) + 1,
+                std::memory_order_release);
+        }
+
+        void store(std::uint64_t msb, std::uint64_t lsb, gva const& g) noexcept
+        {
+            key_msb.store(msb, std::memory_order_relaxed);
+            key_lsb.store(lsb, std::memory_order_relaxed);
+            prefix_msb.store(g.prefix.get_msb(), std::memory_order_relaxed);
+            prefix_lsb.store(g.prefix.get_lsb(), std::memory_order_relaxed);
+            type.store(g.type, std::memory_order_relaxed);
+            count.store(g.count, std::memory_order_relaxed);
+            lva.store(reinterpret_cast<std::uint64_t>(g.lva()),
+                std::memory_order_relaxed);
+            offset.store(g.offset, std::memory_order_relaxed);
+        }
+
+        void assign(std::uint64_t msb, std::uint64_t lsb, gva const& g) noexcept
+        {
+            begin_write();
+            store(msb, lsb, g);
+            end_write();
+        }
+
+        void assign(slot const& rhs) noexcept
+        {
+            begin_write();
+            key_msb.store(rhs.key_msb.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            key_lsb.store(rhs.key_lsb.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            prefix_msb.store(rhs.prefix_msb.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            prefix_lsb.store(rhs.prefix_lsb.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            type.store(
+                rhs.type.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            count.store(rhs.count.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            lva.store(
+                rhs.lva.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            offset.store(rhs.offset.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            end_write();
+
+            referenced.store(rhs.referenced.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        }
+
+        void reset() noexcept
+        {
+            begin_write();
+            key_msb.store(0, std::memory_order_relaxed);
+            key_lsb.store(0, std::memory_order_relaxed);
+            end_write();
+
+            referenced.store(false, std::memory_order_relaxed);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct gva_cache::table
+    {
+        explicit table(int bits)
+          : bits(bits)
+          , slots(new slot[std::size_t(1) << bits])
+        {
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return std::size_t(1) << bits;
+        }
+
+        [[nodiscard]] std::size_t mask() const noexcept
+        {
+            return size() - 1;
+        }
+
+        int const bits;
+        std::unique_ptr<slot[]> slots;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        constexpr int shard_bits = 6;
+        constexpr int min_table_bits = 4;
+
+        static_assert(gva_cache::num_shards == (std::size_t(1) << shard_bits));
+
+        constexpr int log2(std::size_t n) noexcept
+        {
+            int bits = 0;
+            while ((std::size_t(1) << bits) < n)
+                ++bits;
+            return bits;
+        }
+
+        constexpr std::size_t shard_index(std::uint64_t h) noexcept
+        {
+            return static_cast<std::size_t>(h >> (64 - shard_bits));
+        }
+
+        constexpr std::size_t home_slot(int bits, std::uint64_t h) noexcept
+        {
+            return static_cast<std::size_t>((h << shard_bits) >> (64 - bits));
+        }
+
+        // maximum number of entries per shard for the given overall size, zero
+        // means unlimited
+        constexpr std::size_t shard_capacity(std::size_t max_size) noexcept
+        {
+            return max_size == 0 ?
+                0 :
+                (max_size + gva_cache::num_shards - 1) / gva_cache::num_shards;
+        }
+
+        // number of slots for counting the lookups
+        constexpr std::size_t num_lookup_slots = 64;
+
+        // Return the slot the calling thread uses for counting its lookups
+        std::size_t lookup_slot() noexcept
+        {
+            static std::atomic<std::size_t> next_slot(0);
+            thread_local std::size_t const slot =
+                next_slot.fetch_add(1, std::memory_order_relaxed) %
+                num_lookup_slots;
+            return slot;
+        }
+
+        // table size needed for the given number of entries with a load
+        // factor of at most 1/2
+        constexpr int table_bits(std::size_t count) noexcept
+        {
+            int const bits = log2(2 * count);
+            return bits < min_table_bits ? min_table_bits : bits;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Shards and their statistics are kept in separate cache lines, lookups
+    // write to the latter only.
+    struct alignas(threads::get_cache_line_size()) gva_cache::shard
+    {
+        static constexpr std::size_t npos = std::size_t(-1);
+
+        // Return the position of the given key in the current table
+        [[nodiscard]] std::size_t find(table const& t, std::uint64_t msb,
+            std::uint64_t lsb, std::uint64_t h) const noexcept
+        {
+            std::size_t const mask = t.mask();
+            std::size_t pos = home_slot(t.bits, h);
+            for (std::size_t i = 0; i <= mask; ++i, pos = (pos + 1) & mask)
+            {
+                slot const& sl = t.slots[pos];
+                if (sl.holds(msb, lsb))
+                    return pos;
+                if (sl.empty())
+                    break;
+            }
+            return npos;
+        }
+
+        // Store a new entry in the first free slot of its probe sequence,
+        // the table must not be full.
+        static void insert(table& t, std::uint64_t msb, std::uint64_t lsb,
+            std::uint64_t h, gva const& g) noexcept
+        {
+            std::size_t const mask = t.mask();
+            std::size_t pos = home_slot(t.bits, h);
+            while (!t.slots[pos].empty())
+            {
+                pos = (pos + 1) & mask;
+            }
+            t.slots[pos].assign(msb, lsb, g);
+        }
+
+        // Remove the entry at the given position, moves back all entries
+        // following it in the same cluster which would not be found
+        // otherwise (backward shift deletion). Entries are copied before the
+        // original slot is being cleared, concurrent readers may see an entry
+        // twice but never a partially moved one.
+        void erase_at(table& t, std::size_t pos) noexcept
+        {
+            std::size_t const mask = t.mask();
+            std::size_t i = pos;
+            std::size_t j = pos;
+            while (true)
+            {
+                j = (j + 1) & mask;
+
+                slot& sl = t.slots[j];
+                if (sl.empty())
+                    break;
+
+                std::size_t const k = home_slot(t.bits,
+                    hash(naming::gid_type(
+                        sl.key_msb.load(std::memory_order_relaxed),
+                        sl.key_lsb.load(std::memory_order_relaxed))));
+
+                // move the entry if its home slot is not cyclically located
+                // in (i, j]
+                if ((i <= j) ? (i < k && k <= j) : (i < k || k <= j))
+                    continue;
+
+                t.slots[i].assign(sl);
+                i = j;
+            }
+
+            t.slots[i].reset();
+            --count;
+        }
+
+        // Evict one entry using the CLOCK algorithm, the table must not be
+        // empty.
+        void evict_one(table& t) noexcept
+        {
+            HPX_ASSERT(count != 0);
+
+            std::size_t const mask = t.mask();
+            while (true)
+            {
+                std::size_t const pos = hand++ & mask;
+
+                slot& sl = t.slots[pos];
+                if (sl.empty())
+                    continue;
+
+                if (sl.referenced.load(std::memory_order_relaxed))
+                {
+                    // give the entry a second chance
+                    sl.referenced.store(false, std::memory_order_relaxed);
+                    continue;
+                }
+
+                erase_at(t, pos);
+                return;
+            }
+        }
+
+        // Move all entries to a new table of the given size. The old table
+        // is cleared after the new one has been published to make sure that
+        // readers still holding on to it will not see entries which are
+        // subsequently being changed or erased.
+        void rehash(int bits)
+        {
+            table& old_table = *current.load(std::memory_order_relaxed);
+
+            auto new_table = std::make_unique<table>(bits);
+            for (std::size_t i = 0; i != old_table.size(); ++i)
+            {
+                slot const& sl = old_table.slots[i];
+                if (sl.empty())
+                    continue;
+
+                std::uint64_t const msb =
+                    sl.key_msb.load(std::memory_order_relaxed);
+                std::uint64_t const lsb =
+                    sl.key_lsb.load(std::memory_order_relaxed);
+                gva const g(naming::gid_type(
+                                sl.prefix_msb.load(std::memory_order_relaxed),
+                                sl.prefix_lsb.load(std::memory_order_relaxed)),
+                    sl.type.load(std::memory_order_relaxed),
+                    sl.count.load(std::memory_order_relaxed),
+                    sl.lva.load(std::memory_order_relaxed),
+                    sl.offset.load(std::memory_order_relaxed));
+
+                insert(*new_table, msb, lsb,
+                    hash(naming::gid_type(msb, lsb)), g);
+            }
+
+            tables.reserve(tables.size() + 1);
+            current.store(new_table.get(), std::memory_order_release);
+            tables.push_back(HPX_MOVE(new_table));
+
+            for (std::size_t i = 0; i != old_table.size(); ++i)
+            {
+                if (!old_table.slots[i].empty())
+                    old_table.slots[i].reset();
+            }
+        }
+
+        // the table currently in use, read without holding the lock
+        std::atomic<table*> current{nullptr};
+
+        mutable mutex_type mtx;
+
+        // all tables ever used by this shard, the last one is current
+        std::vector<std::unique_ptr<table>> tables;
+
+        std::size_t count = 0;
+        std::size_t max_count = 0;
+        std::size_t hand = 0;
+    };
+
+    struct alignas(threads::get_cache_line_size()) gva_cache::shard_statistics
+    {
+        std::atomic<std::uint64_t> insertions{0};
+        std::atomic<std::uint64_t> evictions{0};
+        std::atomic<std::uint64_t> update_entry_count{0};
+        std::atomic<std::uint64_t> erase_entry_count{0};
+    };
+
+    // Lookups are counted per thread, the counters are written by the owning
+    // thread(s) only.
+    struct alignas(threads::get_cache_line_size()) gva_cache::lookup_statistics
+    {
+        std::atomic<std::uint64_t> hits{0};
+        std::atomic<std::uint64_t> misses{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t gva_cache::hash(naming::gid_type const& gid) noexcept
+    {
+        std::uint64_t const h =
+            gid.get_lsb() ^ (gid.get_msb() * 0xff51afd7ed558ccdull);
+        return h * 0x9e3779b97f4a7c15ull;
+    }
+
+    template <typename F>
+    std::uint64_t gva_cache::accumulate(F&& f) const noexcept
+    {
+        std::uint64_t result = 0;
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            result += f(statistics_[i]);
+        }
+        return result;
+    }
+
+    template <typename F>
+    std::uint64_t gva_cache::accumulate_lookups(F&& f) const noexcept
+    {
+        std::uint64_t result = 0;
+        for (std::size_t i = 0; i != num_lookup_slots; ++i)
+        {
+            result += f(lookup_statistics_[i]);
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::gva_cache(std::size_t max_size)
+      : max_size_(max_size)
+      , shards_(new shard[num_shards])
+      , statistics_(new shard_statistics[num_shards])
+      , lookup_statistics_(new lookup_statistics[num_lookup_slots])
+    {
+        std::size_t const max_count = shard_capacity(max_size);
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            shard& s = shards_[i];
+            s.max_count = max_count;
+            s.tables.push_back(std::make_unique<table>(table_bits(max_count)));
+            s.current.store(s.tables.back().get(), std::memory_order_release);
+        }
+    }
+
+    gva_cache::~gva_cache() = default;
+
+    std::size_t gva_cache::size() const
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            shard const& s = shards_[i];
+
+            std::lock_guard<mutex_type> l(s.mtx);
+            result += s.count;
+        }
+        return result;
+    }
+
+    std::size_t gva_cache::capacity() const noexcept
+    {
+        return max_size_.load(std::memory_order_relaxed);
+    }
+
+    void gva_cache::reserve(std::size_t max_size)
+    {
+        max_size_.store(max_size, std::memory_order_relaxed);
+
+        std::size_t const max_count = shard_capacity(max_size);
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            shard& s = shards_[i];
+            shard_statistics& stats = statistics_[i];
+
+            std::lock_guard<mutex_type> l(s.mtx);
+
+            s.max_count = max_count;
+
+            table& t = *s.current.load(std::memory_order_relaxed);
+            if (max_count != 0)
+            {
+                while (s.count > max_count)
+                {
+                    s.evict_one(t);
+                    stats.evictions.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            int const bits =
+                table_bits(max_count != 0 ? max_count : 2 * s.count);
+            if (bits != t.bits)
+            {
+                s.rehash(bits);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::get_entry(
+        naming::gid_type const& gid, gva& g) const noexcept
+    {
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+        std::uint64_t const h = hash(gid);
+
+        std::size_t const shard_idx = shard_index(h);
+        shard const& s = shards_[shard_idx];
+        lookup_statistics& stats = lookup_statistics_[lookup_slot()];
+
+        table const* t = s.current.load(std::memory_order_acquire);
+
+        std::size_t const mask = t->mask();
+        std::size_t pos = home_slot(t->bits, h);
+        for (std::size_t i = 0; i <= mask; ++i, pos = (pos + 1) & mask)
+        {
+            slot& sl = t->slots[pos];
+
+            std::uint64_t key_msb = 0;
+            std::uint64_t key_lsb = 0;
+            bool found = false;
+
+            while (true)
+            {
+                std::uint64_t const seq =
+                    sl.seq.load(std::memory_order_acquire);
+                if (seq & 1)
+                {
+                    HPX_SMT_PAUSE;
+                    continue;
+                }
+
+                key_msb = sl.key_msb.load(std::memory_order_relaxed);
+                key_lsb = sl.key_lsb.load(std::memory_order_relaxed);
+
+                found = key_msb == msb && key_lsb == lsb;
+                if (found)
+                {
+                    g.prefix = naming::gid_type(
+                        sl.prefix_msb.load(std::memory_order_relaxed),
+                        sl.prefix_lsb.load(std::memory_order_relaxed));
+                    g.type = sl.type.load(std::memory_order_relaxed);
+                    g.count = sl.count.load(std::memory_order_relaxed);
+                    g.lva(reinterpret_cast<gva::lva_type>(
+                        sl.lva.load(std::memory_order_relaxed)));
+                    g.offset = sl.offset.load(std::memory_order_relaxed);
+                }
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sl.seq.load(std::memory_order_relaxed) == seq)
+                    break;
+            }
+
+            if (found)
+            {
+                // avoid writing to the slot if not necessary
+                if (!sl.referenced.load(std::memory_order_relaxed))
+                {
+                    sl.referenced.store(true, std::memory_order_relaxed);
+                }
+                stats.hits.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            if (key_msb == 0 && key_lsb == 0)
+                break;
+        }
+
+        stats.misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    void gva_cache::update(naming::gid_type const& gid, gva const& g)
+    {
+        HPX_ASSERT(gid != naming::invalid_gid);
+
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+        std::uint64_t const h = hash(gid);
+
+        std::size_t const shard_idx = shard_index(h);
+        shard& s = shards_[shard_idx];
+        shard_statistics& stats = statistics_[shard_idx];
+
+        stats.update_entry_count.fetch_add(1, std::memory_order_relaxed);
+
+        std::lock_guard<mutex_type> l(s.mtx);
+
+        table* t = s.current.load(std::memory_order_relaxed);
+        if (std::size_t const pos = s.find(*t, msb, lsb, h);
+            pos != shard::npos)
+        {
+            t->slots[pos].assign(msb, lsb, g);
+            return;
+        }
+
+        if (s.max_count != 0)
+        {
+            if (s.count >= s.max_count)
+            {
+                s.evict_one(*t);
+                stats.evictions.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        else if (2 * (s.count + 1) > t->size())
+        {
+            s.rehash(t->bits + 1);
+            t = s.current.load(std::memory_order_relaxed);
+        }
+
+        shard::insert(*t, msb, lsb, h, g);
+        ++s.count;
+
+        stats.insertions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool gva_cache::erase(naming::gid_type const& gid)
+    {
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+        std::uint64_t const h = hash(gid);
+
+        std::size_t const shard_idx = shard_index(h);
+        shard& s = shards_[shard_idx];
+
+        statistics_[shard_idx].erase_entry_count.fetch_add(
+            1, std::memory_order_relaxed);
+
+        std::lock_guard<mutex_type> l(s.mtx);
+
+        table& t = *s.current.load(std::memory_order_relaxed);
+        std::size_t const pos = s.find(t, msb, lsb, h);
+        if (pos == shard::npos)
+            return false;
+
+        s.erase_at(t, pos);
+        return true;
+    }
+
+    std::size_t gva_cache::clear()
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            shard& s = shards_[i];
+
+            std::lock_guard<mutex_type> l(s.mtx);
+
+            table& t = *s.current.load(std::memory_order_relaxed);
+            for (std::size_t j = 0; j != t.size(); ++j)
+            {
+                if (!t.slots[j].empty())
+                    t.slots[j].reset();
+            }
+
+            result += s.count;
+            s.count = 0;
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t gva_cache::hits(bool reset) const noexcept
+    {
+        return accumulate_lookups([reset](lookup_statistics& stats) {
+            return util::get_and_reset_value(stats.hits, reset);
+        });
+    }
+
+    std::uint64_t gva_cache::misses(bool reset) const noexcept
+    {
+        return accumulate_lookups([reset](lookup_statistics& stats) {
+            return util::get_and_reset_value(stats.misses, reset);
+        });
+    }
+
+    std::uint64_t gva_cache::insertions(bool reset) const noexcept
+    {
+        return accumulate([reset](shard_statistics& stats) {
+            return util::get_and_reset_value(stats.insertions, reset);
+        });
+    }
+
+    std::uint64_t gva_cache::evictions(bool reset) const noexcept
+    {
+        return accumulate([reset](shard_statistics& stats) {
+            return util::get_and_reset_value(stats.evictions, reset);
+        });
+    }
+
+    // lookups are not counted separately to keep the lookup path as cheap as
+    // possible, every lookup is either a hit or a miss
+    std::uint64_t gva_cache::get_entry_count(bool) const noexcept
+    {
+        return accumulate_lookups([](lookup_statistics& stats) {
+            return stats.hits.load(std::memory_order_relaxed) +
+                stats.misses.load(std::memory_order_relaxed);
+        });
+    }
+
+    std::uint64_t gva_cache::update_entry_count(bool reset) const noexcept
+    {
+        return accumulate([reset](shard_statistics& stats) {
+            return util::get_and_reset_value(stats.update_entry_count, reset);
+        });
+    }
+
+    std::uint64_t gva_cache::erase_entry_count(bool reset) const noexcept
+    {
+        return accumulate([reset](shard_statistics& stats) {
+            return util::get_and_reset_value(stats.erase_entry_count, reset);
+        });
+    }
+}    // namespace hpx::agas::detail
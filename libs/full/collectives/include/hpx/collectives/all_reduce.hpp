@@ -210,6 +210,71 @@ namespace hpx { namespace collectives {
     decltype(auto) all_reduce(hpx::launch::sync_policy, communicator comm,
         T&& result, F&& op, generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllReduce a vector element-wise using point-to-point communication
+    ///
+    /// This function reduces the elements of the vectors supplied by all
+    /// participating sites without funneling the data through a single site.
+    /// The algorithm is selected based on the size of the vector and the
+    /// number of participating sites: small vectors are reduced by exchanging
+    /// them using recursive doubling, larger vectors are split into one
+    /// segment per site which are reduced using recursive vector halving
+    /// and doubling (for a power of two number of sites) or along a ring.
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  result      The vector to transmit to all
+    ///                     participating sites from this call site. All sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply to the elements of all
+    ///                     vectors supplied from all participating sites. It
+    ///                     has to be associative and commutative.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the all_reduce operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    ///
+    /// \returns    This function returns a future holding the reduced vector.
+    ///             It will become ready once the all_reduce operation has been
+    ///             completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> all_reduce(channel_communicator comm,
+        std::vector<T> result, F&& op,
+        generation_arg generation = generation_arg());
+
+    /// AllReduce a vector element-wise using point-to-point communication
+    ///
+    /// This function reduces the elements of the vectors supplied by all
+    /// participating sites without funneling the data through a single site.
+    ///
+    /// \param  policy      The execution policy specifying synchronous execution.
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  result      The vector to transmit to all
+    ///                     participating sites from this call site. All sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply to the elements of all
+    ///                     vectors supplied from all participating sites. It
+    ///                     has to be associative and commutative.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the all_reduce operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    ///
+    /// \returns    This function returns the reduced vector. This function
+    ///             executes synchronously and directly returns the result.
+    ///
+    template <typename T, typename F>
+    std::vector<T> all_reduce(hpx::launch::sync_policy,
+        channel_communicator comm, std::vector<T> result, F&& op,
+        generation_arg generation = generation_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -223,7 +288,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/reduce_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/modules/type_support.hpp>
@@ -232,6 +299,7 @@ namespace hpx { namespace collectives {
 #include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::traits {
 
@@ -423,6 +491,50 @@ namespace hpx::collectives {
             HPX_FORWARD(T, local_result), HPX_FORWARD(F, op), this_site)
             .get();
     }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // all_reduce vectors using point-to-point communication
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> all_reduce(channel_communicator comm,
+        std::vector<T> local_result, F&& op,
+        generation_arg generation = generation_arg())
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<T>>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::all_reduce",
+                    "the generation number shouldn't be zero"));
+        }
+        if (generation.is_default())
+        {
+            generation = 1;
+        }
+
+        // Handle operation right away if there is only one value.
+        if (comm.get_info().first == 1)
+        {
+            return hpx::make_ready_future(HPX_MOVE(local_result));
+        }
+
+        return hpx::async(
+            [comm = HPX_MOVE(comm), local_result = HPX_MOVE(local_result),
+                op = HPX_FORWARD(F, op), generation]() mutable {
+                detail::segmented_all_reduce(
+                    comm, local_result, op, generation);
+                return HPX_MOVE(local_result);
+            });
+    }
+
+    template <typename T, typename F>
+    std::vector<T> all_reduce(hpx::launch::sync_policy,
+        channel_communicator comm, std::vector<T> local_result, F&& op,
+        generation_arg const generation = generation_arg())
+    {
+        return all_reduce(HPX_MOVE(comm), HPX_MOVE(local_result),
+            HPX_FORWARD(F, op), generation)
+            .get();
+    }
 }    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
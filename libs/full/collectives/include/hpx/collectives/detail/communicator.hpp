@@ -15,6 +15,7 @@
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/datastructures/any.hpp>
 #include <hpx/functional/experimental/scope_exit.hpp>
+#include <hpx/futures/future.hpp>
 #include <hpx/lcos_local/and_gate.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/lock_registration.hpp>
@@ -23,6 +24,8 @@
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <cstddef>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <type_traits>
 #include <utility>
@@ -181,7 +184,93 @@ namespace hpx::collectives::detail {
         {
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Persistent collective operations (see hpx/collectives/persistent.hpp)
+        // keep their state on the root site for the lifetime of the
+        // communicator. The state is created by the first site initializing
+        // the operation identified by the given tag, all rounds started later
+        // on bypass the generation handling used by the other operations.
+        template <typename State, typename... Args>
+        void persistent_init(std::size_t tag, Args... args)
+        {
+            {
+                std::unique_lock l(mtx_);
+                if (auto const it = persistent_data_.find(tag);
+                    it != persistent_data_.end())
+                {
+                    if (hpx::any_cast<std::shared_ptr<State>>(&it->second) ==
+                        nullptr)
+                    {
+                        l.unlock();
+                        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                            "communicator::persistent_init",
+                            "communicator {}: the tag {} is already in use by "
+                            "a different persistent collective operation",
+                            basename_, tag);
+                    }
+                    return;
+                }
+            }
+
+            // allocate the state outside the lock, another site may have
+            // created it concurrently
+            auto state = std::make_shared<State>(num_sites_, HPX_MOVE(args)...);
+
+            std::lock_guard l(mtx_);
+            persistent_data_.try_emplace(tag, HPX_MOVE(state));
+        }
+
+        template <typename State, typename... Args>
+        struct persistent_init_direct_action
+          : hpx::actions::direct_action<void (communicator_server::*)(
+                                            std::size_t, Args...),
+                &communicator_server::persistent_init<State, Args...>,
+                persistent_init_direct_action<State, Args...>>
+        {
+        };
+
+        // The result is sent back in a form that allows the calling site to
+        // deserialize it directly into its buffer at the given address.
+        template <typename State, typename T>
+        hpx::future<typename State::response_type> persistent_start(
+            std::size_t which, std::size_t tag, std::size_t round, T value,
+            std::size_t target)
+        {
+            return access_persistent_state<State>(tag).start(
+                which, round, HPX_MOVE(value), target);
+        }
+
+        template <typename State, typename T>
+        struct persistent_start_direct_action
+          : hpx::actions::direct_action<
+                hpx::future<typename State::response_type> (
+                    communicator_server::*)(
+                    std::size_t, std::size_t, std::size_t, T, std::size_t),
+                &communicator_server::persistent_start<State, T>,
+                persistent_start_direct_action<State, T>>
+        {
+        };
+
     private:
+        template <typename State>
+        State& access_persistent_state(std::size_t tag)
+        {
+            std::unique_lock l(mtx_);
+            auto const it = persistent_data_.find(tag);
+            if (it == persistent_data_.end())
+            {
+                l.unlock();
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "communicator::access_persistent_state",
+                    "communicator {}: no persistent collective operation was "
+                    "initialized for tag {}",
+                    basename_, tag);
+            }
+
+            // entries are never removed, the state is stable
+            return *hpx::any_cast<std::shared_ptr<State>&>(it->second);
+        }
+
         [[nodiscard]] constexpr std::size_t get_num_sites(
             std::size_t num_values) const noexcept
         {
@@ -445,6 +534,7 @@ namespace hpx::collectives::detail {
         friend struct hpx::traits::communication_operation;
 
         hpx::unique_any_nonser data_;
+        std::map<std::size_t, hpx::unique_any_nonser> persistent_data_;
         hpx::lcos::local::and_gate gate_;
         std::size_t const num_sites_;
         std::size_t on_ready_count_ = 0;
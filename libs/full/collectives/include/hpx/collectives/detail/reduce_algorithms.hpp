@@ -0,0 +1,468 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+// The algorithms below implement element-wise reductions of vectors using
+// point-to-point communication through a channel_communicator. All of them
+// have to be invoked on an HPX thread, they suspend while waiting for data.
+namespace hpx::collectives::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    enum class reduce_algorithm
+    {
+        // log(p) exchanges of the whole vector, latency-optimal
+        recursive_doubling,
+        // reduce-scatter by recursive vector halving followed by an
+        // all-gather by recursive vector doubling, requires a power of two
+        // number of sites
+        recursive_halving,
+        // 2 * (p - 1) exchanges of 1/p of the vector, bandwidth-optimal
+        ring
+    };
+
+    // Vectors smaller than this (in bytes) are reduced using recursive
+    // doubling, the cost of those is dominated by the latency.
+    inline constexpr std::size_t small_reduce_size = 64 * 1024;
+
+    constexpr bool is_power_of_two(std::size_t n) noexcept
+    {
+        return n != 0 && (n & (n - 1)) == 0;
+    }
+
+    constexpr reduce_algorithm select_all_reduce_algorithm(
+        std::size_t num_sites, std::size_t num_elements,
+        std::size_t size) noexcept
+    {
+        if (size < small_reduce_size || num_elements < num_sites)
+        {
+            return reduce_algorithm::recursive_doubling;
+        }
+        return is_power_of_two(num_sites) ? reduce_algorithm::recursive_halving :
+                                            reduce_algorithm::ring;
+    }
+
+    constexpr reduce_algorithm select_reduce_scatter_algorithm(
+        std::size_t num_sites) noexcept
+    {
+        return is_power_of_two(num_sites) ? reduce_algorithm::recursive_halving :
+                                            reduce_algorithm::ring;
+    }
+
+    // The vector is split into num_sites segments of (almost) equal size,
+    // segment i is owned by site i after a reduce-scatter.
+    constexpr std::size_t segment_begin(
+        std::size_t num_elements, std::size_t num_sites, std::size_t i) noexcept
+    {
+        return i * (num_elements / num_sites) +
+            (std::min) (i, num_elements % num_sites);
+    }
+
+    // The tags used by the algorithms are derived from the generation of the
+    // operation and the number of the communication step. They are placed
+    // in the upper half of the tag space to avoid conflicts with tags used
+    // for explicit set/get operations on the same communicator.
+    constexpr std::size_t reduce_tag(
+        std::size_t generation, std::size_t step) noexcept
+    {
+        constexpr std::size_t reserved_tags =
+            std::size_t(1) << (sizeof(std::size_t) * 8 - 1);
+        return reserved_tags | (generation << 20) | step;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    void reduce_elements(std::vector<T>& data, std::size_t begin,
+        std::vector<T> const& received, F& op, bool received_first)
+    {
+        HPX_ASSERT(begin + received.size() <= data.size());
+
+        // the operands are always passed in the order of the sites they
+        // came from, which ensures identical results on both sides of a
+        // pairwise exchange
+        auto it = data.begin() + begin;
+        if (received_first)
+        {
+            for (auto const& value : received)
+            {
+                *it = op(value, *it);
+                ++it;
+            }
+        }
+        else
+        {
+            for (auto const& value : received)
+            {
+                *it = op(*it, value);
+                ++it;
+            }
+        }
+    }
+
+    template <typename T>
+    hpx::future<void> send_elements(channel_communicator const& comm,
+        std::size_t site, std::vector<T> const& data, std::size_t begin,
+        std::size_t end, std::size_t tag)
+    {
+        return collectives::set(comm, that_site_arg(site),
+            std::vector<T>(data.begin() + begin, data.begin() + end),
+            tag_arg(tag));
+    }
+
+    template <typename T>
+    std::vector<T> receive_elements(
+        channel_communicator const& comm, std::size_t site, std::size_t tag)
+    {
+        return collectives::get<std::vector<T>>(
+            comm, that_site_arg(site), tag_arg(tag))
+            .get();
+    }
+
+    inline void wait_for_sends(std::vector<hpx::future<void>>& sends)
+    {
+        // rethrows the first error, if any
+        for (hpx::future<void>& f : sends)
+        {
+            f.get();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reduce the whole vector by exchanging it with a different partner in
+    // each step. If the number of sites is not a power of two, the first
+    // sites fold their data into their neighbors first and receive the
+    // result from those at the end.
+    template <typename T, typename F>
+    void recursive_doubling_all_reduce(channel_communicator const& comm,
+        std::vector<T>& data, F& op, std::size_t generation)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+
+        std::size_t pof2 = 1;
+        while (pof2 * 2 <= num_sites)
+            pof2 *= 2;
+
+        std::size_t const rem = num_sites - pof2;
+        std::size_t step = 0;
+
+        std::vector<hpx::future<void>> sends;
+
+        // fold the excess sites into their right neighbors
+        std::size_t new_site = this_site;
+        if (this_site >= 2 * rem)
+        {
+            new_site = this_site - rem;
+        }
+        else
+        {
+            if (this_site % 2 == 0)
+            {
+                sends.push_back(send_elements(comm, this_site + 1, data, 0,
+                    data.size(), reduce_tag(generation, step)));
+                new_site = static_cast<std::size_t>(-1);
+            }
+            else
+            {
+                std::vector<T> received = receive_elements<T>(
+                    comm, this_site - 1, reduce_tag(generation, step));
+                reduce_elements(data, 0, received, op, true);
+                new_site = this_site / 2;
+            }
+        }
+        ++step;
+
+        if (new_site != static_cast<std::size_t>(-1))
+        {
+            for (std::size_t mask = 1; mask < pof2; mask *= 2, ++step)
+            {
+                std::size_t const new_partner = new_site ^ mask;
+                std::size_t const partner = new_partner < rem ?
+                    new_partner * 2 + 1 :
+                    new_partner + rem;
+
+                sends.push_back(send_elements(comm, partner, data, 0,
+                    data.size(), reduce_tag(generation, step)));
+
+                std::vector<T> received = receive_elements<T>(
+                    comm, partner, reduce_tag(generation, step));
+                reduce_elements(
+                    data, 0, received, op, partner < this_site);
+            }
+        }
+        else
+        {
+            // skip the steps of the sites taking part in the exchange
+            for (std::size_t mask = 1; mask < pof2; mask *= 2)
+                ++step;
+        }
+
+        // hand the result back to the folded sites
+        if (this_site < 2 * rem)
+        {
+            if (this_site % 2 == 0)
+            {
+                data = receive_elements<T>(
+                    comm, this_site + 1, reduce_tag(generation, step));
+            }
+            else
+            {
+                sends.push_back(send_elements(comm, this_site - 1, data, 0,
+                    data.size(), reduce_tag(generation, step)));
+            }
+        }
+
+        wait_for_sends(sends);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reduce-scatter by recursive vector halving, requires a power of two
+    // number of sites. In each step the sites exchange half of their
+    // remaining segments with a partner. Afterwards the segment of this site
+    // holds the reduction result.
+    template <typename T, typename F>
+    std::size_t recursive_halving_reduce_scatter(
+        channel_communicator const& comm, std::vector<T>& data, F& op,
+        std::size_t generation, std::size_t step = 0)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+        HPX_ASSERT(is_power_of_two(num_sites));
+
+        std::size_t const size = data.size();
+
+        std::vector<hpx::future<void>> sends;
+
+        std::size_t first = 0;
+        std::size_t last = num_sites;
+        for (std::size_t mask = num_sites / 2; mask != 0; mask /= 2, ++step)
+        {
+            std::size_t const partner = this_site ^ mask;
+            std::size_t const middle = first + mask;
+
+            // keep the half of the segments which holds the segment of
+            // this site, send the other half
+            std::size_t send_first = first;
+            std::size_t send_last = middle;
+            if ((this_site & mask) == 0)
+            {
+                send_first = middle;
+                send_last = last;
+                last = middle;
+            }
+            else
+            {
+                first = middle;
+            }
+
+            sends.push_back(send_elements(comm, partner, data,
+                segment_begin(size, num_sites, send_first),
+                segment_begin(size, num_sites, send_last),
+                reduce_tag(generation, step)));
+
+            std::vector<T> received = receive_elements<T>(
+                comm, partner, reduce_tag(generation, step));
+            reduce_elements(data, segment_begin(size, num_sites, first),
+                received, op, partner < this_site);
+        }
+        HPX_ASSERT(first == this_site && last == this_site + 1);
+
+        wait_for_sends(sends);
+        return step;
+    }
+
+    // All-gather by recursive vector doubling, requires a power of two
+    // number of sites. In each step the sites exchange all segments they
+    // have collected so far with a partner.
+    template <typename T>
+    void recursive_doubling_all_gather(channel_communicator const& comm,
+        std::vector<T>& data, std::size_t generation, std::size_t step = 0)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+        HPX_ASSERT(is_power_of_two(num_sites));
+
+        std::size_t const size = data.size();
+
+        std::vector<hpx::future<void>> sends;
+
+        for (std::size_t mask = 1; mask < num_sites; mask *= 2, ++step)
+        {
+            std::size_t const partner = this_site ^ mask;
+
+            // the collected segments form an aligned block of mask segments
+            std::size_t const first = this_site & ~(mask - 1);
+            std::size_t const partner_first = partner & ~(mask - 1);
+
+            sends.push_back(send_elements(comm, partner, data,
+                segment_begin(size, num_sites, first),
+                segment_begin(size, num_sites, first + mask),
+                reduce_tag(generation, step)));
+
+            std::vector<T> received = receive_elements<T>(
+                comm, partner, reduce_tag(generation, step));
+            HPX_ASSERT(received.size() ==
+                segment_begin(size, num_sites, partner_first + mask) -
+                    segment_begin(size, num_sites, partner_first));
+
+            std::move(received.begin(), received.end(),
+                data.begin() + segment_begin(size, num_sites, partner_first));
+        }
+
+        wait_for_sends(sends);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reduce-scatter along a ring, each site sends one segment to its right
+    // neighbor and reduces the segment received from its left neighbor in
+    // each of the num_sites - 1 steps. Afterwards the segment of this site
+    // holds the reduction result.
+    template <typename T, typename F>
+    std::size_t ring_reduce_scatter(channel_communicator const& comm,
+        std::vector<T>& data, F& op, std::size_t generation,
+        std::size_t step = 0)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+
+        std::size_t const size = data.size();
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        std::vector<hpx::future<void>> sends;
+        sends.reserve(num_sites - 1);
+
+        for (std::size_t s = 0; s != num_sites - 1; ++s, ++step)
+        {
+            std::size_t const send_segment =
+                (this_site + 2 * num_sites - s - 1) % num_sites;
+            std::size_t const receive_segment =
+                (this_site + 2 * num_sites - s - 2) % num_sites;
+
+            sends.push_back(send_elements(comm, right, data,
+                segment_begin(size, num_sites, send_segment),
+                segment_begin(size, num_sites, send_segment + 1),
+                reduce_tag(generation, step)));
+
+            std::vector<T> received = receive_elements<T>(
+                comm, left, reduce_tag(generation, step));
+            reduce_elements(data,
+                segment_begin(size, num_sites, receive_segment), received, op,
+                true);
+        }
+
+        wait_for_sends(sends);
+        return step;
+    }
+
+    // All-gather along a ring, each site forwards the segment received last
+    // to its right neighbor in each of the num_sites - 1 steps.
+    template <typename T>
+    void ring_all_gather(channel_communicator const& comm, std::vector<T>& data,
+        std::size_t generation, std::size_t step = 0)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+
+        std::size_t const size = data.size();
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        std::vector<hpx::future<void>> sends;
+        sends.reserve(num_sites - 1);
+
+        for (std::size_t s = 0; s != num_sites - 1; ++s, ++step)
+        {
+            std::size_t const send_segment =
+                (this_site + num_sites - s) % num_sites;
+            std::size_t const receive_segment =
+                (this_site + 2 * num_sites - s - 1) % num_sites;
+
+            sends.push_back(send_elements(comm, right, data,
+                segment_begin(size, num_sites, send_segment),
+                segment_begin(size, num_sites, send_segment + 1),
+                reduce_tag(generation, step)));
+
+            std::vector<T> received = receive_elements<T>(
+                comm, left, reduce_tag(generation, step));
+            std::move(received.begin(), received.end(),
+                data.begin() +
+                    segment_begin(size, num_sites, receive_segment));
+        }
+
+        wait_for_sends(sends);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    void segmented_all_reduce(channel_communicator const& comm,
+        std::vector<T>& data, F& op, std::size_t generation)
+    {
+        std::size_t const num_sites = comm.get_info().first;
+
+        switch (select_all_reduce_algorithm(
+            num_sites, data.size(), data.size() * sizeof(T)))
+        {
+        case reduce_algorithm::recursive_doubling:
+            recursive_doubling_all_reduce(comm, data, op, generation);
+            break;
+
+        case reduce_algorithm::recursive_halving:
+        {
+            std::size_t const step =
+                recursive_halving_reduce_scatter(comm, data, op, generation);
+            recursive_doubling_all_gather(comm, data, generation, step);
+            break;
+        }
+
+        case reduce_algorithm::ring:
+        {
+            std::size_t const step =
+                ring_reduce_scatter(comm, data, op, generation);
+            ring_all_gather(comm, data, generation, step);
+            break;
+        }
+        }
+    }
+
+    template <typename T, typename F>
+    std::vector<T> segmented_reduce_scatter(channel_communicator const& comm,
+        std::vector<T>& data, F& op, std::size_t generation)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+
+        if (select_reduce_scatter_algorithm(num_sites) ==
+            reduce_algorithm::recursive_halving)
+        {
+            recursive_halving_reduce_scatter(comm, data, op, generation);
+        }
+        else
+        {
+            ring_reduce_scatter(comm, data, op, generation);
+        }
+
+        std::size_t const size = data.size();
+        auto const first =
+            data.begin() + segment_begin(size, num_sites, this_site);
+        auto const last =
+            data.begin() + segment_begin(size, num_sites, this_site + 1);
+
+        return std::vector<T>(
+            std::make_move_iterator(first), std::make_move_iterator(last));
+    }
+}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
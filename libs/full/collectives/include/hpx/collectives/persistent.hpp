@@ -0,0 +1,625 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file persistent.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// A persistent collective operation
+    ///
+    /// Objects of this type are returned from \a all_reduce_init,
+    /// \a all_gather_init, and \a broadcast_init. They represent a collective
+    /// operation that was set up once and that can be executed repeatedly
+    /// (in rounds) with minimal overhead. All buffers needed on the root site
+    /// of the underlying communicator and the buffers receiving the results
+    /// on each site are allocated when the operation is initialized, starting
+    /// a round does not involve any generation handling.
+    ///
+    /// Every participating site has to start the same sequence of rounds. A
+    /// site may start a new round only after the future returned from the
+    /// previous round has become ready. The result of a round refers to a
+    /// buffer owned by this object, it stays valid until the next but one
+    /// round is started.
+    template <typename T, typename Result = T>
+    class persistent_collective
+    {
+    public:
+        /// Start the next round of the persistent collective operation
+        ///
+        /// \param value    The value to contribute from this call site
+        ///
+        /// \returns    This function returns a future referring to the result
+        ///             of the current round. It will become ready once all
+        ///             sites have started the round.
+        hpx::future<Result const&> start(T value);
+
+        /// Start the next round of the persistent collective operation
+        /// without contributing a value. This is meant to be used by the
+        /// sites receiving the value of a persistent broadcast operation.
+        hpx::future<Result const&> start();
+
+        /// Start the next round of the persistent collective operation and
+        /// wait for its result
+        Result const& start(hpx::launch::sync_policy, T value);
+
+        /// Start the next round of the persistent collective operation
+        /// without contributing a value and wait for its result
+        Result const& start(hpx::launch::sync_policy);
+
+        /// Return the number of rounds started on this site so far
+        std::size_t rounds() const noexcept;
+
+        /// Return whether this object refers to an initialized persistent
+        /// collective operation
+        explicit operator bool() const noexcept;
+    };
+
+    /// Initialize a persistent all_reduce operation
+    ///
+    /// This function creates a persistent all_reduce operation on the given
+    /// communicator, similar to MPI_Allreduce_init. The buffers needed for
+    /// the reduction are allocated once on the root site of the communicator
+    /// using the given value as their initial value (for instance a vector
+    /// of the size used in each round).
+    ///
+    /// \param  comm        A communicator object returned from \a create_communicator
+    /// \param  shape       The value used to preallocate the buffers for the
+    ///                     data contributed by each site
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites
+    /// \param  this_site   The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param  tag         The tag identifying this persistent operation on the
+    ///                     given communicator. All sites have to use the same
+    ///                     tag. This value is optional and defaults to '0'
+    ///                     (zero), it has to be specified if more than one
+    ///                     persistent operation is created on the same
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the persistent
+    ///             collective operation. Calling \a start on it executes one
+    ///             round of the all_reduce operation.
+    ///
+    template <typename T, typename F>
+    hpx::future<persistent_collective<std::decay_t<T>>> all_reduce_init(
+        communicator comm, T&& shape, F&& op,
+        this_site_arg this_site = this_site_arg(), tag_arg tag = tag_arg());
+
+    /// Initialize a persistent all_gather operation
+    ///
+    /// This function creates a persistent all_gather operation on the given
+    /// communicator, similar to MPI_Allgather_init. The buffers needed for
+    /// the gathered data are allocated once on the root site of the
+    /// communicator using the given value as their initial value.
+    ///
+    /// \param  comm        A communicator object returned from \a create_communicator
+    /// \param  shape       The value used to preallocate the buffers for the
+    ///                     data contributed by each site
+    /// \param  this_site   The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param  tag         The tag identifying this persistent operation on the
+    ///                     given communicator. All sites have to use the same
+    ///                     tag. This value is optional and defaults to '0'
+    ///                     (zero).
+    ///
+    /// \returns    This function returns a future holding the persistent
+    ///             collective operation. Calling \a start on it executes one
+    ///             round of the all_gather operation.
+    ///
+    template <typename T>
+    hpx::future<persistent_collective<std::decay_t<T>,
+        std::vector<std::decay_t<T>>>>
+    all_gather_init(communicator comm, T&& shape,
+        this_site_arg this_site = this_site_arg(), tag_arg tag = tag_arg());
+
+    /// Initialize a persistent broadcast operation
+    ///
+    /// This function creates a persistent broadcast operation on the given
+    /// communicator, similar to MPI_Bcast_init. In each round the value
+    /// contributed by the root site is distributed to all sites.
+    ///
+    /// \param  comm        A communicator object returned from \a create_communicator
+    /// \param  shape       The value used to preallocate the buffers for the
+    ///                     broadcast data
+    /// \param  this_site   The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param  root_site   The site that contributes the value in each round.
+    ///                     This value is optional and defaults to '0' (zero).
+    /// \param  tag         The tag identifying this persistent operation on the
+    ///                     given communicator. All sites have to use the same
+    ///                     tag. This value is optional and defaults to '0'
+    ///                     (zero).
+    ///
+    /// \returns    This function returns a future holding the persistent
+    ///             collective operation. Calling \a start on it executes one
+    ///             round of the broadcast operation.
+    ///
+    template <typename T>
+    hpx::future<persistent_collective<std::decay_t<T>>> broadcast_init(
+        communicator comm, T&& shape,
+        this_site_arg this_site = this_site_arg(),
+        root_site_arg root_site = root_site_arg(), tag_arg tag = tag_arg());
+}}    // namespace hpx::collectives
+
+// clang-format on
+#else
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Finalizers of the supported persistent operations, they compute the
+    // result of a round from the data contributed by all sites. The result
+    // is assigned to the buffers allocated when the operation was
+    // initialized, which reuses their storage in every round.
+    template <typename T, typename F>
+    struct persistent_all_reduce_op
+    {
+        using result_type = T;
+
+        static T initial_result(std::size_t, T const& shape)
+        {
+            return shape;
+        }
+
+        void operator()(std::vector<T>& data, T& result)
+        {
+            // operand order follows the site order, the data of the sites
+            // stays in place for the next but one round
+            result = data[0];
+            for (std::size_t i = 1; i != data.size(); ++i)
+            {
+                result = op(HPX_MOVE(result), data[i]);
+            }
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & op;
+            // clang-format on
+        }
+
+        F op;
+    };
+
+    template <typename T>
+    struct persistent_all_gather_op
+    {
+        using result_type = std::vector<T>;
+
+        static std::vector<T> initial_result(
+            std::size_t num_sites, T const& shape)
+        {
+            return std::vector<T>(num_sites, shape);
+        }
+
+        void operator()(std::vector<T>& data, std::vector<T>& result) const
+        {
+            result.swap(data);
+        }
+
+        template <typename Archive>
+        void serialize(Archive&, unsigned)
+        {
+        }
+    };
+
+    template <typename T>
+    struct persistent_broadcast_op
+    {
+        using result_type = T;
+
+        static T initial_result(std::size_t, T const& shape)
+        {
+            return shape;
+        }
+
+        void operator()(std::vector<T>& data, T& result) const
+        {
+            result = data[root];
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & root;
+            // clang-format on
+        }
+
+        std::size_t root = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Response of the root site to a site starting a round. The starting site
+    // passes the address of its buffer for the round along with its data and
+    // the root site sends it back together with the result, which is then
+    // deserialized directly into that buffer. If the root site is local, the
+    // result is copied into the buffer instead.
+    template <typename Result>
+    struct persistent_response
+    {
+        Result const& get() const
+        {
+            if (source != target)
+            {
+                *target = *source;
+            }
+            return *target;
+        }
+
+        Result* target = nullptr;
+        Result const* source = nullptr;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void save(Archive& ar, unsigned) const
+        {
+            auto const address = reinterpret_cast<std::size_t>(target);
+
+            // clang-format off
+            ar << address << *source;
+            // clang-format on
+        }
+
+        template <typename Archive>
+        void load(Archive& ar, unsigned)
+        {
+            std::size_t address = 0;
+            ar >> address;
+
+            target = reinterpret_cast<Result*>(address);
+            source = target;
+
+            // clang-format off
+            ar >> *target;
+            // clang-format on
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // State of a persistent collective operation, held by the root site of
+    // the communicator. The data of two consecutive rounds is kept separately
+    // as a site may start the next round as soon as it has received the
+    // result of the current one. A site can't start the round after that
+    // before all sites have received the result of the current round, which
+    // makes the buffers of the current round available again.
+    template <typename T, typename Finalizer>
+    class persistent_state
+    {
+    public:
+        using result_type = typename Finalizer::result_type;
+        using response_type = persistent_response<result_type>;
+
+        persistent_state(
+            std::size_t num_sites, T const& shape, Finalizer finalizer)
+          : finalizer_(HPX_MOVE(finalizer))
+          , num_sites_(num_sites)
+        {
+            for (auto& r : rounds_)
+            {
+                r.data.assign(num_sites, shape);
+                r.result = Finalizer::initial_result(num_sites, shape);
+            }
+        }
+
+        persistent_state(persistent_state const&) = delete;
+        persistent_state(persistent_state&&) = delete;
+        persistent_state& operator=(persistent_state const&) = delete;
+        persistent_state& operator=(persistent_state&&) = delete;
+
+        ~persistent_state() = default;
+
+        hpx::future<response_type> start(std::size_t which, std::size_t round,
+            T&& value, std::size_t target)
+        {
+            if (which >= num_sites_)
+            {
+                return hpx::make_exceptional_future<response_type>(
+                    HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                        "persistent_state::start",
+                        "the site number {} is out of range, expected a value "
+                        "smaller than {}",
+                        which, num_sites_));
+            }
+
+            round_data& r = rounds_[round % 2];
+            response_type response{
+                reinterpret_cast<result_type*>(target), &r.result};
+
+            std::unique_lock l(mtx_);
+            if (r.count == 0)
+            {
+                // this is the first site to start the round
+                r.promise = hpx::promise<void>();
+                r.ready = r.promise.get_shared_future();
+            }
+
+            // copy into the buffer allocated at initialization instead of
+            // replacing it by the storage of the received value
+            r.data[which] = value;
+            if (++r.count != num_sites_)
+            {
+                hpx::shared_future<void> f = r.ready;
+                l.unlock();
+
+                // the buffers of this round are not reused before all sites
+                // have received the result
+                return f.then(hpx::launch::sync,
+                    [response](hpx::shared_future<void>&& f) -> response_type {
+                        f.get();    // propagate exceptions
+                        return response;
+                    });
+            }
+
+            // this is the last site to start the round, no other site will
+            // access the data of this round until the promise is fulfilled
+            r.count = 0;
+            l.unlock();
+
+            try
+            {
+                finalizer_(r.data, r.result);
+            }
+            catch (...)
+            {
+                r.promise.set_exception(std::current_exception());
+                throw;
+            }
+
+            r.promise.set_value();
+            return hpx::make_ready_future(response);
+        }
+
+    private:
+        struct round_data
+        {
+            std::vector<T> data;
+            result_type result;
+            hpx::promise<void> promise;
+            hpx::shared_future<void> ready;
+            std::size_t count = 0;
+        };
+
+        hpx::spinlock mtx_;
+        std::array<round_data, 2> rounds_;
+        Finalizer finalizer_;
+        std::size_t const num_sites_;
+    };
+}    // namespace hpx::collectives::detail
+
+namespace hpx::collectives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Result = T>
+    class persistent_collective
+    {
+        using response_type = detail::persistent_response<Result>;
+        using start_function_type = hpx::future<response_type> (*)(
+            hpx::id_type const&, std::size_t, std::size_t, std::size_t, T&&,
+            Result*);
+
+    public:
+        persistent_collective() = default;
+
+        persistent_collective(hpx::id_type id, std::size_t this_site,
+            std::size_t tag, Result const& shape, start_function_type start)
+          : id_(HPX_MOVE(id))
+          , this_site_(this_site)
+          , tag_(tag)
+          , buffers_(std::make_shared<std::array<Result, 2>>())
+          , start_(start)
+        {
+            buffers_->fill(shape);
+        }
+
+        hpx::future<Result const&> start(T value)
+        {
+            if (start_ == nullptr)
+            {
+                return hpx::make_exceptional_future<Result const&>(
+                    HPX_GET_EXCEPTION(hpx::error::invalid_status,
+                        "hpx::collectives::persistent_collective::start",
+                        "the persistent collective operation was not "
+                        "initialized"));
+            }
+
+            // the buffers of two consecutive rounds are used alternately, in
+            // the same way as on the root site
+            std::size_t const round = rounds_++;
+            Result* target = &(*buffers_)[round % 2];
+
+            // make sure id and buffers are kept alive until the result has
+            // been received
+            return start_(id_, this_site_, tag_, round, HPX_MOVE(value), target)
+                .then(hpx::launch::sync,
+                    [id = id_, buffers = buffers_](
+                        hpx::future<response_type>&& f) -> Result const& {
+                        HPX_UNUSED(id);
+                        HPX_UNUSED(buffers);
+                        return f.get().get();    // propagate exceptions
+                    });
+        }
+
+        hpx::future<Result const&> start()
+        {
+            return start(T());
+        }
+
+        Result const& start(hpx::launch::sync_policy, T value)
+        {
+            return start(HPX_MOVE(value)).get();
+        }
+
+        Result const& start(hpx::launch::sync_policy)
+        {
+            return start(T()).get();
+        }
+
+        [[nodiscard]] constexpr std::size_t rounds() const noexcept
+        {
+            return rounds_;
+        }
+
+        explicit constexpr operator bool() const noexcept
+        {
+            return start_ != nullptr;
+        }
+
+    private:
+        hpx::id_type id_;
+        std::size_t this_site_ = 0;
+        std::size_t tag_ = 0;
+        std::size_t rounds_ = 0;
+        std::shared_ptr<std::array<Result, 2>> buffers_;
+        start_function_type start_ = nullptr;
+    };
+
+    namespace detail {
+
+        template <typename State, typename T>
+        hpx::future<typename State::response_type> persistent_start(
+            hpx::id_type const& id, std::size_t which, std::size_t tag,
+            std::size_t round, T&& value,
+            typename State::result_type* target)
+        {
+            using action_type =
+                communicator_server::persistent_start_direct_action<State, T>;
+
+            // explicitly unwrap returned future
+            return hpx::async(action_type(), id, which, tag, round,
+                HPX_MOVE(value), reinterpret_cast<std::size_t>(target));
+        }
+
+        template <typename T, typename Finalizer>
+        hpx::future<persistent_collective<T, typename Finalizer::result_type>>
+        persistent_init(communicator fid, T shape, Finalizer finalizer,
+            this_site_arg this_site, tag_arg const tag)
+        {
+            using state_type = persistent_state<T, Finalizer>;
+            using result_type = typename Finalizer::result_type;
+            using collective_type = persistent_collective<T, result_type>;
+
+            if (this_site.is_default())
+            {
+                this_site = agas::get_locality_id();
+            }
+
+            auto init_data =
+                [shape = HPX_MOVE(shape), finalizer = HPX_MOVE(finalizer),
+                    this_site, tag](communicator&& c) mutable
+                -> hpx::future<collective_type> {
+                using action_type =
+                    communicator_server::persistent_init_direct_action<
+                        state_type, T, Finalizer>;
+
+                hpx::id_type id = c.get_id();
+
+                // the buffers receiving the results on this site have the
+                // same shape as those on the root site
+                result_type result =
+                    Finalizer::initial_result(c.get_info().first, shape);
+
+                return hpx::async(action_type(), id, tag,
+                    HPX_MOVE(shape), HPX_MOVE(finalizer))
+                    .then(hpx::launch::sync,
+                        [id, this_site, tag, result = HPX_MOVE(result)](
+                            hpx::future<void>&& f) mutable -> collective_type {
+                            f.get();    // propagate exceptions
+                            return collective_type(HPX_MOVE(id), this_site,
+                                tag, result, &persistent_start<state_type, T>);
+                        });
+            };
+
+            return fid.then(hpx::launch::sync, HPX_MOVE(init_data));
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    hpx::future<persistent_collective<std::decay_t<T>>> all_reduce_init(
+        communicator comm, T&& shape, F&& op,
+        this_site_arg const this_site = this_site_arg(),
+        tag_arg const tag = tag_arg())
+    {
+        using arg_type = std::decay_t<T>;
+        using finalizer_type =
+            detail::persistent_all_reduce_op<arg_type, std::decay_t<F>>;
+
+        return detail::persistent_init(HPX_MOVE(comm),
+            arg_type(HPX_FORWARD(T, shape)),
+            finalizer_type{HPX_FORWARD(F, op)}, this_site, tag);
+    }
+
+    template <typename T>
+    hpx::future<persistent_collective<std::decay_t<T>,
+        std::vector<std::decay_t<T>>>>
+    all_gather_init(communicator comm, T&& shape,
+        this_site_arg const this_site = this_site_arg(),
+        tag_arg const tag = tag_arg())
+    {
+        using arg_type = std::decay_t<T>;
+        using finalizer_type = detail::persistent_all_gather_op<arg_type>;
+
+        return detail::persistent_init(HPX_MOVE(comm),
+            arg_type(HPX_FORWARD(T, shape)), finalizer_type{}, this_site, tag);
+    }
+
+    template <typename T>
+    hpx::future<persistent_collective<std::decay_t<T>>> broadcast_init(
+        communicator comm, T&& shape,
+        this_site_arg const this_site = this_site_arg(),
+        root_site_arg const root_site = root_site_arg(),
+        tag_arg const tag = tag_arg())
+    {
+        using arg_type = std::decay_t<T>;
+        using finalizer_type = detail::persistent_broadcast_op<arg_type>;
+
+        return detail::persistent_init(HPX_MOVE(comm),
+            arg_type(HPX_FORWARD(T, shape)), finalizer_type{root_site},
+            this_site, tag);
+    }
+}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
@@ -0,0 +1,557 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file reduce_scatter.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// Reduce a set of vectors element-wise and scatter the result
+    ///
+    /// This function reduces the vectors supplied by all call sites operating
+    /// on the given base name element-wise. The result is split into one
+    /// segment of (almost) equal size per participating site, each site
+    /// receives the segment corresponding to its sequence number.
+    ///
+    /// \param  basename    The base name identifying the reduce_scatter
+    ///                     operation
+    /// \param  result      The vector to transmit from this call site. All sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply to the elements of all
+    ///                     vectors supplied from all participating sites
+    /// \param  num_sites   The number of participating sites (default: all
+    ///                     localities).
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the reduce_scatter operation performed on
+    ///                     the given base name. This is optional and needs to
+    ///                     be supplied only if the reduce_scatter operation on
+    ///                     the given base name has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param root_site    The site that is responsible for creating the
+    ///                     reduce_scatter support object. This value is
+    ///                     optional and defaults to '0' (zero).
+    ///
+    /// \returns    This function returns a future holding the segment of the
+    ///             reduced vector belonging to this site. It will become ready
+    ///             once the reduce_scatter operation has been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> reduce_scatter(char const* basename,
+        std::vector<T> result, F&& op,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg());
+
+    /// Reduce a set of vectors element-wise and scatter the result
+    ///
+    /// This function reduces the vectors supplied by all call sites operating
+    /// on the given communicator element-wise. The result is split into one
+    /// segment of (almost) equal size per participating site, each site
+    /// receives the segment corresponding to its sequence number.
+    ///
+    /// \param  comm        A communicator object returned from \a create_communicator
+    /// \param  result      The vector to transmit from this call site. All sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply to the elements of all
+    ///                     vectors supplied from all participating sites
+    /// \param  this_site   The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the reduce_scatter operation performed on
+    ///                     the given base name. This is optional and needs to
+    ///                     be supplied only if the reduce_scatter operation on
+    ///                     the given base name has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    ///
+    /// \returns    This function returns a future holding the segment of the
+    ///             reduced vector belonging to this site. It will become ready
+    ///             once the reduce_scatter operation has been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> reduce_scatter(communicator comm,
+        std::vector<T> result, F&& op,
+        this_site_arg this_site = this_site_arg(),
+        generation_arg generation = generation_arg());
+
+    /// Reduce a set of vectors element-wise and scatter the result
+    ///
+    /// This function reduces the vectors supplied by all call sites operating
+    /// on the given communicator element-wise. The result is split into one
+    /// segment of (almost) equal size per participating site, each site
+    /// receives the segment corresponding to its sequence number.
+    ///
+    /// \param  comm        A communicator object returned from \a create_communicator
+    /// \param  result      The vector to transmit from this call site. All sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply to the elements of all
+    ///                     vectors supplied from all participating sites
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the reduce_scatter operation performed on
+    ///                     the given base name. This is optional and needs to
+    ///                     be supplied only if the reduce_scatter operation on
+    ///                     the given base name has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  this_site   The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    ///
+    /// \returns    This function returns a future holding the segment of the
+    ///             reduced vector belonging to this site. It will become ready
+    ///             once the reduce_scatter operation has been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> reduce_scatter(communicator comm,
+        std::vector<T> result, F&& op, generation_arg generation,
+        this_site_arg this_site = this_site_arg());
+
+    /// Reduce a set of vectors element-wise and scatter the result using
+    /// point-to-point communication
+    ///
+    /// This function reduces the vectors supplied by all sites participating
+    /// in the given channel communicator element-wise without funneling the
+    /// data through a single site. The reduction is performed using recursive
+    /// vector halving (for a power of two number of sites) or along a ring.
+    /// The result is split into one segment of (almost) equal size per
+    /// participating site, each site receives the segment corresponding to its
+    /// sequence number.
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  result      The vector to transmit from this call site. All sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply to the elements of all
+    ///                     vectors supplied from all participating sites. It
+    ///                     has to be associative and commutative.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the reduce_scatter operation performed on
+    ///                     the given communicator. This is optional and needs
+    ///                     to be supplied only if the reduce_scatter operation
+    ///                     on the given communicator has to be performed more
+    ///                     than once. The generation number (if given) must be
+    ///                     a positive number greater than zero.
+    ///
+    /// \returns    This function returns a future holding the segment of the
+    ///             reduced vector belonging to this site. It will become ready
+    ///             once the reduce_scatter operation has been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> reduce_scatter(channel_communicator comm,
+        std::vector<T> result, F&& op,
+        generation_arg generation = generation_arg());
+
+    /// Reduce a set of vectors element-wise and scatter the result
+    ///
+    /// This function reduces the vectors supplied by all call sites operating
+    /// on the given base name element-wise. The result is split into one
+    /// segment of (almost) equal size per participating site, each site
+    /// receives the segment corresponding to its sequence number.
+    ///
+    /// \param  policy      The execution policy specifying synchronous execution.
+    /// \param  basename    The base name identifying the reduce_scatter
+    ///                     operation
+    /// \param  result      The vector to transmit from this call site. All sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply to the elements of all
+    ///                     vectors supplied from all participating sites
+    /// \param  num_sites   The number of participating sites (default: all
+    ///                     localities).
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the reduce_scatter operation performed on
+    ///                     the given base name. This is optional and needs to
+    ///                     be supplied only if the reduce_scatter operation on
+    ///                     the given base name has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param root_site    The site that is responsible for creating the
+    ///                     reduce_scatter support object. This value is
+    ///                     optional and defaults to '0' (zero).
+    ///
+    /// \returns    This function returns the segment of the reduced vector
+    ///             belonging to this site. This function executes
+    ///             synchronously and directly returns the result.
+    ///
+    template <typename T, typename F>
+    std::vector<T> reduce_scatter(hpx::launch::sync_policy,
+        char const* basename, std::vector<T> result, F&& op,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg());
+
+    /// Reduce a set of vectors element-wise and scatter the result
+    ///
+    /// This function reduces the vectors supplied by all call sites operating
+    /// on the given communicator element-wise. The result is split into one
+    /// segment of (almost) equal size per participating site, each site
+    /// receives the segment corresponding to its sequence number.
+    ///
+    /// \param  policy      The execution policy specifying synchronous execution.
+    /// \param  comm        A communicator object returned from \a create_communicator
+    /// \param  result      The vector to transmit from this call site. All sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply to the elements of all
+    ///                     vectors supplied from all participating sites
+    /// \param  this_site   The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the reduce_scatter operation performed on
+    ///                     the given base name. This is optional and needs to
+    ///                     be supplied only if the reduce_scatter operation on
+    ///                     the given base name has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    ///
+    /// \returns    This function returns the segment of the reduced vector
+    ///             belonging to this site. This function executes
+    ///             synchronously and directly returns the result.
+    ///
+    template <typename T, typename F>
+    std::vector<T> reduce_scatter(hpx::launch::sync_policy,
+        communicator comm, std::vector<T> result, F&& op,
+        this_site_arg this_site = this_site_arg(),
+        generation_arg generation = generation_arg());
+
+    /// Reduce a set of vectors element-wise and scatter the result
+    ///
+    /// This function reduces the vectors supplied by all call sites operating
+    /// on the given communicator element-wise. The result is split into one
+    /// segment of (almost) equal size per participating site, each site
+    /// receives the segment corresponding to its sequence number.
+    ///
+    /// \param  policy      The execution policy specifying synchronous execution.
+    /// \param  comm        A communicator object returned from \a create_communicator
+    /// \param  result      The vector to transmit from this call site. All sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply to the elements of all
+    ///                     vectors supplied from all participating sites
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the reduce_scatter operation performed on
+    ///                     the given base name. This is optional and needs to
+    ///                     be supplied only if the reduce_scatter operation on
+    ///                     the given base name has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  this_site   The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    ///
+    /// \returns    This function returns the segment of the reduced vector
+    ///             belonging to this site. This function executes
+    ///             synchronously and directly returns the result.
+    ///
+    template <typename T, typename F>
+    std::vector<T> reduce_scatter(hpx::launch::sync_policy,
+        communicator comm, std::vector<T> result, F&& op,
+        generation_arg generation, this_site_arg this_site = this_site_arg());
+
+    /// Reduce a set of vectors element-wise and scatter the result using
+    /// point-to-point communication
+    ///
+    /// This function reduces the vectors supplied by all sites participating
+    /// in the given channel communicator element-wise without funneling the
+    /// data through a single site.
+    ///
+    /// \param  policy      The execution policy specifying synchronous execution.
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  result      The vector to transmit from this call site. All sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply to the elements of all
+    ///                     vectors supplied from all participating sites. It
+    ///                     has to be associative and commutative.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the reduce_scatter operation performed on
+    ///                     the given communicator. This is optional and needs
+    ///                     to be supplied only if the reduce_scatter operation
+    ///                     on the given communicator has to be performed more
+    ///                     than once. The generation number (if given) must be
+    ///                     a positive number greater than zero.
+    ///
+    /// \returns    This function returns the segment of the reduced vector
+    ///             belonging to this site. This function executes
+    ///             synchronously and directly returns the result.
+    ///
+    template <typename T, typename F>
+    std::vector<T> reduce_scatter(hpx::launch::sync_policy,
+        channel_communicator comm, std::vector<T> result, F&& op,
+        generation_arg generation = generation_arg());
+}}    // namespace hpx::collectives
+
+// clang-format on
+#else
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/reduce_algorithms.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/type_support.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::traits {
+
+    namespace communication {
+
+        struct reduce_scatter_tag;
+
+        template <>
+        struct communicator_data<reduce_scatter_tag>
+        {
+            HPX_EXPORT static char const* name() noexcept;
+        };
+    }    // namespace communication
+
+    ///////////////////////////////////////////////////////////////////////////
+    // support for reduce_scatter
+    template <typename Communicator>
+    struct communication_operation<Communicator,
+        communication::reduce_scatter_tag>
+    {
+        template <typename Result, typename T, typename F>
+        static Result get(Communicator& communicator, std::size_t which,
+            std::size_t generation, std::vector<T>&& t, F&& op)
+        {
+            return communicator.template handle_data<std::vector<T>>(
+                communication::communicator_data<
+                    communication::reduce_scatter_tag>::name(),
+                which, generation,
+                // step function (invoked for each get)
+                [&t](auto& data, std::size_t which) {
+                    data[which] = HPX_MOVE(t);
+                },
+                // finalizer (invoked non-concurrently after all data has been
+                // received)
+                [op = HPX_FORWARD(F, op)](auto& data, bool& data_available,
+                    std::size_t which) mutable {
+                    HPX_ASSERT(!data.empty());
+
+                    std::vector<T>& result = data[0];
+                    if (!data_available)
+                    {
+                        // compute reduction result only once
+                        for (std::size_t i = 1; i != data.size(); ++i)
+                        {
+                            HPX_ASSERT(data[i].size() == result.size());
+
+                            auto it = result.begin();
+                            for (auto const& value : data[i])
+                            {
+                                *it = op(*it, value);
+                                ++it;
+                            }
+                        }
+                        data_available = true;
+                    }
+
+                    std::size_t const size = result.size();
+                    std::size_t const num_sites = data.size();
+                    return std::vector<T>(result.begin() +
+                            collectives::detail::segment_begin(
+                                size, num_sites, which),
+                        result.begin() +
+                            collectives::detail::segment_begin(
+                                size, num_sites, which + 1));
+                });
+        }
+    };
+}    // namespace hpx::traits
+
+namespace hpx::collectives {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // reduce_scatter vectors
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> reduce_scatter(communicator fid,
+        std::vector<T> local_result, F&& op,
+        this_site_arg this_site = this_site_arg(),
+        generation_arg const generation = generation_arg())
+    {
+        using arg_type = std::vector<T>;
+
+        if (this_site.is_default())
+        {
+            this_site = agas::get_locality_id();
+        }
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::reduce_scatter",
+                "the generation number shouldn't be zero"));
+        }
+
+        // Handle operation right away if there is only one value.
+        if (auto [num_sites, comm_site] = fid.get_info(); num_sites == 1)
+        {
+            if (this_site != comm_site)
+            {
+                return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                    hpx::error::bad_parameter,
+                    "hpx::collectives::reduce_scatter",
+                    "the local site should be zero if only one site is "
+                    "involved"));
+            }
+
+            return hpx::make_ready_future(HPX_MOVE(local_result));
+        }
+
+        auto reduce_scatter_data =
+            [local_result = HPX_MOVE(local_result), op = HPX_FORWARD(F, op),
+                generation,
+                this_site](communicator&& c) mutable -> hpx::future<arg_type> {
+            using func_type = std::decay_t<F>;
+            using action_type =
+                detail::communicator_server::communication_get_direct_action<
+                    traits::communication::reduce_scatter_tag,
+                    hpx::future<arg_type>, arg_type, func_type>;
+
+            // explicitly unwrap returned future
+            hpx::future<arg_type> result = hpx::async(action_type(), c,
+                this_site, generation, HPX_MOVE(local_result), HPX_MOVE(op));
+
+            if (!result.is_ready())
+            {
+                // make sure id is kept alive as long as the returned future
+                traits::detail::get_shared_state(result)->set_on_completed(
+                    [client = HPX_MOVE(c)] { HPX_UNUSED(client); });
+            }
+
+            return result;
+        };
+
+        return fid.then(hpx::launch::sync, HPX_MOVE(reduce_scatter_data));
+    }
+
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> reduce_scatter(communicator fid,
+        std::vector<T> local_result, F&& op, generation_arg const generation,
+        this_site_arg const this_site = this_site_arg())
+    {
+        return reduce_scatter(HPX_MOVE(fid), HPX_MOVE(local_result),
+            HPX_FORWARD(F, op), this_site, generation);
+    }
+
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> reduce_scatter(char const* basename,
+        std::vector<T> local_result, F&& op,
+        num_sites_arg const num_sites = num_sites_arg(),
+        this_site_arg const this_site = this_site_arg(),
+        generation_arg const generation = generation_arg(),
+        root_site_arg const root_site = root_site_arg())
+    {
+        return reduce_scatter(create_communicator(basename, num_sites,
+                                  this_site, generation, root_site),
+            HPX_MOVE(local_result), HPX_FORWARD(F, op), this_site);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // reduce_scatter vectors using point-to-point communication
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> reduce_scatter(channel_communicator comm,
+        std::vector<T> local_result, F&& op,
+        generation_arg generation = generation_arg())
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<T>>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::reduce_scatter",
+                    "the generation number shouldn't be zero"));
+        }
+        if (generation.is_default())
+        {
+            generation = 1;
+        }
+
+        // Handle operation right away if there is only one value.
+        if (comm.get_info().first == 1)
+        {
+            return hpx::make_ready_future(HPX_MOVE(local_result));
+        }
+
+        return hpx::async(
+            [comm = HPX_MOVE(comm), local_result = HPX_MOVE(local_result),
+                op = HPX_FORWARD(F, op), generation]() mutable {
+                return detail::segmented_reduce_scatter(
+                    comm, local_result, op, generation);
+            });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    std::vector<T> reduce_scatter(hpx::launch::sync_policy, communicator fid,
+        std::vector<T> local_result, F&& op,
+        this_site_arg const this_site = this_site_arg(),
+        generation_arg const generation = generation_arg())
+    {
+        return reduce_scatter(HPX_MOVE(fid), HPX_MOVE(local_result),
+            HPX_FORWARD(F, op), this_site, generation)
+            .get();
+    }
+
+    template <typename T, typename F>
+    std::vector<T> reduce_scatter(hpx::launch::sync_policy, communicator fid,
+        std::vector<T> local_result, F&& op, generation_arg const generation,
+        this_site_arg const this_site = this_site_arg())
+    {
+        return reduce_scatter(HPX_MOVE(fid), HPX_MOVE(local_result),
+            HPX_FORWARD(F, op), this_site, generation)
+            .get();
+    }
+
+    template <typename T, typename F>
+    std::vector<T> reduce_scatter(hpx::launch::sync_policy,
+        char const* basename, std::vector<T> local_result, F&& op,
+        num_sites_arg const num_sites = num_sites_arg(),
+        this_site_arg const this_site = this_site_arg(),
+        generation_arg const generation = generation_arg(),
+        root_site_arg const root_site = root_site_arg())
+    {
+        return reduce_scatter(create_communicator(basename, num_sites,
+                                  this_site, generation, root_site),
+            HPX_MOVE(local_result), HPX_FORWARD(F, op), this_site)
+            .get();
+    }
+
+    template <typename T, typename F>
+    std::vector<T> reduce_scatter(hpx::launch::sync_policy,
+        channel_communicator comm, std::vector<T> local_result, F&& op,
+        generation_arg const generation = generation_arg())
+    {
+        return reduce_scatter(HPX_MOVE(comm), HPX_MOVE(local_result),
+            HPX_FORWARD(F, op), generation)
+            .get();
+    }
+}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
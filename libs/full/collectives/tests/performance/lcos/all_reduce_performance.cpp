@@ -0,0 +1,136 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the all_reduce operation funneling all data through
+// the root site (communicator) with the segmented algorithms using
+// point-to-point communication (channel_communicator) and with the
+// reduce_scatter operation for vectors of increasing size. It is meant to be
+// run using several localities, for instance on a single host:
+//
+//      hpxrun.py -l 4 ./bin/all_reduce_performance_test
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    auto const iterations = vm["iterations"].as<std::size_t>();
+    auto const min_size = vm["min-size"].as<std::size_t>();
+    auto const max_size = vm["max-size"].as<std::size_t>();
+
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    auto const comm = create_communicator("/perf/all_reduce/",
+        num_sites_arg(num_localities), this_site_arg(here));
+    auto const channel_comm = create_channel_communicator(hpx::launch::sync,
+        "/perf/all_reduce_channel/", num_sites_arg(num_localities),
+        this_site_arg(here));
+
+    if (here == 0)
+    {
+        std::cout << "localities: " << num_localities << "\n"
+                  << "size [bytes], all_reduce (root) [s], "
+                     "all_reduce (segmented) [s], reduce_scatter [s]\n";
+    }
+
+    // the root site reduces the vectors as a whole
+    auto const vector_plus = [](std::vector<double> lhs,
+                                 std::vector<double> const& rhs) {
+        for (std::size_t i = 0; i != lhs.size(); ++i)
+        {
+            lhs[i] += rhs[i];
+        }
+        return lhs;
+    };
+
+    std::size_t generation = 0;
+    for (std::size_t size = min_size; size <= max_size; size *= 4)
+    {
+        std::vector<double> const data(size / sizeof(double), 1.0);
+
+        // all_reduce through the root site
+        hpx::chrono::high_resolution_timer t;
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            all_reduce(hpx::launch::sync, comm, data, vector_plus,
+                generation_arg(++generation));
+        }
+        double const root_time = t.elapsed() / static_cast<double>(iterations);
+
+        // segmented all_reduce using point-to-point communication
+        t.restart();
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            all_reduce(hpx::launch::sync, channel_comm, data, std::plus<>{},
+                generation_arg(++generation));
+        }
+        double const segmented_time =
+            t.elapsed() / static_cast<double>(iterations);
+
+        // reduce_scatter using point-to-point communication
+        t.restart();
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            reduce_scatter(hpx::launch::sync, channel_comm, data,
+                std::plus<>{}, generation_arg(++generation));
+        }
+        double const reduce_scatter_time =
+            t.elapsed() / static_cast<double>(iterations);
+
+        if (here == 0)
+        {
+            std::cout << size << ", " << root_time << ", " << segmented_time
+                      << ", " << reduce_scatter_time << "\n";
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("iterations",
+         hpx::program_options::value<std::size_t>()->default_value(20),
+         "number of iterations per vector size (default: 20)")
+        ("min-size",
+         hpx::program_options::value<std::size_t>()->default_value(1024),
+         "smallest vector size in bytes (default: 1024)")
+        ("max-size",
+         hpx::program_options::value<std::size_t>()->default_value(16777216),
+         "largest vector size in bytes (default: 16777216)");
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
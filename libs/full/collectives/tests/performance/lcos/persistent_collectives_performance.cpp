@@ -0,0 +1,145 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the latency of one round of the all_reduce,
+// all_gather, and broadcast operations executed on a communicator with
+// generation handling and using the corresponding persistent operations. It
+// is meant to be run using several localities, for instance on a single host:
+//
+//      hpxrun.py -l 2 ./bin/persistent_collectives_performance_test
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+// return the average time of one round in microseconds
+template <typename F>
+double measure(std::size_t iterations, F&& f)
+{
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        f(i);
+    }
+    return t.elapsed_microseconds() / static_cast<double>(iterations);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    auto const iterations = vm["iterations"].as<std::size_t>();
+
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    auto const comm = create_communicator("/perf/persistent/",
+        num_sites_arg(num_localities), this_site_arg(here));
+
+    auto sum = all_reduce_init(
+        comm, 0.0, std::plus<>{}, this_site_arg(here), tag_arg(0))
+                   .get();
+    auto gather =
+        all_gather_init(comm, 0.0, this_site_arg(here), tag_arg(1)).get();
+    auto bcast = broadcast_init(
+        comm, 0.0, this_site_arg(here), root_site_arg(0), tag_arg(2))
+                     .get();
+
+    // warm up
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        all_reduce(hpx::launch::sync, comm, 1.0, std::plus<>{},
+            generation_arg(i + 1));
+        sum.start(hpx::launch::sync, 1.0);
+    }
+
+    std::size_t generation = 10;
+
+    double const all_reduce_time = measure(iterations, [&](std::size_t) {
+        all_reduce(hpx::launch::sync, comm, 1.0, std::plus<>{},
+            generation_arg(++generation));
+    });
+    double const persistent_all_reduce_time = measure(
+        iterations, [&](std::size_t) { sum.start(hpx::launch::sync, 1.0); });
+
+    double const all_gather_time = measure(iterations, [&](std::size_t) {
+        all_gather(hpx::launch::sync, comm, 1.0, generation_arg(++generation));
+    });
+    double const persistent_all_gather_time = measure(iterations,
+        [&](std::size_t) { gather.start(hpx::launch::sync, 1.0); });
+
+    double const broadcast_time = measure(iterations, [&](std::size_t) {
+        if (here == 0)
+        {
+            broadcast_to(hpx::launch::sync, comm, 1.0,
+                generation_arg(++generation));
+        }
+        else
+        {
+            broadcast_from<double>(
+                hpx::launch::sync, comm, generation_arg(++generation));
+        }
+    });
+    double const persistent_broadcast_time =
+        measure(iterations, [&](std::size_t) {
+            if (here == 0)
+            {
+                bcast.start(hpx::launch::sync, 1.0);
+            }
+            else
+            {
+                bcast.start(hpx::launch::sync);
+            }
+        });
+
+    if (here == 0)
+    {
+        std::cout << "localities: " << num_localities << "\n"
+                  << "operation, communicator [us], persistent [us]\n"
+                  << "all_reduce, " << all_reduce_time << ", "
+                  << persistent_all_reduce_time << "\n"
+                  << "all_gather, " << all_gather_time << ", "
+                  << persistent_all_gather_time << "\n"
+                  << "broadcast, " << broadcast_time << ", "
+                  << persistent_broadcast_time << "\n";
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("iterations",
+         hpx::program_options::value<std::size_t>()->default_value(1000),
+         "number of rounds per operation (default: 1000)");
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
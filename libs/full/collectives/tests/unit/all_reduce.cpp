@@ -12,6 +12,7 @@
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <string>
@@ -21,6 +22,7 @@
 using namespace hpx::collectives;
 
 constexpr char const* all_reduce_direct_basename = "/test/all_reduce_direct/";
+constexpr char const* all_reduce_channel_basename = "/test/all_reduce_channel/";
 #if defined(HPX_DEBUG)
 constexpr int ITERATIONS = 100;
 #else
@@ -156,6 +158,51 @@ void test_local_use(std::uint32_t num_sites)
     hpx::wait_all(std::move(sites));
 }
 
+void test_local_channel_use(std::uint32_t num_sites, std::size_t size)
+{
+    std::string const basename = all_reduce_channel_basename +
+        std::to_string(num_sites) + "/" + std::to_string(size);
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+
+    // launch num_sites threads to represent different sites
+    for (std::uint32_t site = 0; site != num_sites; ++site)
+    {
+        sites.push_back(hpx::async([=]() {
+            auto const comm = create_channel_communicator(hpx::launch::sync,
+                basename.c_str(), num_sites_arg(num_sites),
+                this_site_arg(site));
+
+            for (std::uint32_t i = 0; i != 10; ++i)
+            {
+                std::vector<double> value(size);
+                for (std::size_t k = 0; k != size; ++k)
+                {
+                    value[k] = static_cast<double>(site + i + k);
+                }
+
+                std::vector<double> result = all_reduce(hpx::launch::sync,
+                    comm, std::move(value), std::plus<>{},
+                    generation_arg(i + 1));
+
+                HPX_TEST_EQ(result.size(), size);
+                for (std::size_t k = 0; k != size; ++k)
+                {
+                    double expected = 0;
+                    for (std::uint32_t j = 0; j != num_sites; ++j)
+                    {
+                        expected += static_cast<double>(j + i + k);
+                    }
+                    HPX_TEST_EQ(expected, result[k]);
+                }
+            }
+        }));
+    }
+
+    hpx::wait_all(std::move(sites));
+}
+
 int hpx_main()
 {
 #if defined(HPX_HAVE_NETWORKING)
@@ -171,6 +218,14 @@ int hpx_main()
     {
         test_local_use(1);
         test_local_use(10);
+
+        // recursive doubling, recursive halving, and ring algorithms
+        for (std::uint32_t num_sites : {1, 2, 4, 5, 6})
+        {
+            test_local_channel_use(num_sites, 3);
+            test_local_channel_use(num_sites, 100);
+            test_local_channel_use(num_sites, 20000);
+        }
     }
 
     return hpx::finalize();
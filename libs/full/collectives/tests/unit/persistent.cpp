@@ -0,0 +1,215 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+constexpr char const* persistent_basename = "/test/persistent/";
+#if defined(HPX_DEBUG)
+constexpr int ITERATIONS = 10;
+#else
+constexpr int ITERATIONS = 100;
+#endif
+
+void test_multiple_use()
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    HPX_TEST_LTE(static_cast<std::uint32_t>(2), num_localities);
+
+    auto const comm = create_communicator(persistent_basename,
+        num_sites_arg(num_localities), this_site_arg(here));
+
+    // several persistent operations on the same communicator
+    auto sum = all_reduce_init(comm, std::uint32_t(0), std::plus<>{},
+        this_site_arg(here), tag_arg(0))
+                   .get();
+    auto gather =
+        all_gather_init(comm, std::uint32_t(0), this_site_arg(here), tag_arg(1))
+            .get();
+    auto bcast = broadcast_init(comm, std::uint32_t(0), this_site_arg(here),
+        root_site_arg(0), tag_arg(2))
+                     .get();
+
+    // the results of every other round are received into the same buffer
+    std::array<std::uint32_t const*, 2> gathered_data = {};
+
+    for (std::uint32_t i = 0; i != ITERATIONS; ++i)
+    {
+        std::uint32_t const result = sum.start(hpx::launch::sync, here + i);
+
+        std::uint32_t expected = 0;
+        for (std::uint32_t j = 0; j != num_localities; ++j)
+        {
+            expected += j + i;
+        }
+        HPX_TEST_EQ(expected, result);
+
+        std::vector<std::uint32_t> const& gathered =
+            gather.start(hpx::launch::sync, here + i);
+
+        HPX_TEST_EQ(gathered.size(), static_cast<std::size_t>(num_localities));
+        for (std::uint32_t j = 0; j != num_localities; ++j)
+        {
+            HPX_TEST_EQ(j + i, gathered[j]);
+        }
+
+        if (i >= 2)
+        {
+            HPX_TEST_EQ(gathered_data[i % 2], gathered.data());
+        }
+        gathered_data[i % 2] = gathered.data();
+
+        std::uint32_t const value = here == 0 ?
+            bcast.start(hpx::launch::sync, 42 + i) :
+            bcast.start(hpx::launch::sync);
+        HPX_TEST_EQ(42 + i, value);
+    }
+
+    HPX_TEST_EQ(sum.rounds(), static_cast<std::size_t>(ITERATIONS));
+}
+
+struct vector_plus
+{
+    std::vector<std::uint64_t> operator()(std::vector<std::uint64_t> lhs,
+        std::vector<std::uint64_t> const& rhs) const
+    {
+        for (std::size_t k = 0; k != lhs.size(); ++k)
+        {
+            lhs[k] += rhs[k];
+        }
+        return lhs;
+    }
+};
+
+void test_local_use(std::uint32_t num_sites, std::size_t size)
+{
+    std::string const basename = persistent_basename +
+        std::to_string(num_sites) + "/" + std::to_string(size);
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+
+    // launch num_sites threads to represent different sites
+    for (std::uint32_t site = 0; site != num_sites; ++site)
+    {
+        sites.push_back(hpx::async([=]() {
+            auto const comm = create_local_communicator(basename.c_str(),
+                num_sites_arg(num_sites), this_site_arg(site));
+
+            auto sum = all_reduce_init(comm,
+                std::vector<std::uint64_t>(size), vector_plus{},
+                this_site_arg(site), tag_arg(0))
+                           .get();
+
+            std::array<std::uint64_t const*, 2> result_data = {};
+
+            for (std::uint32_t i = 0; i != ITERATIONS; ++i)
+            {
+                std::vector<std::uint64_t> data(size);
+                for (std::size_t k = 0; k != size; ++k)
+                {
+                    data[k] = site + i + k;
+                }
+
+                // start the round asynchronously
+                hpx::future<std::vector<std::uint64_t> const&> f =
+                    sum.start(std::move(data));
+
+                std::vector<std::uint64_t> const& result = f.get();
+                HPX_TEST_EQ(result.size(), size);
+
+                // the buffers allocated at initialization are reused
+                if (i >= 2)
+                {
+                    HPX_TEST_EQ(result_data[i % 2], result.data());
+                }
+                result_data[i % 2] = result.data();
+
+                for (std::size_t k = 0; k != result.size(); ++k)
+                {
+                    std::uint64_t expected = 0;
+                    for (std::uint32_t j = 0; j != num_sites; ++j)
+                    {
+                        expected += j + i + k;
+                    }
+                    HPX_TEST_EQ(expected, result[k]);
+                }
+            }
+        }));
+    }
+
+    hpx::wait_all(std::move(sites));
+}
+
+void test_uninitialized()
+{
+    persistent_collective<int> op;
+    HPX_TEST(!op);
+
+    bool caught_exception = false;
+    try
+    {
+        op.start(hpx::launch::sync, 42);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_NETWORKING)
+    if (hpx::get_num_localities(hpx::launch::sync) > 1)
+    {
+        test_multiple_use();
+    }
+#endif
+
+    if (hpx::get_locality_id() == 0)
+    {
+        for (std::uint32_t num_sites : {1, 2, 3, 8})
+        {
+            test_local_use(num_sites, 1);
+            test_local_use(num_sites, 1000);
+        }
+
+        test_uninitialized();
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+
+#endif
@@ -0,0 +1,208 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+constexpr char const* reduce_scatter_basename = "/test/reduce_scatter/";
+constexpr char const* reduce_scatter_channel_basename =
+    "/test/reduce_scatter_channel/";
+#if defined(HPX_DEBUG)
+constexpr int ITERATIONS = 10;
+#else
+constexpr int ITERATIONS = 100;
+#endif
+
+// The reduced vector is split into one segment of (almost) equal size per
+// site, the first size % num_sites segments hold one more element.
+void check_segment(std::vector<std::uint64_t> const& segment,
+    std::uint32_t num_sites, std::uint32_t site, std::size_t size,
+    std::uint64_t iteration)
+{
+    std::size_t const rem = size % num_sites;
+    std::size_t const first =
+        site * (size / num_sites) + (std::min) (std::size_t(site), rem);
+    std::size_t const count = size / num_sites + (site < rem ? 1 : 0);
+
+    HPX_TEST_EQ(segment.size(), count);
+    for (std::size_t k = 0; k != segment.size(); ++k)
+    {
+        std::uint64_t expected = 0;
+        for (std::uint32_t j = 0; j != num_sites; ++j)
+        {
+            expected += j + iteration + first + k;
+        }
+        HPX_TEST_EQ(expected, segment[k]);
+    }
+}
+
+std::vector<std::uint64_t> make_data(
+    std::uint32_t site, std::size_t size, std::uint64_t iteration)
+{
+    std::vector<std::uint64_t> data(size);
+    for (std::size_t k = 0; k != size; ++k)
+    {
+        data[k] = site + iteration + k;
+    }
+    return data;
+}
+
+void test_multiple_use()
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    HPX_TEST_LTE(static_cast<std::uint32_t>(2), num_localities);
+
+    auto const reduce_scatter_client =
+        create_communicator(reduce_scatter_basename,
+            num_sites_arg(num_localities), this_site_arg(here));
+
+    for (int i = 0; i != ITERATIONS; ++i)
+    {
+        hpx::future<std::vector<std::uint64_t>> result =
+            reduce_scatter(reduce_scatter_client, make_data(here, 1000, i),
+                std::plus<>{}, generation_arg(i + 1));
+
+        check_segment(result.get(), num_localities, here, 1000, i);
+    }
+}
+
+void test_multiple_use_channel()
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    HPX_TEST_LTE(static_cast<std::uint32_t>(2), num_localities);
+
+    auto const comm = create_channel_communicator(hpx::launch::sync,
+        reduce_scatter_channel_basename, num_sites_arg(num_localities),
+        this_site_arg(here));
+
+    for (int i = 0; i != ITERATIONS; ++i)
+    {
+        hpx::future<std::vector<std::uint64_t>> result = reduce_scatter(comm,
+            make_data(here, 1000, i), std::plus<>{}, generation_arg(i + 1));
+
+        check_segment(result.get(), num_localities, here, 1000, i);
+    }
+}
+
+void test_local_use(std::uint32_t num_sites, std::size_t size)
+{
+    std::string const basename = reduce_scatter_basename +
+        std::to_string(num_sites) + "/" + std::to_string(size);
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+
+    // launch num_sites threads to represent different sites
+    for (std::uint32_t site = 0; site != num_sites; ++site)
+    {
+        sites.push_back(hpx::async([=]() {
+            auto const reduce_scatter_client =
+                create_local_communicator(basename.c_str(),
+                    num_sites_arg(num_sites), this_site_arg(site));
+
+            for (std::uint32_t i = 0; i != ITERATIONS; ++i)
+            {
+                std::vector<std::uint64_t> result =
+                    reduce_scatter(hpx::launch::sync, reduce_scatter_client,
+                        make_data(site, size, i), std::plus<>{},
+                        this_site_arg(site), generation_arg(i + 1));
+
+                check_segment(result, num_sites, site, size, i);
+            }
+        }));
+    }
+
+    hpx::wait_all(std::move(sites));
+}
+
+void test_local_channel_use(std::uint32_t num_sites, std::size_t size)
+{
+    std::string const basename = reduce_scatter_channel_basename +
+        std::to_string(num_sites) + "/" + std::to_string(size);
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+
+    // launch num_sites threads to represent different sites
+    for (std::uint32_t site = 0; site != num_sites; ++site)
+    {
+        sites.push_back(hpx::async([=]() {
+            auto const comm = create_channel_communicator(hpx::launch::sync,
+                basename.c_str(), num_sites_arg(num_sites),
+                this_site_arg(site));
+
+            for (std::uint32_t i = 0; i != ITERATIONS; ++i)
+            {
+                std::vector<std::uint64_t> result =
+                    reduce_scatter(hpx::launch::sync, comm,
+                        make_data(site, size, i), std::plus<>{},
+                        generation_arg(i + 1));
+
+                check_segment(result, num_sites, site, size, i);
+            }
+        }));
+    }
+
+    hpx::wait_all(std::move(sites));
+}
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_NETWORKING)
+    if (hpx::get_num_localities(hpx::launch::sync) > 1)
+    {
+        test_multiple_use();
+        test_multiple_use_channel();
+    }
+#endif
+
+    if (hpx::get_locality_id() == 0)
+    {
+        // recursive halving (power of two) and ring algorithms
+        for (std::uint32_t num_sites : {1, 2, 3, 4, 7, 8})
+        {
+            test_local_use(num_sites, 2);
+            test_local_use(num_sites, 1001);
+
+            test_local_channel_use(num_sites, 2);
+            test_local_channel_use(num_sites, 1001);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+
+#endif
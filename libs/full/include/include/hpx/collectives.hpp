@@ -17,5 +17,7 @@
 #include <hpx/collectives/exclusive_scan.hpp>
 #include <hpx/collectives/gather.hpp>
 #include <hpx/collectives/inclusive_scan.hpp>
+#include <hpx/collectives/persistent.hpp>
 #include <hpx/collectives/reduce.hpp>
+#include <hpx/collectives/reduce_scatter.hpp>
 #include <hpx/collectives/scatter.hpp>
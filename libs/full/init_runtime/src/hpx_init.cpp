@@ -428,6 +428,8 @@ namespace hpx {
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
 #endif
+            hpx::local::detail::configure_stack_pool(cmdline.rtcfg_);
+            hpx::local::detail::configure_timer_wheel(cmdline.rtcfg_);
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
             {
@@ -0,0 +1,164 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_io_uring/locality.hpp>
+#include <hpx/parcelport_io_uring/ring.hpp>
+#include <hpx/parcelport_io_uring/sender.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <asio/ip/host_name.hpp>
+#include <asio/ip/tcp.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::io_uring {
+
+        class receiver;
+        class HPX_EXPORT connection_handler;
+    }    // namespace policies::io_uring
+
+    template <>
+    struct connection_handler_traits<policies::io_uring::connection_handler>
+    {
+        using connection_type = policies::io_uring::sender;
+        using send_early_parcel = std::true_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "io_uring";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-io_uring";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-io_uring";
+        }
+    };
+
+    namespace policies::io_uring {
+
+        parcelset::locality parcelport_address(
+            util::runtime_configuration const& ini);
+
+        // This parcelport uses the same wire protocol as the TCP parcelport,
+        // however all data is sent and received using an io_uring instance.
+        // Connections are established using asio. The ring is driven from
+        // the background work of the scheduler instead of the threads of the
+        // io_service_pool, which allows to submit the operations of several
+        // connections using a single system call.
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            using base_type = parcelport_impl<connection_handler>;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier);
+
+            ~connection_handler();
+
+            // Start the handling of connections.
+            bool do_run();
+
+            // Stop the handling of connections.
+            void do_stop();
+
+            // Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return asio::ip::host_name();
+            }
+
+            std::shared_ptr<sender> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const override;
+
+            parcelset::locality create_locality() const override;
+
+            // Submit pending operations and handle completed ones.
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode);
+
+        private:
+            friend class receiver;
+
+            // Accepts incoming connections using a multishot accept
+            // operation.
+            struct accept_operation : operation
+            {
+                explicit accept_operation(connection_handler& ch) noexcept
+                  : this_(ch)
+                {
+                }
+
+                operation* complete(int res, std::uint32_t flags) override;
+
+                connection_handler& this_;
+            };
+
+            void handle_read_completion(std::error_code const& e,
+                std::shared_ptr<receiver> const& receiver_conn);
+
+            void io_service_work();
+
+            /// Acceptor used to listen for incoming connections.
+            asio::ip::tcp::acceptor* acceptor_;
+
+            /// The ring used for all network operations, this is created only
+            /// if the parcelport is enabled
+            std::unique_ptr<io_uring::ring> ring_;
+            accept_operation accept_op_;
+
+            std::atomic<bool> stopped_;
+            std::size_t background_threads_;
+
+            /// The list of accepted connections
+            mutable hpx::spinlock connections_mtx_;
+
+            using accepted_connections_set =
+                std::set<std::shared_ptr<receiver>>;
+            accepted_connections_set accepted_connections_;
+        };
+    }    // namespace policies::io_uring
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,558 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_io_uring/connection_handler.hpp>
+#include <hpx/parcelport_io_uring/ring.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+
+#include <asio/error.hpp>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::io_uring {
+
+    class connection_handler;
+
+    // The receiving end of a connection. All data is received using a single
+    // multishot receive operation, the kernel places the incoming data into
+    // the provided buffers of the ring from where it is copied into the
+    // parcel buffer. Each completed message is acknowledged by sending a
+    // single byte back to the sender, the sender does not send the next
+    // message before the acknowledgment was received.
+    class receiver : public parcelport_connection<receiver>
+    {
+        enum class read_state : std::uint8_t
+        {
+            header,
+            chunk_data,
+            data,
+            done
+        };
+
+    public:
+        receiver(io_uring::ring& r, int fd, std::uint64_t max_inbound_size,
+            connection_handler& parcelport)
+          : fd_(fd)
+          , ring_(r)
+          , max_inbound_size_(max_inbound_size)
+          , ack_(true)
+          , parcelport_(parcelport)
+          , read_op_(*this)
+          , deliver_op_(*this)
+          , close_op_(*this)
+          , ack_op_(*this)
+          , state_(read_state::done)
+          , current_target_(0)
+          , offset_(0)
+        {
+        }
+
+        receiver(receiver const&) = delete;
+        receiver(receiver&&) = delete;
+        receiver& operator=(receiver const&) = delete;
+        receiver& operator=(receiver&&) = delete;
+
+        ~receiver()
+        {
+            ::close(fd_);
+        }
+
+        int native_handle() const noexcept
+        {
+            return fd_;
+        }
+
+        // Start receiving data from the socket.
+        void start()
+        {
+            start_message();
+
+            HPX_ASSERT(!self_);
+            self_ = shared_from_this();
+            ring_.prep_recv_multishot(fd_, &read_op_);
+        }
+
+        // Shut down the socket, this will terminate the pending receive
+        // operation.
+        void shutdown() noexcept
+        {
+            ::shutdown(fd_, SHUT_RDWR);
+        }
+
+    private:
+        static std::error_code make_error_code(int res) noexcept
+        {
+            return {-res, std::system_category()};
+        }
+
+        // multishot receive operation for all data sent over this connection
+        struct read_operation : operation
+        {
+            explicit read_operation(receiver& r) noexcept
+              : this_(r)
+            {
+            }
+
+            operation* complete(int res, std::uint32_t flags) override
+            {
+                return this_.handle_read(res, flags);
+            }
+
+            receiver& this_;
+        };
+
+        // handling of a completely received message
+        struct deliver_operation : operation
+        {
+            explicit deliver_operation(receiver& r) noexcept
+              : this_(r)
+            {
+            }
+
+            operation* complete(int, std::uint32_t) override
+            {
+                return nullptr;
+            }
+
+            void run() override
+            {
+                this_.handle_read_data();
+            }
+
+            receiver& this_;
+        };
+
+        // handling of the termination of the connection
+        struct close_operation : operation
+        {
+            explicit close_operation(receiver& r) noexcept
+              : this_(r)
+            {
+            }
+
+            operation* complete(int, std::uint32_t) override
+            {
+                return nullptr;
+            }
+
+            void run() override
+            {
+                this_.handle_close();
+            }
+
+            receiver& this_;
+        };
+
+        // send operation for the acknowledgment of a message
+        struct ack_operation : operation
+        {
+            explicit ack_operation(receiver& r) noexcept
+              : this_(r)
+            {
+            }
+
+            operation* complete(int res, std::uint32_t) override
+            {
+                std::shared_ptr<receiver> self = HPX_MOVE(this_.ack_self_);
+                if (res < 0)
+                {
+                    // the receive operation will report the error as well
+                    LPT_(error).format(
+                        "io_uring receiver: writing acknowledgment: error: {}",
+                        make_error_code(res).message());
+                }
+                return nullptr;
+            }
+
+            receiver& this_;
+        };
+
+        // Invoked for each completion of the multishot receive operation
+        // while the completion queue of the ring is locked.
+        operation* handle_read(int res, std::uint32_t flags)
+        {
+            bool const last = ring::is_last_completion(flags);
+            if (res > 0 && error_)
+            {
+                // discard all data received after an error
+                ring_.recycle_buffer(flags);
+                return last ? &close_op_ : nullptr;
+            }
+
+            if (res > 0)
+            {
+                HPX_ASSERT(ring::has_buffer(flags));
+
+                bool const success = consume(
+                    ring_.buffer(flags), static_cast<std::size_t>(res));
+                ring_.recycle_buffer(flags);
+
+                if (!success)
+                {
+                    // the message exceeds the given limit or the peer did
+                    // not wait for the acknowledgment
+                    error_ = asio::error::make_error_code(
+                        asio::error::operation_not_supported);
+                    shutdown();
+                    return last ? &close_op_ : nullptr;
+                }
+
+                // the kernel may terminate the multishot operation at any
+                // time, simply start over
+                if (last)
+                    ring_.prep_recv_multishot(fd_, &read_op_);
+
+                if (state_ == read_state::done)
+                {
+                    // keep this connection alive until the message has been
+                    // handled
+                    deliver_self_ = self_;
+                    return &deliver_op_;
+                }
+                return nullptr;
+            }
+
+            if (res == -ENOBUFS && !error_)
+            {
+                // all provided buffers are in use, they are being recycled
+                // while their data is consumed, start over
+                HPX_ASSERT(last);
+                ring_.prep_recv_multishot(fd_, &read_op_);
+                return nullptr;
+            }
+
+            if (!last)
+                return nullptr;
+
+            if (!error_)
+            {
+                error_ = res == 0 ?
+                    asio::error::make_error_code(asio::error::eof) :
+                    make_error_code(res);
+            }
+            return &close_op_;
+        }
+
+        void start_message()
+        {
+            // Store the time of the begin of the read operation
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.serialization_time_ = 0;
+            data.bytes_ = 0;
+            data.num_parcels_ = 0;
+#endif
+            state_ = read_state::header;
+
+            targets_.clear();
+            add_target(&buffer_.size_, sizeof(buffer_.size_));
+            add_target(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_target(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+        }
+
+        void add_target(void* data, std::size_t size)
+        {
+            targets_.emplace_back(static_cast<char*>(data), size);
+            current_target_ = 0;
+            offset_ = 0;
+        }
+
+        // Copy the received data into the current targets, advance to the
+        // next step of reading the message whenever all targets have been
+        // filled. Returns false if the received data can't be handled.
+        bool consume(char const* data, std::size_t size)
+        {
+            while (true)
+            {
+                while (current_target_ != targets_.size() &&
+                    offset_ == targets_[current_target_].second)
+                {
+                    ++current_target_;
+                    offset_ = 0;
+                }
+
+                if (current_target_ == targets_.size())
+                {
+                    if (state_ == read_state::done || !next_state())
+                        return false;
+
+                    // no data may be sent before the message has been
+                    // acknowledged
+                    if (state_ == read_state::done)
+                        return size == 0;
+                    continue;
+                }
+
+                if (size == 0)
+                    return true;
+
+                auto& target = targets_[current_target_];
+                std::size_t const bytes = (std::min) (size,
+                    target.second - offset_);
+                std::memcpy(target.first + offset_, data, bytes);
+
+                offset_ += bytes;
+                data += bytes;
+                size -= bytes;
+            }
+        }
+
+        bool next_state()
+        {
+            switch (state_)
+            {
+            case read_state::header:
+                return handle_read_header();
+
+            case read_state::chunk_data:
+                handle_read_chunk_data();
+                return true;
+
+            case read_state::data:
+                // the message has been received completely
+                state_ = read_state::done;
+                return true;
+
+            case read_state::done:
+                [[fallthrough]];
+            default:
+                break;
+            }
+            return false;
+        }
+
+        // Handle a completed read of the message header.
+        bool handle_read_header()
+        {
+            // Determine the length of the serialized data.
+            std::uint64_t const inbound_size = buffer_.size_;
+
+            // check for the message exceeding the given limit (only if given)
+            if (max_inbound_size_ != 0 && inbound_size > max_inbound_size_)
+            {
+                return false;
+            }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.bytes_ = static_cast<std::size_t>(inbound_size);
+#endif
+            // determine the size of the chunk buffer
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            auto const num_non_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.second));
+
+            targets_.clear();
+            if (num_zero_copy_chunks != 0)
+            {
+                using transmission_chunk_type =
+                    parcel_buffer_type::transmission_chunk_type;
+
+                std::vector<transmission_chunk_type>& chunks =
+                    buffer_.transmission_chunks_;
+
+                chunks.resize(static_cast<std::size_t>(
+                    num_zero_copy_chunks + num_non_zero_copy_chunks));
+
+                add_target(chunks.data(),
+                    chunks.size() * sizeof(transmission_chunk_type));
+
+                state_ = read_state::chunk_data;
+            }
+            else
+            {
+                state_ = read_state::data;
+            }
+
+            // add main buffer holding data that was serialized normally
+            buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+            add_target(buffer_.data_.data(), buffer_.data_.size());
+
+            return true;
+        }
+
+        // Handle a completed read of the chunk descriptions and the
+        // non-zero-copy data.
+        void handle_read_chunk_data()
+        {
+            targets_.clear();
+
+            // add appropriately sized chunk buffers for the zero-copy data
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+
+            buffer_.chunks_.resize(num_zero_copy_chunks);
+
+            if (parcelport_.allow_zero_copy_receive_optimizations())
+            {
+                // De-serialize the parcels such that all data but the
+                // zero-copy chunks are in place. This de-serialization also
+                // allocates all zero-chunk buffers and stores those in the
+                // chunks array for the subsequent copying of the received
+                // data.
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[i].second);
+                    buffer_.chunks_[i] =
+                        serialization::create_pointer_chunk(nullptr, chunk_size);
+                }
+
+                parcels_ = decode_parcels_zero_copy(parcelport_, buffer_);
+
+                // note that at this point, buffer_.chunks_ will have entries
+                // for all chunks, including the non-zero-copy ones
+                std::size_t zero_copy_chunks = 0;
+                for (auto& c : buffer_.chunks_)
+                {
+                    if (c.type_ == serialization::chunk_type::chunk_type_index)
+                    {
+                        continue;    // skip non-zero-copy chunks
+                    }
+
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[zero_copy_chunks++]
+                            .second);
+
+                    HPX_ASSERT_MSG(
+                        c.data() != nullptr && c.size() == chunk_size,
+                        "zero-copy chunk buffers should have been "
+                        "initialized during de-serialization");
+
+                    add_target(c.data(), chunk_size);
+                }
+                HPX_ASSERT(zero_copy_chunks == num_zero_copy_chunks);
+            }
+            else
+            {
+                chunk_buffers_.resize(num_zero_copy_chunks);
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[i].second);
+
+                    chunk_buffers_[i].resize(chunk_size);
+                    add_target(chunk_buffers_[i].data(), chunk_size);
+
+                    buffer_.chunks_[i] = serialization::create_pointer_chunk(
+                        chunk_buffers_[i].data(), chunk_size);
+                }
+            }
+
+            state_ = read_state::data;
+        }
+
+        // Handle a completely received message, this is invoked without
+        // holding any lock of the ring.
+        void handle_read_data()
+        {
+            std::shared_ptr<receiver> self = HPX_MOVE(deliver_self_);
+
+            // complete data point and pass it along
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+#endif
+            if (parcels_.empty())
+            {
+                // decode and handle received data
+                HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
+                    !parcelport_.allow_zero_copy_receive_optimizations());
+                buffer_.set_chunk_data_owner(HPX_MOVE(chunk_buffers_));
+                handle_received_parcels(
+                    decode_parcels(parcelport_, HPX_MOVE(buffer_)));
+            }
+            else
+            {
+                // handle the received zero-copy parcels.
+                HPX_ASSERT(buffer_.num_chunks_.first != 0 &&
+                    parcelport_.allow_zero_copy_receive_optimizations());
+                handle_received_parcels(HPX_MOVE(parcels_));
+            }
+
+            buffer_ = parcel_buffer_type();
+            parcels_.clear();
+            chunk_buffers_.clear();
+
+            // The sender does not send any data before it has received the
+            // acknowledgment, it is safe to prepare for the next message.
+            start_message();
+
+            // now send acknowledgment byte
+            HPX_ASSERT(!ack_self_);
+            ack_self_ = HPX_MOVE(self);
+            ring_.prep_send(fd_, &ack_, sizeof(ack_), &ack_op_);
+        }
+
+        void handle_close()
+        {
+            std::shared_ptr<receiver> self = HPX_MOVE(self_);
+            parcelport_.handle_read_completion(error_, self);
+        }
+
+        // Socket for the parcelport_connection.
+        int fd_;
+
+        io_uring::ring& ring_;
+
+        std::uint64_t max_inbound_size_;
+
+        bool ack_;
+
+        // The handler used to process the incoming request.
+        connection_handler& parcelport_;
+
+        read_operation read_op_;
+        deliver_operation deliver_op_;
+        close_operation close_op_;
+        ack_operation ack_op_;
+
+        // keep this connection alive while operations are pending
+        std::shared_ptr<receiver> self_;
+        std::shared_ptr<receiver> deliver_self_;
+        std::shared_ptr<receiver> ack_self_;
+        std::error_code error_;
+
+        // the destinations for the data of the current part of the message
+        read_state state_;
+        std::vector<std::pair<char*, std::size_t>> targets_;
+        std::size_t current_target_;
+        std::size_t offset_;
+
+        // Counters and timers for parcels received.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+
+        std::vector<parcelset::parcel> parcels_;
+        std::vector<std::vector<char>> chunk_buffers_;
+    };
+}    // namespace hpx::parcelset::policies::io_uring
+
+#endif
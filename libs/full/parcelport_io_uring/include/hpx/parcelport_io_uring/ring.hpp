@@ -0,0 +1,190 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/modules/synchronization.hpp>
+
+#include <linux/io_uring.h>
+#include <sys/socket.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::io_uring {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Base class of all operations submitted to the ring. The address of the
+    // operation is stored as the user data of the submission queue entry and
+    // is used to dispatch the corresponding completion queue entries.
+    struct operation
+    {
+        operation() = default;
+
+        operation(operation const&) = delete;
+        operation(operation&&) = delete;
+        operation& operator=(operation const&) = delete;
+        operation& operator=(operation&&) = delete;
+
+        virtual ~operation() = default;
+
+        // Invoked for every completion queue entry of this operation while
+        // the completion queue is locked. This has to be cheap and must not
+        // suspend. Returns the operation whose run() function has to be
+        // invoked once the completion queue was unlocked (if any). The
+        // returned operation has to stay alive until run() was invoked.
+        virtual operation* complete(int res, std::uint32_t flags) = 0;
+
+        // Invoked for operations returned from complete(), without holding
+        // any lock of the ring.
+        virtual void run() {}
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Minimal wrapper around an io_uring instance (submission and completion
+    // queue) and a ring of provided buffers used by multishot receive
+    // operations. The ring is set up using the raw system calls, no additional
+    // library is required.
+    //
+    // Submissions can be prepared concurrently from any thread, they are
+    // handed to the kernel in batches by progress(). Completions are reaped by
+    // at most one thread at a time. Preparing a submission never waits for
+    // the kernel: entries which don't fit into a full submission queue are
+    // kept in a backlog which is submitted by progress().
+    class HPX_EXPORT ring
+    {
+    public:
+        ring(std::uint32_t entries, std::uint32_t num_buffers,
+            std::uint32_t buffer_size);
+
+        ring(ring const&) = delete;
+        ring(ring&&) = delete;
+        ring& operator=(ring const&) = delete;
+        ring& operator=(ring&&) = delete;
+
+        ~ring();
+
+        // Prepare a sendmsg operation, the message header (and the buffers
+        // it refers to) have to stay valid until the operation has completed.
+        void prep_sendmsg(int fd, ::msghdr const* msg, operation* op);
+
+        // Prepare a send operation of the given buffer.
+        void prep_send(
+            int fd, void const* data, std::size_t size, operation* op);
+
+        // Prepare a receive operation into the given buffer.
+        void prep_recv(int fd, void* data, std::size_t size, operation* op);
+
+        // Prepare a multishot receive operation which picks the buffers to
+        // receive into from the ring of provided buffers. Each completion
+        // carries the id of the used buffer, the buffer has to be handed
+        // back using recycle_buffer() once its contents have been consumed.
+        void prep_recv_multishot(int fd, operation* op);
+
+        // Prepare a multishot accept operation on the given listening socket.
+        // Each completion carries the file descriptor of an accepted
+        // connection.
+        void prep_accept_multishot(int fd, operation* op);
+
+        // Request cancellation of all pending operations associated with the
+        // given operation object.
+        void prep_cancel(operation* op);
+
+        // Submit all prepared operations and handle all available completion
+        // queue entries. Returns whether any work was performed.
+        bool progress();
+
+        // Return the number of operations which have not completed yet
+        std::size_t operations_in_flight() const noexcept
+        {
+            return in_flight_.load(std::memory_order_acquire);
+        }
+
+        // Access the data of the provided buffer identified by the given
+        // completion flags.
+        char const* buffer(std::uint32_t flags) const noexcept;
+
+        // Hand back a provided buffer to the kernel. This may be called from
+        // operation::complete() only.
+        void recycle_buffer(std::uint32_t flags) noexcept;
+
+        // Return whether the completion flags mark the last completion of an
+        // operation.
+        static constexpr bool is_last_completion(std::uint32_t flags) noexcept
+        {
+            return !(flags & IORING_CQE_F_MORE);
+        }
+
+        static constexpr bool has_buffer(std::uint32_t flags) noexcept
+        {
+            return (flags & IORING_CQE_F_BUFFER) != 0;
+        }
+
+    private:
+        void push_sqe(::io_uring_sqe const& sqe, operation* op);
+        void store_sqe(::io_uring_sqe const& sqe) noexcept;
+        void flush_backlog_locked();
+        void submit_locked(bool get_events);
+
+        bool sq_full() const noexcept
+        {
+            return sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >=
+                sq_entries_;
+        }
+
+        bool reap_completions();
+
+        int fd_;
+        std::uint32_t features_;
+
+        // submission queue
+        hpx::spinlock sq_mtx_;
+        void* sq_ring_;
+        std::size_t sq_ring_size_;
+        std::uint32_t* sq_head_;
+        std::uint32_t* sq_tail_;
+        std::uint32_t* sq_flags_;
+        std::uint32_t sq_mask_;
+        std::uint32_t sq_entries_;
+        ::io_uring_sqe* sqes_;
+        std::size_t sqes_size_;
+        std::uint32_t sqe_tail_;
+        std::atomic<std::uint32_t> to_submit_;
+        std::deque<::io_uring_sqe> backlog_;
+        std::atomic<bool> has_backlog_;
+
+        // completion queue
+        hpx::spinlock cq_mtx_;
+        void* cq_ring_;
+        std::size_t cq_ring_size_;
+        std::uint32_t* cq_head_;
+        std::uint32_t* cq_tail_;
+        std::uint32_t cq_mask_;
+        ::io_uring_cqe* cqes_;
+
+        // provided buffers
+        ::io_uring_buf_ring* buf_ring_;
+        std::size_t buf_ring_size_;
+        char* buffers_;
+        std::uint32_t num_buffers_;
+        std::uint32_t buffer_size_;
+        std::uint16_t buf_tail_;
+
+        std::atomic<std::size_t> in_flight_;
+    };
+}    // namespace hpx::parcelset::policies::io_uring
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
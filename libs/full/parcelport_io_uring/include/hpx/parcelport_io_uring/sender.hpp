@@ -0,0 +1,398 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/asio.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_io_uring/locality.hpp>
+#include <hpx/parcelport_io_uring/ring.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+#include <hpx/parcelset_base/detail/gatherer.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <asio/error.hpp>
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+// The asio support includes termios.h.
+// The termios.h file on ppc64le defines these macros, which
+// are also used by blaze, blaze_tensor as Template names.
+// Make sure we undefine them before continuing.
+#undef VT1
+#undef VT2
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::io_uring {
+
+    class sender : public parcelset::parcelport_connection<sender>
+    {
+        using postprocess_handler_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+
+    public:
+        // Construct a sending parcelport_connection with the given io_context,
+        // the io_context is used for establishing the connection only, all
+        // data is sent using the given ring.
+        sender(io_uring::ring& r, asio::io_context& io_service,
+            parcelset::locality const& locality_id,
+            [[maybe_unused]] parcelset::parcelport* pp)
+          : socket_(io_service)
+          , ring_(r)
+          , ack_(0)
+          , there_(locality_id)
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+          , pp_(pp)
+#endif
+          , write_op_(*this)
+          , ack_op_(*this)
+          , message_{}
+        {
+        }
+
+        ~sender()
+        {
+            // gracefully and portably shutdown the socket
+            if (socket_.is_open())
+            {
+                // NOLINTBEGIN(bugprone-unused-return-value)
+                std::error_code ec;
+                socket_.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+
+                // close the socket to give it back to the OS
+                socket_.close(ec);
+                // NOLINTEND(bugprone-unused-return-value)
+            }
+        }
+
+        // Get the socket associated with the parcelport_connection.
+        asio::ip::tcp::socket& socket() noexcept
+        {
+            return socket_;
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const& parcel_locality_id) const
+        {
+#if defined(HPX_DEBUG)
+            std::error_code ec;
+            asio::ip::tcp::socket::endpoint_type const endpoint =
+                socket_.remote_endpoint(ec);
+
+            locality const& impl = parcel_locality_id.get<locality>();
+
+            // We just ignore failures here. Those are the reason for
+            // remote endpoint not connected errors which occur
+            // when the runtime is in hpx::state::shutdown
+            if (!ec)
+            {
+                HPX_ASSERT(hpx::util::cleanup_ip_address(impl.address()) ==
+                    hpx::util::cleanup_ip_address(
+                        endpoint.address().to_string()));
+                HPX_ASSERT(impl.port() == endpoint.port());
+            }
+#else
+            HPX_UNUSED(parcel_locality_id);
+#endif
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+            HPX_ASSERT(!buffer_.data_.empty());
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+
+            handler_ = HPX_FORWARD(Handler, handler);
+            postprocess_handler_ =
+                HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+            HPX_ASSERT(handler_);
+            HPX_ASSERT(postprocess_handler_);
+
+            /// Increment sends and begin timer.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            // Write the serialized data to the socket. We use "gather-write"
+            // to send both the header and the data in a single sendmsg
+            // operation. The wire format is the same as for the TCP
+            // parcelport.
+            iovecs_.clear();
+            add_buffer(&buffer_.size_, sizeof(buffer_.size_));
+            add_buffer(&buffer_.data_size_, sizeof(buffer_.data_size_));
+
+            // add chunk description
+            add_buffer(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+
+            std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            if (!chunks.empty())
+            {
+                add_buffer(chunks.data(),
+                    chunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type));
+
+                // add main buffer holding data which was serialized normally
+                add_buffer(buffer_.data_.data(), buffer_.data_.size());
+
+                // now add chunks themselves, those hold zero-copy serialized
+                // chunks
+                for (serialization::serialization_chunk& c : buffer_.chunks_)
+                {
+                    if (c.type_ ==
+                            serialization::chunk_type::chunk_type_pointer ||
+                        c.type_ ==
+                            serialization::chunk_type::chunk_type_const_pointer)
+                    {
+                        add_buffer(c.data_.cpos_, c.size_);
+                    }
+                }
+            }
+            else
+            {
+                // add main buffer holding data which was serialized normally
+                add_buffer(buffer_.data_.data(), buffer_.data_.size());
+            }
+
+            message_ = {};
+            message_.msg_iov = iovecs_.data();
+            message_.msg_iovlen = iovecs_.size();
+
+            // keep this parcelport_connection object alive until the
+            // acknowledgment for this message has been received
+            HPX_ASSERT(!self_);
+            self_ = shared_from_this();
+            error_ = std::error_code();
+
+            ring_.prep_sendmsg(socket_.native_handle(), &message_, &write_op_);
+        }
+
+    private:
+        void add_buffer(void const* data, std::size_t size)
+        {
+            iovecs_.push_back(::iovec{const_cast<void*>(data), size});
+        }
+
+        // Drop the first bytes of the message after a partial send, returns
+        // whether anything is left to send.
+        bool consume(std::size_t bytes) noexcept
+        {
+            while (message_.msg_iovlen != 0 &&
+                bytes >= message_.msg_iov->iov_len)
+            {
+                bytes -= message_.msg_iov->iov_len;
+                ++message_.msg_iov;
+                --message_.msg_iovlen;
+            }
+
+            if (message_.msg_iovlen == 0)
+                return false;
+
+            message_.msg_iov->iov_base =
+                static_cast<char*>(message_.msg_iov->iov_base) + bytes;
+            message_.msg_iov->iov_len -= bytes;
+            return true;
+        }
+
+        static std::error_code make_error_code(int res) noexcept
+        {
+            return {-res, std::system_category()};
+        }
+
+        // completion of the sendmsg operation writing the message
+        struct write_operation : operation
+        {
+            explicit write_operation(sender& s) noexcept
+              : this_(s)
+            {
+            }
+
+            operation* complete(int res, std::uint32_t) override
+            {
+                if (res < 0)
+                {
+                    this_.error_ = make_error_code(res);
+                    return this;
+                }
+
+                // the kernel may have sent only parts of the message
+                if (this_.consume(static_cast<std::size_t>(res)))
+                {
+                    this_.ring_.prep_sendmsg(this_.socket_.native_handle(),
+                        &this_.message_, this);
+                    return nullptr;
+                }
+                return this;
+            }
+
+            void run() override
+            {
+                this_.handle_write(this_.error_);
+            }
+
+            sender& this_;
+        };
+
+        // completion of the receive operation reading the acknowledgment
+        struct ack_operation : operation
+        {
+            explicit ack_operation(sender& s) noexcept
+              : this_(s)
+            {
+            }
+
+            operation* complete(int res, std::uint32_t) override
+            {
+                if (res < 0)
+                {
+                    this_.error_ = make_error_code(res);
+                }
+                else if (res == 0)
+                {
+                    this_.error_ = asio::error::make_error_code(asio::error::eof);
+                }
+                return this;
+            }
+
+            void run() override
+            {
+                this_.handle_read_ack(this_.error_);
+            }
+
+            sender& this_;
+        };
+
+        static void reset_handler(postprocess_handler_type handler)
+        {
+            handler.reset();
+        }
+
+        /// handle completed write operation
+        void handle_write(std::error_code const& e)
+        {
+            // just call initial handler
+            handler_(e);
+
+            postprocess_handler_type handler;
+            std::swap(handler, handler_);
+
+            if (threads::threadmanager_is(hpx::state::running))
+            {
+                // the handler needs to be reset on an HPX thread (it destroys
+                // the parcel, which in turn might invoke HPX functions)
+                threads::thread_init_data data(
+                    threads::make_thread_function_nullary(util::deferred_call(
+                        &sender::reset_handler, HPX_MOVE(handler))),
+                    "sender::reset_handler");
+                threads::register_thread(data);
+            }
+            else
+            {
+                reset_handler(HPX_MOVE(handler));
+            }
+
+            if (e)
+            {
+                // inform post-processing handler of error as well
+                std::shared_ptr<sender> self = HPX_MOVE(self_);
+
+                hpx::move_only_function<void(std::error_code const&,
+                    parcelset::locality const&, std::shared_ptr<sender>)>
+                    postprocess_handler;
+                std::swap(postprocess_handler, postprocess_handler_);
+                postprocess_handler(e, there_, HPX_MOVE(self));
+                return;
+            }
+
+            // complete data point and push back onto gatherer
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+#endif
+
+            // now handle the acknowledgment byte which is sent by the receiver
+            ring_.prep_recv(socket_.native_handle(), &ack_, sizeof(ack_),
+                &ack_op_);
+        }
+
+        void handle_read_ack(std::error_code const& e)
+        {
+            buffer_.clear();
+
+            // Call post-processing handler, which will send remaining pending
+            // parcels. Pass along the connection so it can be reused if more
+            // parcels have to be sent. The post-processing handler may start
+            // another write operation on this connection.
+            std::shared_ptr<sender> self = HPX_MOVE(self_);
+
+            hpx::move_only_function<void(std::error_code const&,
+                parcelset::locality const&, std::shared_ptr<sender>)>
+                postprocess_handler;
+            std::swap(postprocess_handler, postprocess_handler_);
+            postprocess_handler(e, there_, HPX_MOVE(self));
+        }
+
+        // Socket for the parcelport_connection, used to establish the
+        // connection.
+        asio::ip::tcp::socket socket_;
+
+        io_uring::ring& ring_;
+
+        std::uint8_t ack_;
+
+        // the other (receiving) end of this connection
+        parcelset::locality there_;
+
+        // Counters and their data containers.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+        parcelset::parcelport* pp_;
+#endif
+
+        write_operation write_op_;
+        ack_operation ack_op_;
+
+        // the message currently being sent, the vector of buffers is reused
+        // for all messages sent over this connection
+        std::vector<::iovec> iovecs_;
+        ::msghdr message_;
+
+        std::error_code error_;
+        std::shared_ptr<sender> self_;
+
+        postprocess_handler_type handler_;
+        hpx::move_only_function<void(std::error_code const&,
+            parcelset::locality const&, std::shared_ptr<sender>)>
+            postprocess_handler_;
+    };
+}    // namespace hpx::parcelset::policies::io_uring
+
+#endif
@@ -0,0 +1,472 @@
+//  Copyright (c) 2007-2021 Hartmut Kaiser
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/asio.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_io_uring/connection_handler.hpp>
+#include <hpx/parcelport_io_uring/locality.hpp>
+#include <hpx/parcelport_io_uring/receiver.hpp>
+#include <hpx/parcelport_io_uring/ring.hpp>
+#include <hpx/parcelport_io_uring/sender.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/post.hpp>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace hpx::parcelset::policies::io_uring {
+
+    parcelset::locality parcelport_address(
+        util::runtime_configuration const& ini)
+    {
+        // load all components as described in the configuration information
+        if (ini.has_section("hpx.parcel"))
+        {
+            util::section const* sec = ini.get_section("hpx.parcel");
+            if (nullptr != sec)
+            {
+                return parcelset::locality(
+                    locality(sec->get_entry("address", HPX_INITIAL_IP_ADDRESS),
+                        hpx::util::get_entry_as<std::uint16_t>(
+                            *sec, "port", HPX_INITIAL_IP_PORT)));
+            }
+        }
+
+        return parcelset::locality(
+            locality(HPX_INITIAL_IP_ADDRESS, HPX_INITIAL_IP_PORT));
+    }
+
+    namespace {
+
+        // The parcelport object is created even if it is not enabled, the
+        // ring is created only if it will be used.
+        std::unique_ptr<io_uring::ring> create_ring(
+            util::runtime_configuration const& ini)
+        {
+            if (hpx::util::get_entry_as<int>(
+                    ini, "hpx.parcel.io_uring.enable", 0) == 0)
+            {
+                return {};
+            }
+
+            return std::make_unique<io_uring::ring>(
+                hpx::util::get_entry_as<std::uint32_t>(
+                    ini, "hpx.parcel.io_uring.ring_entries", 256),
+                hpx::util::get_entry_as<std::uint32_t>(
+                    ini, "hpx.parcel.io_uring.receive_buffers", 64),
+                hpx::util::get_entry_as<std::uint32_t>(
+                    ini, "hpx.parcel.io_uring.receive_buffer_size", 65536));
+        }
+    }    // namespace
+
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        threads::policies::callback_notifier const& notifier)
+      : base_type(ini, parcelport_address(ini), notifier)
+      , acceptor_(nullptr)
+      , ring_(create_ring(ini))
+      , accept_op_(*this)
+      , stopped_(false)
+      , background_threads_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.io_uring.background_threads", std::size_t(-1)))
+    {
+        if (here_.type() != std::string("io_uring"))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "io_uring::parcelport::parcelport",
+                "this parcelport was instantiated to represent an unexpected "
+                "locality type: {}",
+                here_.type());
+        }
+    }
+
+    connection_handler::~connection_handler()
+    {
+        HPX_ASSERT(acceptor_ == nullptr);
+        delete acceptor_;    // silence overeager security reports
+    }
+
+    bool connection_handler::do_run()
+    {
+        if (!ring_)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "io_uring::parcelport::run",
+                "the io_uring parcelport was started without being enabled "
+                "(hpx.parcel.io_uring.enable=1)");
+        }
+
+        using asio::ip::tcp;
+        asio::io_context& io_service = io_service_pool_.get_io_service();
+        if (nullptr == acceptor_)
+            acceptor_ = new tcp::acceptor(io_service);
+
+        // initialize network, listen on the first usable endpoint
+        std::size_t tried = 0;
+        exception_list errors;
+        util::endpoint_iterator_type const end = util::accept_end();
+        for (util::endpoint_iterator_type it =
+                 util::accept_begin(here_.get<locality>(), io_service);
+            it != end; ++it, ++tried)
+        {
+            try
+            {
+                tcp::endpoint ep = *it;
+                acceptor_->open(ep.protocol());
+                acceptor_->set_option(tcp::acceptor::reuse_address(true));
+                acceptor_->bind(ep);
+                acceptor_->listen();
+
+                // all incoming connections are accepted by the ring
+                ring_->prep_accept_multishot(
+                    acceptor_->native_handle(), &accept_op_);
+                break;
+            }
+            catch (std::system_error const&)
+            {
+                std::error_code ec;
+                // NOLINTNEXTLINE(bugprone-unused-return-value)
+                acceptor_->close(ec);
+
+                errors.add(std::current_exception());
+                continue;
+            }
+        }
+
+        if (errors.size() == tried)
+        {
+            // all attempts failed
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "io_uring::parcelport::run", errors.get_message());
+        }
+
+        // the ring has to be driven while the runtime is starting up as no
+        // background work is performed before that
+        for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+        {
+#if ASIO_VERSION >= 103400
+            asio::post(io_service_pool_.get_io_service(static_cast<int>(i)),
+                hpx::bind(&connection_handler::io_service_work, this));
+#else
+            io_service_pool_.get_io_service(static_cast<int>(i))
+                .post(hpx::bind(&connection_handler::io_service_work, this));
+#endif
+        }
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        // stop accepting new connections
+        stopped_.store(true, std::memory_order_release);
+
+        if (ring_)
+        {
+            if (acceptor_ != nullptr)
+            {
+                ring_->prep_cancel(&accept_op_);
+            }
+
+            {
+                // terminate all pending read operations, the connections are
+                // removed from the list once their read operation completed
+                std::lock_guard<hpx::spinlock> l(connections_mtx_);
+                for (std::shared_ptr<receiver> const& c : accepted_connections_)
+                {
+                    c->shutdown();
+                }
+            }
+
+            // wait for all operations to complete
+            while (ring_->operations_in_flight() != 0)
+            {
+                if (!ring_->progress())
+                {
+                    if (threads::get_self_ptr())
+                    {
+                        hpx::this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "io_uring::parcelport::do_stop");
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+
+        {
+            std::lock_guard<hpx::spinlock> l(connections_mtx_);
+            accepted_connections_.clear();
+        }
+
+        if (acceptor_ != nullptr)
+        {
+            std::error_code ec;
+            // NOLINTNEXTLINE(bugprone-unused-return-value)
+            acceptor_->close(ec);
+            delete acceptor_;
+            acceptor_ = nullptr;
+        }
+    }
+
+    std::shared_ptr<sender> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        asio::io_context& io_service = io_service_pool_.get_io_service();
+
+        // The parcel gets serialized inside the connection constructor, no
+        // need to keep the original parcel alive after this call returned.
+        auto sender_connection =
+            std::make_shared<sender>(*ring_, io_service, l, this);
+
+        // Connect to the target locality, retry if needed
+        std::error_code error = asio::error::try_again;
+        for (std::size_t i = 0; i < HPX_MAX_NETWORK_RETRIES; ++i)
+        {
+            // The acceptor is only nullptr when the parcelport has been
+            // stopped. An exit here, avoids hangs when late parcels are in
+            // flight (those are mainly decref requests).
+            if (acceptor_ == nullptr)
+                return std::shared_ptr<sender>();
+            try
+            {
+                util::endpoint_iterator_type end = util::connect_end();
+                for (util::endpoint_iterator_type it =
+                         util::connect_begin(l.get<locality>(), io_service);
+                    it != end; ++it)
+                {
+                    asio::ip::tcp::socket& s = sender_connection->socket();
+                    s.close();
+                    // NOLINTNEXTLINE(bugprone-unused-return-value)
+                    s.connect(*it, error);
+                    if (!error)
+                        break;
+                }
+                if (!error)
+                    break;
+
+                // wait for a really short amount of time
+                if (hpx::threads::get_self_ptr())
+                {
+                    this_thread::suspend(
+                        hpx::threads::thread_schedule_state::pending,
+                        "connection_handler(io_uring)::create_connection");
+                }
+                else
+                {
+                    std::this_thread::sleep_for(
+                        std::chrono::milliseconds(HPX_NETWORK_RETRIES_SLEEP));
+                }
+            }
+            catch (std::system_error const& e)
+            {
+                sender_connection->socket().close();
+                sender_connection.reset();
+
+                HPX_THROWS_IF(ec, hpx::error::network_error,
+                    "io_uring::connection_handler::get_connection", e.what());
+                return sender_connection;    //-V614
+            }
+        }
+
+        if (error)
+        {
+            sender_connection->socket().close();
+            sender_connection.reset();
+
+            if (tolerate_node_faults())
+                return sender_connection;
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "io_uring::connection_handler::get_connection",
+                "{} (while trying to connect to: {})", error.message(), l);
+            return sender_connection;
+        }
+
+        // make sure the Nagle algorithm is disabled for this socket,
+        // disable lingering on close
+        asio::ip::tcp::socket& s = sender_connection->socket();
+
+        s.set_option(asio::ip::tcp::no_delay(true));
+        s.set_option(asio::socket_base::linger(true, 0));
+
+#if defined(HPX_DEBUG)
+        HPX_ASSERT(l == sender_connection->destination());
+
+        std::string const connection_addr =
+            s.remote_endpoint().address().to_string();
+        std::uint16_t const connection_port = s.remote_endpoint().port();
+        HPX_ASSERT(hpx::util::cleanup_ip_address(l.get<locality>().address()) ==
+            hpx::util::cleanup_ip_address(connection_addr));
+        HPX_ASSERT(l.get<locality>().port() == connection_port);
+#endif
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return sender_connection;
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const& ini) const
+    {
+        // load all components as described in the configuration information
+        if (ini.has_section("hpx.agas"))
+        {
+            util::section const* sec = ini.get_section("hpx.agas");
+            if (nullptr != sec)
+            {
+                return parcelset::locality(
+                    locality(sec->get_entry("address", HPX_INITIAL_IP_ADDRESS),
+                        hpx::util::get_entry_as<std::uint16_t>(
+                            *sec, "port", HPX_INITIAL_IP_PORT)));
+            }
+        }
+
+        return parcelset::locality(
+            locality(HPX_INITIAL_IP_ADDRESS, HPX_INITIAL_IP_PORT));
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    bool connection_handler::background_work(
+        std::size_t num_thread, parcelport_background_mode)
+    {
+        if (!ring_ || num_thread >= background_threads_)
+        {
+            return false;
+        }
+
+        // sending and receiving is handled by the same ring
+        return ring_->progress();
+    }
+
+    void connection_handler::io_service_work()
+    {
+        std::size_t k = 0;
+
+        // We only execute work on the IO service while HPX is starting
+        while (hpx::is_starting())
+        {
+            if (ring_->progress())
+            {
+                k = 0;
+            }
+            else
+            {
+                ++k;
+                util::detail::yield_k(k,
+                    "hpx::parcelset::policies::io_uring::connection_handler::"
+                    "io_service_work");
+            }
+        }
+    }
+
+    // accepted new incoming connection
+    operation* connection_handler::accept_operation::complete(
+        int res, std::uint32_t flags)
+    {
+        if (res >= 0)
+        {
+            // disable Nagle algorithm, disable lingering on close
+            int const no_delay = 1;
+            ::setsockopt(
+                res, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+            ::linger const no_linger = {1, 0};
+            ::setsockopt(
+                res, SOL_SOCKET, SO_LINGER, &no_linger, sizeof(no_linger));
+
+            auto c = std::make_shared<receiver>(*this_.ring_, res,
+                this_.get_max_inbound_message_size(), this_);
+
+            {
+                // keep track of all accepted connections, connections
+                // accepted while the parcelport is being stopped are closed
+                // right away
+                std::lock_guard<hpx::spinlock> l(this_.connections_mtx_);
+                if (this_.stopped_.load(std::memory_order_acquire))
+                {
+                    return nullptr;
+                }
+                this_.accepted_connections_.insert(c);
+            }
+
+            // now accept the incoming connection by starting to read from the
+            // socket
+            c->start();
+        }
+        else if (res != -ECANCELED)
+        {
+            LPT_(error).format("handle accept operation completion: error: {}",
+                std::error_code(-res, std::system_category()).message());
+        }
+
+        // the kernel may terminate the multishot operation at any time
+        if (ring::is_last_completion(flags) && res != -ECANCELED &&
+            !this_.stopped_.load(std::memory_order_acquire))
+        {
+            this_.ring_->prep_accept_multishot(
+                this_.acceptor_->native_handle(), this);
+        }
+        return nullptr;
+    }
+
+    // Handle completion of a read operation.
+    void connection_handler::handle_read_completion(std::error_code const& e,
+        std::shared_ptr<receiver> const& receiver_conn)
+    {
+        if (!e)
+        {
+            return;
+        }
+
+        if (e != asio::error::operation_aborted && e != asio::error::eof)
+        {
+            LPT_(error).format(
+                "handle read operation completion: error: {}", e.message());
+        }
+
+        {
+            // remove this connection from the list of known connections
+            std::lock_guard<hpx::spinlock> l(connections_mtx_);
+            accepted_connections_.erase(receiver_conn);
+        }
+    }
+}    // namespace hpx::parcelset::policies::io_uring
+
+#endif
@@ -0,0 +1,70 @@
+//  Copyright (c) 2007-2023 Hartmut Kaiser
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/parcelport_io_uring/connection_handler.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+// Inject additional configuration data into the factory registry for this type.
+// This information ends up in the system wide configuration database under the
+// plugin specific section:
+//
+//      [hpx.parcel.io_uring]
+//      ...
+//      priority = 10
+//      enable = 0
+//      ring_entries = 256
+//      receive_buffers = 64
+//      receive_buffer_size = 65536
+//      background_threads = -1
+//
+template <>
+struct hpx::traits::plugin_config_data<
+    hpx::parcelset::policies::io_uring::connection_handler>
+{
+    static constexpr char const* priority() noexcept
+    {
+        return "10";
+    }
+
+    static constexpr void init(int* /* argc */, char*** /* argv */,
+        util::command_line_handling& /* cfg */) noexcept
+    {
+    }
+
+    // by default no additional initialization using the resource
+    // partitioner is required
+    static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+    static constexpr void destroy() noexcept {}
+
+    static constexpr char const* call() noexcept
+    {
+        // This parcelport listens on the same address as the TCP parcelport,
+        // it has to be enabled explicitly (which requires disabling the TCP
+        // parcelport).
+        return "enable = ${HPX_PARCEL_IO_URING_ENABLE:0}\n"
+               // number of submission queue entries
+               "ring_entries = ${HPX_PARCEL_IO_URING_RING_ENTRIES:256}\n"
+               // number and size of the buffers used for receiving data
+               "receive_buffers = ${HPX_PARCEL_IO_URING_RECEIVE_BUFFERS:64}\n"
+               "receive_buffer_size = "
+               "${HPX_PARCEL_IO_URING_RECEIVE_BUFFER_SIZE:65536}\n"
+               // number of cores driving the ring, -1: all
+               "background_threads = "
+               "${HPX_PARCEL_IO_URING_BACKGROUND_THREADS:-1}\n";
+    }
+};    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::io_uring::connection_handler, io_uring)
+
+#endif
@@ -0,0 +1,527 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelport_io_uring/ring.hpp>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+namespace hpx::parcelset::policies::io_uring {
+
+    namespace {
+
+        int io_uring_setup(std::uint32_t entries, ::io_uring_params* p) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+        }
+
+        int io_uring_enter(int fd, std::uint32_t to_submit,
+            std::uint32_t min_complete, std::uint32_t flags) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd,
+                to_submit, min_complete, flags, nullptr, 0));
+        }
+
+        int io_uring_register(int fd, unsigned int opcode, void* arg,
+            unsigned int nr_args) noexcept
+        {
+            return static_cast<int>(
+                ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+        }
+
+        // The buffers overlay the header of the provided buffer ring. Note that
+        // the declaration of the flexible array member in the kernel headers
+        // is not layout compatible if compiled as C++.
+        ::io_uring_buf* buffer_ring_entries(::io_uring_buf_ring* r) noexcept
+        {
+            return reinterpret_cast<::io_uring_buf*>(r);
+        }
+
+        template <typename T>
+        T* ring_offset(void* base, std::uint32_t offset) noexcept
+        {
+            return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+        }
+
+        std::uint32_t load_acquire(std::uint32_t const* p) noexcept
+        {
+            return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+        }
+
+        template <typename T>
+        void store_release(T* p, T value) noexcept
+        {
+            __atomic_store_n(p, value, __ATOMIC_RELEASE);
+        }
+
+        // Create an empty submission queue entry for the given operation
+        ::io_uring_sqe make_sqe(operation* op) noexcept
+        {
+            ::io_uring_sqe sqe;
+            std::memset(&sqe, 0, sizeof(::io_uring_sqe));
+            sqe.user_data = reinterpret_cast<std::uint64_t>(op);
+            return sqe;
+        }
+
+        void* map_ring(int fd, std::size_t size, off_t offset)
+        {
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd, offset);
+            if (p == MAP_FAILED)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::network_error,
+                    "io_uring::ring::ring",
+                    "mapping the io_uring queues failed: {}",
+                    std::strerror(errno));
+            }
+            return p;
+        }
+    }    // namespace
+
+    ring::ring(std::uint32_t entries, std::uint32_t num_buffers,
+        std::uint32_t buffer_size)
+      : fd_(-1)
+      , features_(0)
+      , sq_ring_(nullptr)
+      , sq_ring_size_(0)
+      , sq_head_(nullptr)
+      , sq_tail_(nullptr)
+      , sq_flags_(nullptr)
+      , sq_mask_(0)
+      , sq_entries_(0)
+      , sqes_(nullptr)
+      , sqes_size_(0)
+      , sqe_tail_(0)
+      , to_submit_(0)
+      , has_backlog_(false)
+      , cq_ring_(nullptr)
+      , cq_ring_size_(0)
+      , cq_head_(nullptr)
+      , cq_tail_(nullptr)
+      , cq_mask_(0)
+      , cqes_(nullptr)
+      , buf_ring_(nullptr)
+      , buf_ring_size_(0)
+      , buffers_(nullptr)
+      , num_buffers_(num_buffers)
+      , buffer_size_(buffer_size)
+      , buf_tail_(0)
+      , in_flight_(0)
+    {
+        if (num_buffers_ == 0 || (num_buffers_ & (num_buffers_ - 1)) != 0 ||
+            num_buffers_ > 32768)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "io_uring::ring::ring",
+                "the number of receive buffers must be a power of two not "
+                "larger than 32768, got: {}",
+                num_buffers_);
+        }
+
+        // the completion queue is made larger than the submission queue as
+        // multishot operations can generate many completions
+        ::io_uring_params params{};
+        params.flags = IORING_SETUP_CQSIZE;
+        params.cq_entries = 4 * entries;
+
+        fd_ = io_uring_setup(entries, &params);
+        if (fd_ < 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "io_uring::ring::ring", "io_uring_setup failed: {}",
+                std::strerror(errno));
+        }
+        features_ = params.features;
+
+        sq_ring_size_ =
+            params.sq_off.array + params.sq_entries * sizeof(std::uint32_t);
+        cq_ring_size_ =
+            params.cq_off.cqes + params.cq_entries * sizeof(::io_uring_cqe);
+
+        // both rings can be mapped at once with newer kernels
+        if (features_ & IORING_FEAT_SINGLE_MMAP)
+        {
+            sq_ring_size_ = cq_ring_size_ =
+                (std::max) (sq_ring_size_, cq_ring_size_);
+        }
+
+        sq_ring_ = map_ring(fd_, sq_ring_size_, IORING_OFF_SQ_RING);
+        if (features_ & IORING_FEAT_SINGLE_MMAP)
+        {
+            cq_ring_ = sq_ring_;
+        }
+        else
+        {
+            cq_ring_ = map_ring(fd_, cq_ring_size_, IORING_OFF_CQ_RING);
+        }
+
+        sq_head_ = ring_offset<std::uint32_t>(sq_ring_, params.sq_off.head);
+        sq_tail_ = ring_offset<std::uint32_t>(sq_ring_, params.sq_off.tail);
+        sq_flags_ = ring_offset<std::uint32_t>(sq_ring_, params.sq_off.flags);
+        sq_mask_ =
+            *ring_offset<std::uint32_t>(sq_ring_, params.sq_off.ring_mask);
+        sq_entries_ =
+            *ring_offset<std::uint32_t>(sq_ring_, params.sq_off.ring_entries);
+
+        sqes_size_ = params.sq_entries * sizeof(::io_uring_sqe);
+        sqes_ = static_cast<::io_uring_sqe*>(
+            map_ring(fd_, sqes_size_, IORING_OFF_SQES));
+
+        // submission queue entries are always used in order, which allows to
+        // initialize the indirection array once
+        auto* array =
+            ring_offset<std::uint32_t>(sq_ring_, params.sq_off.array);
+        for (std::uint32_t i = 0; i != sq_entries_; ++i)
+        {
+            array[i] = i;
+        }
+        sqe_tail_ = *sq_tail_;
+
+        cq_head_ = ring_offset<std::uint32_t>(cq_ring_, params.cq_off.head);
+        cq_tail_ = ring_offset<std::uint32_t>(cq_ring_, params.cq_off.tail);
+        cq_mask_ =
+            *ring_offset<std::uint32_t>(cq_ring_, params.cq_off.ring_mask);
+        cqes_ = ring_offset<::io_uring_cqe>(cq_ring_, params.cq_off.cqes);
+
+        // set up the ring of provided buffers, the kernel picks the buffers
+        // for multishot receive operations from this ring
+        buf_ring_size_ = num_buffers_ * sizeof(::io_uring_buf);
+        void* p = ::mmap(nullptr, buf_ring_size_, PROT_READ | PROT_WRITE,
+            MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+        if (p == MAP_FAILED)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "io_uring::ring::ring",
+                "allocating the provided buffer ring failed: {}",
+                std::strerror(errno));
+        }
+        buf_ring_ = static_cast<::io_uring_buf_ring*>(p);
+
+        ::io_uring_buf_reg reg{};
+        reg.ring_addr = reinterpret_cast<std::uint64_t>(buf_ring_);
+        reg.ring_entries = num_buffers_;
+        reg.bgid = 0;
+        if (io_uring_register(fd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "io_uring::ring::ring",
+                "registering the provided buffer ring failed (the io_uring "
+                "parcelport requires Linux 6.0 or newer): {}",
+                std::strerror(errno));
+        }
+
+        buffers_ = new char[static_cast<std::size_t>(num_buffers_) *
+            buffer_size_];
+        ::io_uring_buf* bufs = buffer_ring_entries(buf_ring_);
+        for (std::uint32_t i = 0; i != num_buffers_; ++i)
+        {
+            ::io_uring_buf& buf = bufs[i];
+            buf.addr = reinterpret_cast<std::uint64_t>(
+                buffers_ + static_cast<std::size_t>(i) * buffer_size_);
+            buf.len = buffer_size_;
+            buf.bid = static_cast<std::uint16_t>(i);
+        }
+        buf_tail_ = static_cast<std::uint16_t>(num_buffers_);
+        store_release(&buf_ring_->tail, buf_tail_);
+    }
+
+    ring::~ring()
+    {
+        HPX_ASSERT(in_flight_ == 0);
+
+        // closing the file descriptor releases all registered resources
+        if (fd_ >= 0)
+            ::close(fd_);
+
+        if (buf_ring_ != nullptr)
+            ::munmap(buf_ring_, buf_ring_size_);
+        if (sqes_ != nullptr)
+            ::munmap(sqes_, sqes_size_);
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+            ::munmap(cq_ring_, cq_ring_size_);
+        if (sq_ring_ != nullptr)
+            ::munmap(sq_ring_, sq_ring_size_);
+
+        delete[] buffers_;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void ring::push_sqe(::io_uring_sqe const& sqe, operation* op)
+    {
+        if (op != nullptr)
+            ++in_flight_;
+
+        std::lock_guard<hpx::spinlock> l(sq_mtx_);
+
+        // entries in the backlog have to be submitted first
+        if (backlog_.empty())
+        {
+            if (sq_full())
+                submit_locked(false);
+
+            if (!sq_full())
+            {
+                store_sqe(sqe);
+                return;
+            }
+        }
+
+        // The kernel does not accept new submissions while the completion
+        // queue overflows, only reaping completions makes room again. This
+        // may be invoked while completions are being reaped, so the entry is
+        // left to the next call to progress() instead of waiting here.
+        backlog_.push_back(sqe);
+        has_backlog_.store(true, std::memory_order_relaxed);
+    }
+
+    // Must be called while holding sq_mtx_
+    void ring::store_sqe(::io_uring_sqe const& sqe) noexcept
+    {
+        HPX_ASSERT(!sq_full());
+
+        sqes_[sqe_tail_ & sq_mask_] = sqe;
+        store_release(sq_tail_, ++sqe_tail_);
+        to_submit_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Must be called while holding sq_mtx_
+    void ring::flush_backlog_locked()
+    {
+        while (!backlog_.empty())
+        {
+            if (sq_full())
+            {
+                submit_locked(false);
+                if (sq_full())
+                    break;
+            }
+
+            store_sqe(backlog_.front());
+            backlog_.pop_front();
+        }
+        has_backlog_.store(!backlog_.empty(), std::memory_order_relaxed);
+    }
+
+    // Must be called while holding sq_mtx_
+    void ring::submit_locked(bool get_events)
+    {
+        std::uint32_t const to_submit =
+            to_submit_.exchange(0, std::memory_order_relaxed);
+        if (to_submit == 0 && !get_events)
+            return;
+
+        int const ret = io_uring_enter(
+            fd_, to_submit, 0, get_events ? IORING_ENTER_GETEVENTS : 0);
+        if (ret < 0)
+        {
+            // try again during the next call to progress()
+            to_submit_.fetch_add(to_submit, std::memory_order_relaxed);
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::network_error,
+                    "io_uring::ring::submit", "io_uring_enter failed: {}",
+                    std::strerror(errno));
+            }
+        }
+        else if (static_cast<std::uint32_t>(ret) < to_submit)
+        {
+            to_submit_.fetch_add(
+                to_submit - ret, std::memory_order_relaxed);
+        }
+    }
+
+    void ring::prep_sendmsg(int fd, ::msghdr const* msg, operation* op)
+    {
+        ::io_uring_sqe sqe = make_sqe(op);
+        sqe.opcode = IORING_OP_SENDMSG;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<std::uint64_t>(msg);
+        sqe.len = 1;
+        sqe.msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+        push_sqe(sqe, op);
+    }
+
+    void ring::prep_send(
+        int fd, void const* data, std::size_t size, operation* op)
+    {
+        ::io_uring_sqe sqe = make_sqe(op);
+        sqe.opcode = IORING_OP_SEND;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<std::uint64_t>(data);
+        sqe.len = static_cast<std::uint32_t>(size);
+        sqe.msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+        push_sqe(sqe, op);
+    }
+
+    void ring::prep_recv(int fd, void* data, std::size_t size, operation* op)
+    {
+        ::io_uring_sqe sqe = make_sqe(op);
+        sqe.opcode = IORING_OP_RECV;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<std::uint64_t>(data);
+        sqe.len = static_cast<std::uint32_t>(size);
+        sqe.msg_flags = MSG_WAITALL;
+        push_sqe(sqe, op);
+    }
+
+    void ring::prep_recv_multishot(int fd, operation* op)
+    {
+        ::io_uring_sqe sqe = make_sqe(op);
+        sqe.opcode = IORING_OP_RECV;
+        sqe.fd = fd;
+        sqe.ioprio = IORING_RECV_MULTISHOT;
+        sqe.flags = IOSQE_BUFFER_SELECT;
+        sqe.buf_group = 0;
+        push_sqe(sqe, op);
+    }
+
+    void ring::prep_accept_multishot(int fd, operation* op)
+    {
+        ::io_uring_sqe sqe = make_sqe(op);
+        sqe.opcode = IORING_OP_ACCEPT;
+        sqe.fd = fd;
+        sqe.ioprio = IORING_ACCEPT_MULTISHOT;
+        sqe.accept_flags = SOCK_CLOEXEC;
+        push_sqe(sqe, op);
+    }
+
+    void ring::prep_cancel(operation* op)
+    {
+        // the completion of the cancellation request itself is ignored
+        ::io_uring_sqe sqe = make_sqe(nullptr);
+        sqe.opcode = IORING_OP_ASYNC_CANCEL;
+        sqe.fd = -1;
+        sqe.addr = reinterpret_cast<std::uint64_t>(op);
+        push_sqe(sqe, nullptr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool ring::progress()
+    {
+        bool did_work = false;
+
+        // completions which did not fit into the completion queue have to be
+        // flushed explicitly
+        bool const cq_overflow =
+            (load_acquire(sq_flags_) & IORING_SQ_CQ_OVERFLOW) != 0;
+        if (cq_overflow || to_submit_.load(std::memory_order_relaxed) != 0 ||
+            has_backlog_.load(std::memory_order_relaxed))
+        {
+            std::unique_lock<hpx::spinlock> l(sq_mtx_, std::try_to_lock);
+            if (l.owns_lock())
+            {
+                flush_backlog_locked();
+                submit_locked(cq_overflow);
+                did_work = true;
+            }
+        }
+
+        return reap_completions() || did_work;
+    }
+
+    bool ring::reap_completions()
+    {
+        std::unique_lock<hpx::spinlock> l(cq_mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+            return false;
+
+        std::uint32_t head = *cq_head_;
+        std::uint32_t tail = load_acquire(cq_tail_);
+        if (head == tail)
+            return false;
+
+        // operations which need further processing outside of the lock, an
+        // operation is considered to be in flight until its run() function
+        // has been invoked
+        constexpr std::size_t max_deferred = 32;
+        operation* deferred[max_deferred];
+        bool deferred_last[max_deferred];
+        std::size_t num_deferred = 0;
+
+        while (head != tail && num_deferred != max_deferred)
+        {
+            ::io_uring_cqe const& cqe = cqes_[head & cq_mask_];
+            auto* op = reinterpret_cast<operation*>(cqe.user_data);
+            int const res = cqe.res;
+            std::uint32_t const flags = cqe.flags;
+
+            // hand the entry back to the kernel before processing it
+            store_release(cq_head_, ++head);
+
+            if (op != nullptr)
+            {
+                bool const last = is_last_completion(flags);
+                if (operation* next = op->complete(res, flags))
+                {
+                    deferred[num_deferred] = next;
+                    deferred_last[num_deferred] = last;
+                    ++num_deferred;
+                }
+                else if (last)
+                {
+                    --in_flight_;
+                }
+            }
+
+            if (head == tail)
+                tail = load_acquire(cq_tail_);
+        }
+
+        l.unlock();
+
+        for (std::size_t i = 0; i != num_deferred; ++i)
+        {
+            deferred[i]->run();
+            if (deferred_last[i])
+                --in_flight_;
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    char const* ring::buffer(std::uint32_t flags) const noexcept
+    {
+        HPX_ASSERT(has_buffer(flags));
+        std::size_t const bid = flags >> IORING_CQE_BUFFER_SHIFT;
+        return buffers_ + bid * buffer_size_;
+    }
+
+    // Must be called while holding cq_mtx_
+    void ring::recycle_buffer(std::uint32_t flags) noexcept
+    {
+        HPX_ASSERT(has_buffer(flags));
+        auto const bid = static_cast<std::uint16_t>(
+            flags >> IORING_CQE_BUFFER_SHIFT);
+
+        ::io_uring_buf& buf = buffer_ring_entries(
+            buf_ring_)[buf_tail_ & (num_buffers_ - 1)];
+        buf.addr = reinterpret_cast<std::uint64_t>(
+            buffers_ + static_cast<std::size_t>(bid) * buffer_size_);
+        buf.len = buffer_size_;
+        buf.bid = bid;
+
+        store_release(&buf_ring_->tail, ++buf_tail_);
+    }
+}    // namespace hpx::parcelset::policies::io_uring
+
+#endif
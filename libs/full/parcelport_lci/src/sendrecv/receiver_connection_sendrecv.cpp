@@ -375,6 +375,7 @@ namespace hpx::parcelset::policies::lci {
             // decode and handle received data
             HPX_ASSERT(buffer.num_chunks_.first == 0 ||
                 !pp_->allow_zero_copy_receive_optimizations());
+            buffer.set_chunk_data_owner(HPX_MOVE(chunk_buffers_));
             handle_received_parcels(decode_parcels(*pp_, HPX_MOVE(buffer)));
             chunk_buffers_.clear();
         }
@@ -409,6 +409,7 @@ namespace hpx::parcelset::policies::mpi {
                 // decode and handle received data
                 HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
                     !pp_.allow_zero_copy_receive_optimizations());
+                buffer_.set_chunk_data_owner(HPX_MOVE(chunk_buffers_));
                 handle_received_parcels(
                     decode_parcels(pp_, HPX_MOVE(buffer_), num_thread),
                     num_thread);
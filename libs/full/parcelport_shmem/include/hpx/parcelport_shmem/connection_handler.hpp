@@ -0,0 +1,147 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+
+        class HPX_EXPORT connection_handler;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::connection_handler>
+    {
+        using connection_type = policies::shmem::sender;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        parcelset::locality parcelport_address(
+            util::runtime_configuration const& ini);
+
+        // This parcelport connects localities running on the same node. Each
+        // locality owns a shared memory segment holding a number of
+        // single-producer/single-consumer channels, one for each locality
+        // sending data to it. The channels are polled from the background
+        // work of the scheduler. This parcelport can't be used for
+        // bootstrapping, it is used only for destinations on the same node,
+        // all other destinations are handled by the parcelports with lower
+        // priority.
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            using base_type = parcelport_impl<connection_handler>;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier);
+
+            ~connection_handler();
+
+            // Start the handling of connections.
+            bool do_run();
+
+            // Stop the handling of connections.
+            void do_stop();
+
+            // Return the name of this locality
+            std::string get_locality_name() const override;
+
+            std::shared_ptr<sender> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            // Only localities on the same node can be connected to.
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport) override;
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const override;
+
+            parcelset::locality create_locality() const override;
+
+            // Read from all channels of this locality and continue writing to
+            // the channels of other localities.
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode);
+
+        private:
+            // Return the channel to the given locality, attaching to its
+            // segment if needed. Returns nullptr if the locality can't be
+            // reached.
+            std::shared_ptr<channel> get_channel(parcelset::locality const& l);
+
+            void io_service_work();
+
+            std::uint32_t num_channels_;
+            std::uint64_t channel_size_;
+            std::size_t background_threads_;
+
+            std::atomic<bool> running_;
+
+            // The segment receiving data from other localities
+            segment segment_;
+            std::vector<std::unique_ptr<receiver>> receivers_;
+
+            // The channels to other localities, an empty entry marks a
+            // locality which can't be reached
+            hpx::spinlock channels_mtx_;
+            std::map<locality, std::shared_ptr<channel>> channels_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,96 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A locality is identified by the host it runs on and by the name of the
+    // shared memory segment it receives its data through (which is derived
+    // from the process id and a random token).
+    class locality
+    {
+    public:
+        locality() noexcept
+          : pid_(0)
+          , token_(0)
+        {
+        }
+
+        locality(std::string const& host, std::uint32_t pid,
+            std::uint64_t token)
+          : host_(host)
+          , pid_(pid)
+          , token_(token)
+        {
+        }
+
+        std::string const& host() const noexcept
+        {
+            return host_;
+        }
+
+        std::uint32_t pid() const noexcept
+        {
+            return pid_;
+        }
+
+        std::uint64_t token() const noexcept
+        {
+            return token_;
+        }
+
+        // Return the name of the shared memory segment of this locality
+        HPX_EXPORT std::string segment_name() const;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        explicit constexpr operator bool() const noexcept
+        {
+            return pid_ != 0;
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.pid_ == rhs.pid_ && lhs.token_ == rhs.token_ &&
+                lhs.host_ == rhs.host_;
+        }
+
+        friend bool operator<(locality const& lhs, locality const& rhs) noexcept
+        {
+            if (lhs.host_ != rhs.host_)
+                return lhs.host_ < rhs.host_;
+            if (lhs.pid_ != rhs.pid_)
+                return lhs.pid_ < rhs.pid_;
+            return lhs.token_ < rhs.token_;
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::string host_;
+        std::uint32_t pid_;
+        std::uint64_t token_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
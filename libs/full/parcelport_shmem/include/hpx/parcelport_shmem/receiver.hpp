@@ -0,0 +1,72 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class HPX_EXPORT connection_handler;
+
+    // The receiving end of one of the channels of the segment of this
+    // locality. Messages which fit into a single record are de-serialized
+    // directly from the shared memory, larger messages are assembled first.
+    class HPX_EXPORT receiver
+    {
+    public:
+        receiver(ring_buffer rb, std::uint64_t max_inbound_size,
+            connection_handler& parcelport) noexcept;
+
+        receiver(receiver const&) = delete;
+        receiver(receiver&&) = delete;
+        receiver& operator=(receiver const&) = delete;
+        receiver& operator=(receiver&&) = delete;
+
+        ~receiver() = default;
+
+        // Handle all available records, returns whether any work was
+        // performed.
+        bool receive();
+
+    private:
+        bool handle_record(record_header const* hdr);
+        void handle_message(char const* data, std::size_t size);
+
+        ring_buffer ring_buffer_;
+        std::uint64_t max_inbound_size_;
+        connection_handler& parcelport_;
+
+        hpx::spinlock mtx_;
+
+        // the larger message which is currently being assembled
+        std::vector<char> message_;
+        std::size_t received_;
+
+        // the number of bytes still to be dropped of a rejected message
+        std::size_t skipped_;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
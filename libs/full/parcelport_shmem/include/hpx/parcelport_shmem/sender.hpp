@@ -0,0 +1,409 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The header of each message written to a channel. It is followed by the
+    // transmission chunks, the non-zero-copy data, and the zero-copy chunks,
+    // each of which starts at an offset aligned to the record alignment.
+    struct message_header
+    {
+        std::uint64_t size;         // size of the non-zero-copy data
+        std::uint64_t data_size;    // overall size of the serialized data
+        std::uint32_t num_zero_copy_chunks;
+        std::uint32_t num_non_zero_copy_chunks;
+        std::uint64_t reserved;
+    };
+
+    static_assert(sizeof(message_header) % record_alignment == 0);
+
+    class sender;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The sending end of the channel to another locality, shared by all
+    // connections to that locality. Messages are written one after the
+    // other in the order they were queued.
+    class channel
+    {
+    public:
+        channel(segment&& s, ring_buffer rb) noexcept
+          : segment_(HPX_MOVE(s))
+          , ring_buffer_(rb)
+        {
+        }
+
+        channel(channel const&) = delete;
+        channel(channel&&) = delete;
+        channel& operator=(channel const&) = delete;
+        channel& operator=(channel&&) = delete;
+
+        ~channel() = default;
+
+        // Queue the message of the given connection and start writing it.
+        void enqueue(std::shared_ptr<sender> s);
+
+        // Continue writing the queued messages, the connections whose message
+        // has been written completely are handed back. Returns whether any
+        // progress was made.
+        bool progress(std::vector<std::shared_ptr<sender>>& completed);
+
+    private:
+        bool write_locked();
+
+        segment segment_;
+        ring_buffer ring_buffer_;
+
+        hpx::spinlock mtx_;
+        std::deque<std::shared_ptr<sender>> queue_;
+        std::vector<std::shared_ptr<sender>> completed_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    class sender : public parcelset::parcelport_connection<sender>
+    {
+        using postprocess_handler_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+
+    public:
+        sender(std::shared_ptr<channel> ch,
+            parcelset::locality const& locality_id,
+            [[maybe_unused]] parcelset::parcelport* pp) noexcept
+          : channel_(HPX_MOVE(ch))
+          , there_(locality_id)
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+          , pp_(pp)
+#endif
+          , header_{}
+          , total_size_(0)
+          , offset_(0)
+          , piece_(0)
+          , piece_offset_(0)
+        {
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const& parcel_locality_id) const
+        {
+            HPX_ASSERT(parcel_locality_id == there_);
+            HPX_UNUSED(parcel_locality_id);
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+            HPX_ASSERT(!buffer_.data_.empty());
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+
+            handler_ = HPX_FORWARD(Handler, handler);
+            postprocess_handler_ =
+                HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+            HPX_ASSERT(handler_);
+            HPX_ASSERT(postprocess_handler_);
+
+            /// Increment sends and begin timer.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            header_.size = buffer_.size_;
+            header_.data_size = buffer_.data_size_;
+            header_.num_zero_copy_chunks = buffer_.num_chunks_.first;
+            header_.num_non_zero_copy_chunks = buffer_.num_chunks_.second;
+
+            // add_piece accumulates the size of the message in offset_, start
+            // from scratch as this connection might have been used before
+            pieces_.clear();
+            offset_ = 0;
+            total_size_ = 0;
+            add_piece(&header_, sizeof(header_));
+
+            std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            if (!chunks.empty())
+            {
+                add_piece(chunks.data(),
+                    chunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type));
+            }
+
+            // add main buffer holding data which was serialized normally
+            add_piece(buffer_.data_.data(), buffer_.data_.size());
+
+            // now add chunks themselves, those hold zero-copy serialized
+            // chunks, the receiver will de-serialize directly from the
+            // shared memory. The chunks refer to memory owned by the objects
+            // being sent, which is private to this process, so they can't be
+            // handed to the receiver by reference and are copied into the
+            // channel instead (this is the only copy on the sending side).
+            if (!chunks.empty())
+            {
+                for (serialization::serialization_chunk& c : buffer_.chunks_)
+                {
+                    if (c.type_ ==
+                            serialization::chunk_type::chunk_type_pointer ||
+                        c.type_ ==
+                            serialization::chunk_type::chunk_type_const_pointer)
+                    {
+                        add_piece(c.data_.cpos_, c.size_);
+                    }
+                }
+            }
+
+            offset_ = 0;
+            piece_ = 0;
+            piece_offset_ = 0;
+
+            channel_->enqueue(shared_from_this());
+        }
+
+        // Write (the next part of) the message to the given ring buffer,
+        // returns whether the message has been written completely.
+        bool write(ring_buffer& rb)
+        {
+            if (offset_ == 0 && total_size_ <= rb.max_record_size())
+            {
+                // the message fits into a single record, the receiver will
+                // handle it in place
+                char* data = rb.reserve(total_size_);
+                if (data == nullptr)
+                    return false;
+
+                copy(data, total_size_);
+                rb.commit(record_header::message);
+                return true;
+            }
+
+            // larger messages are split into several records
+            std::size_t const max_size =
+                (rb.max_record_size() / 4) & ~(record_alignment - 1);
+
+            if (offset_ == 0)
+            {
+                char* data = rb.reserve(max_size);
+                if (data == nullptr)
+                    return false;
+
+                // the first record holds the overall size of the message
+                std::uint64_t const total_size = total_size_;
+                std::memcpy(data, &total_size, sizeof(total_size));
+                copy(data + sizeof(total_size), max_size - sizeof(total_size));
+                rb.commit(record_header::message_begin);
+            }
+
+            while (offset_ != total_size_)
+            {
+                std::size_t const size =
+                    (std::min) (total_size_ - offset_, max_size);
+                char* data = rb.reserve(size);
+                if (data == nullptr)
+                    return false;
+
+                copy(data, size);
+                rb.commit(record_header::message_data);
+            }
+            return true;
+        }
+
+        // Invoked once the message has been written completely.
+        void done()
+        {
+            // complete data point and push back onto gatherer
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+#endif
+            std::error_code const ec;
+
+            // the data has been copied, call initial handler
+            handler_(ec);
+
+            postprocess_handler_type handler;
+            std::swap(handler, handler_);
+
+            if (threads::threadmanager_is(hpx::state::running))
+            {
+                // the handler needs to be reset on an HPX thread (it destroys
+                // the parcel, which in turn might invoke HPX functions)
+                threads::thread_init_data data(
+                    threads::make_thread_function_nullary(util::deferred_call(
+                        &sender::reset_handler, HPX_MOVE(handler))),
+                    "sender::reset_handler");
+                threads::register_thread(data);
+            }
+            else
+            {
+                reset_handler(HPX_MOVE(handler));
+            }
+
+            buffer_.clear();
+            pieces_.clear();
+
+            // Call post-processing handler, which will send remaining pending
+            // parcels. Pass along the connection so it can be reused if more
+            // parcels have to be sent.
+            hpx::move_only_function<void(std::error_code const&,
+                parcelset::locality const&, std::shared_ptr<sender>)>
+                postprocess_handler;
+            std::swap(postprocess_handler, postprocess_handler_);
+            postprocess_handler(ec, there_, shared_from_this());
+        }
+
+    private:
+        static void reset_handler(postprocess_handler_type handler)
+        {
+            handler.reset();
+        }
+
+        void add_piece(void const* data, std::size_t size)
+        {
+            pieces_.emplace_back(static_cast<char const*>(data), size);
+            total_size_ = offset_ + align_record(size);
+            offset_ = total_size_;
+        }
+
+        // Copy the next bytes of the message to the given location. Each
+        // piece of the message is padded to the record alignment.
+        void copy(char* dest, std::size_t size) noexcept
+        {
+            while (size != 0)
+            {
+                HPX_ASSERT(piece_ != pieces_.size());
+
+                auto const& [data, piece_size] = pieces_[piece_];
+                std::size_t const padded_size = align_record(piece_size);
+                std::size_t const bytes =
+                    (std::min) (size, padded_size - piece_offset_);
+
+                if (piece_offset_ < piece_size)
+                {
+                    std::memcpy(dest, data + piece_offset_,
+                        (std::min) (bytes, piece_size - piece_offset_));
+                }
+
+                dest += bytes;
+                size -= bytes;
+                offset_ += bytes;
+                piece_offset_ += bytes;
+
+                if (piece_offset_ == padded_size)
+                {
+                    ++piece_;
+                    piece_offset_ = 0;
+                }
+            }
+        }
+
+        std::shared_ptr<channel> channel_;
+
+        // the other (receiving) end of this connection
+        parcelset::locality there_;
+
+        // Counters and their data containers.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+        parcelset::parcelport* pp_;
+#endif
+
+        // the message currently being written
+        message_header header_;
+        std::vector<std::pair<char const*, std::size_t>> pieces_;
+        std::size_t total_size_;
+        std::size_t offset_;
+        std::size_t piece_;
+        std::size_t piece_offset_;
+
+        postprocess_handler_type handler_;
+        hpx::move_only_function<void(std::error_code const&,
+            parcelset::locality const&, std::shared_ptr<sender>)>
+            postprocess_handler_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline void channel::enqueue(std::shared_ptr<sender> s)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        queue_.push_back(HPX_MOVE(s));
+
+        // write the message right away if possible, the completion is
+        // reported from the background work
+        write_locked();
+    }
+
+    inline bool channel::progress(
+        std::vector<std::shared_ptr<sender>>& completed)
+    {
+        std::unique_lock<hpx::spinlock> l(mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+            return false;
+
+        bool const has_work = write_locked() || !completed_.empty();
+        if (completed.empty())
+        {
+            std::swap(completed, completed_);
+        }
+        else
+        {
+            std::move(completed_.begin(), completed_.end(),
+                std::back_inserter(completed));
+            completed_.clear();
+        }
+        return has_work;
+    }
+
+    inline bool channel::write_locked()
+    {
+        bool has_work = false;
+        while (!queue_.empty())
+        {
+            if (!queue_.front()->write(ring_buffer_))
+                break;
+
+            completed_.push_back(HPX_MOVE(queue_.front()));
+            queue_.pop_front();
+            has_work = true;
+        }
+        return has_work;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,268 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::shmem {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Control block of a single channel inside of a shared memory segment.
+    // Each channel is a single-producer/single-consumer ring of bytes, the
+    // producer is the locality which has claimed the channel, the consumer is
+    // the locality owning the segment. The data of the channel immediately
+    // follows its control block.
+    struct channel_header
+    {
+        // process id of the producer, zero if the channel is unused
+        std::atomic<std::uint32_t> owner;
+
+        // number of bytes written by the producer
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t> head;
+
+        // number of bytes released by the consumer
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t> tail;
+    };
+
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free &&
+            std::atomic<std::uint64_t>::is_always_lock_free,
+        "the shared memory parcelport relies on address-free atomics");
+
+    // All data is written to a channel as records. Each record starts with
+    // this header and is padded to a multiple of its size.
+    struct record_header
+    {
+        enum kind_type : std::uint32_t
+        {
+            wrap = 0,             // skip to the beginning of the ring
+            message = 1,          // a complete message
+            message_begin = 2,    // the first part of a larger message
+            message_data = 3      // a subsequent part of a larger message
+        };
+
+        std::uint32_t kind;
+        std::uint32_t reserved;
+        std::uint64_t size;    // number of payload bytes
+    };
+
+    inline constexpr std::size_t record_alignment = sizeof(record_header);
+
+    constexpr std::size_t align_record(std::size_t size) noexcept
+    {
+        return (size + record_alignment - 1) & ~(record_alignment - 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A view of one of the channels of a segment, either as producer or as
+    // consumer. A channel view must be used by one thread at a time only.
+    class ring_buffer
+    {
+    public:
+        ring_buffer() noexcept
+          : header_(nullptr)
+          , data_(nullptr)
+          , capacity_(0)
+          , position_(0)
+          , reserved_(0)
+        {
+        }
+
+        ring_buffer(
+            channel_header* header, char* data, std::uint64_t capacity) noexcept
+          : header_(header)
+          , data_(data)
+          , capacity_(capacity)
+          , position_(0)
+          , reserved_(0)
+        {
+            HPX_ASSERT(capacity != 0 && (capacity & (capacity - 1)) == 0);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        // The largest payload of a single record, records of this size can
+        // always be placed contiguously (eventually).
+        std::size_t max_record_size() const noexcept
+        {
+            return static_cast<std::size_t>(capacity_ / 2) -
+                sizeof(record_header);
+        }
+
+        // Producer: reserve contiguous space for a record with the given
+        // payload size, returns nullptr if not enough space is available.
+        // The returned payload has to be published using commit().
+        char* reserve(std::size_t size) noexcept
+        {
+            HPX_ASSERT(size <= max_record_size());
+            HPX_ASSERT(reserved_ == 0);
+
+            std::uint64_t const head =
+                header_->head.load(std::memory_order_relaxed);
+            std::uint64_t const tail =
+                header_->tail.load(std::memory_order_acquire);
+
+            std::uint64_t const needed =
+                align_record(sizeof(record_header) + size);
+            std::uint64_t const offset = head & (capacity_ - 1);
+
+            // skip the rest of the ring if the record doesn't fit
+            std::uint64_t const skip =
+                offset + needed > capacity_ ? capacity_ - offset : 0;
+            if (head + skip + needed - tail > capacity_)
+                return nullptr;
+
+            if (skip != 0)
+            {
+                // the space at the end of the ring is a multiple of the
+                // record alignment, i.e. it can hold at least a header
+                auto* wrap = reinterpret_cast<record_header*>(data_ + offset);
+                wrap->kind = record_header::wrap;
+                wrap->size = 0;
+            }
+
+            position_ = head + skip;
+            reserved_ = needed;
+
+            auto* hdr = reinterpret_cast<record_header*>(
+                data_ + (position_ & (capacity_ - 1)));
+            hdr->size = size;
+            return reinterpret_cast<char*>(hdr + 1);
+        }
+
+        // Producer: publish the record reserved last
+        void commit(record_header::kind_type kind) noexcept
+        {
+            HPX_ASSERT(reserved_ != 0);
+
+            auto* hdr = reinterpret_cast<record_header*>(
+                data_ + (position_ & (capacity_ - 1)));
+            hdr->kind = kind;
+
+            header_->head.store(position_ + reserved_, std::memory_order_release);
+            reserved_ = 0;
+        }
+
+        // Consumer: return the next available record, or nullptr if none is
+        // available. The record stays valid until it is released.
+        record_header const* peek() noexcept
+        {
+            std::uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+            std::uint64_t const head =
+                header_->head.load(std::memory_order_acquire);
+
+            while (tail != head)
+            {
+                std::uint64_t const offset = tail & (capacity_ - 1);
+                auto const* hdr =
+                    reinterpret_cast<record_header const*>(data_ + offset);
+                if (hdr->kind != record_header::wrap)
+                    return hdr;
+
+                // continue at the beginning of the ring
+                tail += capacity_ - offset;
+                header_->tail.store(tail, std::memory_order_release);
+            }
+            return nullptr;
+        }
+
+        // Consumer: hand the space of the given record back to the producer
+        void release(record_header const* hdr) noexcept
+        {
+            std::uint64_t const tail =
+                header_->tail.load(std::memory_order_relaxed);
+            HPX_ASSERT(reinterpret_cast<char const*>(hdr) ==
+                data_ + (tail & (capacity_ - 1)));
+
+            header_->tail.store(
+                tail + align_record(sizeof(record_header) + hdr->size),
+                std::memory_order_release);
+        }
+
+        // Consumer: return whether data is available
+        bool empty() const noexcept
+        {
+            return header_->tail.load(std::memory_order_relaxed) ==
+                header_->head.load(std::memory_order_acquire);
+        }
+
+        static char const* payload(record_header const* hdr) noexcept
+        {
+            return reinterpret_cast<char const*>(hdr + 1);
+        }
+
+    private:
+        channel_header* header_;
+        char* data_;
+        std::uint64_t capacity_;
+
+        // producer state of the record reserved last
+        std::uint64_t position_;
+        std::uint64_t reserved_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A mapping of a shared memory segment holding a number of channels.
+    class HPX_EXPORT segment
+    {
+    public:
+        segment() noexcept;
+
+        segment(segment const&) = delete;
+        segment(segment&& rhs) noexcept;
+        segment& operator=(segment const&) = delete;
+        segment& operator=(segment&& rhs) noexcept;
+
+        ~segment();
+
+        // Create a new segment with the given name, throws on error.
+        static segment create(std::string const& name,
+            std::uint32_t num_channels, std::uint64_t channel_size);
+
+        // Map an existing segment, returns an empty segment on error.
+        static segment open(std::string const& name) noexcept;
+
+        // Remove the name of the segment, existing mappings stay valid.
+        static void unlink(std::string const& name) noexcept;
+
+        explicit operator bool() const noexcept
+        {
+            return base_ != nullptr;
+        }
+
+        std::uint32_t num_channels() const noexcept;
+
+        // Return a view of the channel with the given index
+        ring_buffer channel(std::uint32_t index) const noexcept;
+
+        // Claim an unused channel for the producer with the given process
+        // id, returns an empty view if all channels are in use.
+        ring_buffer claim_channel(std::uint32_t owner) const noexcept;
+
+    private:
+        void reset() noexcept;
+
+        void* base_;
+        std::size_t size_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,286 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <asio/io_context.hpp>
+#include <asio/ip/host_name.hpp>
+#include <asio/post.hpp>
+
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    parcelset::locality parcelport_address(util::runtime_configuration const&)
+    {
+        // the random token distinguishes the segments of processes which
+        // happen to reuse the process id of a previous process
+        std::random_device rd;
+        std::uint64_t const token =
+            (static_cast<std::uint64_t>(rd()) << 32) | rd();
+
+        return parcelset::locality(locality(asio::ip::host_name(),
+            static_cast<std::uint32_t>(::getpid()), token));
+    }
+
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        threads::policies::callback_notifier const& notifier)
+      : base_type(ini, parcelport_address(ini), notifier)
+      , num_channels_(hpx::util::get_entry_as<std::uint32_t>(
+            ini, "hpx.parcel.shmem.channels", 16))
+      , channel_size_(hpx::util::get_entry_as<std::uint64_t>(
+            ini, "hpx.parcel.shmem.channel_size", 1048576))
+      , background_threads_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.background_threads", std::size_t(-1)))
+      , running_(false)
+    {
+        if (here_.type() != std::string("shmem"))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::parcelport::parcelport",
+                "this parcelport was instantiated to represent an unexpected "
+                "locality type: {}",
+                here_.type());
+        }
+    }
+
+    connection_handler::~connection_handler()
+    {
+        HPX_ASSERT(!running_.load(std::memory_order_relaxed));
+    }
+
+    bool connection_handler::do_run()
+    {
+        // the segment is created only if this parcelport is actually used
+        std::string const name = here_.get<locality>().segment_name();
+        segment_ = segment::create(name, num_channels_, channel_size_);
+
+        std::uint64_t const max_inbound_size =
+            static_cast<std::uint64_t>(get_max_inbound_message_size());
+
+        receivers_.reserve(num_channels_);
+        for (std::uint32_t i = 0; i != segment_.num_channels(); ++i)
+        {
+            receivers_.push_back(std::make_unique<receiver>(
+                segment_.channel(i), max_inbound_size, *this));
+        }
+
+        running_.store(true, std::memory_order_release);
+
+        // the channels have to be served while the runtime is starting up as
+        // no background work is performed before that
+        for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+        {
+#if ASIO_VERSION >= 103400
+            asio::post(io_service_pool_.get_io_service(static_cast<int>(i)),
+                hpx::bind(&connection_handler::io_service_work, this));
+#else
+            io_service_pool_.get_io_service(static_cast<int>(i))
+                .post(hpx::bind(&connection_handler::io_service_work, this));
+#endif
+        }
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        running_.store(false, std::memory_order_release);
+
+        // other localities can't attach to this locality anymore, the
+        // existing mappings stay valid until they are released
+        if (segment_)
+        {
+            segment::unlink(here_.get<locality>().segment_name());
+        }
+
+        std::lock_guard<hpx::spinlock> l(channels_mtx_);
+        channels_.clear();
+    }
+
+    std::string connection_handler::get_locality_name() const
+    {
+        return asio::ip::host_name();
+    }
+
+    std::shared_ptr<sender> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        std::shared_ptr<channel> ch = get_channel(l);
+        if (!ch)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::connection_handler::create_connection",
+                "no shared memory channel is available for locality: {}", l);
+            return std::shared_ptr<sender>();
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return std::make_shared<sender>(HPX_MOVE(ch), l, this);
+    }
+
+    bool connection_handler::can_connect(parcelset::locality const& l, bool)
+    {
+        return running_.load(std::memory_order_acquire) &&
+            get_channel(l) != nullptr;
+    }
+
+    std::shared_ptr<channel> connection_handler::get_channel(
+        parcelset::locality const& dest)
+    {
+        locality const& l = dest.get<locality>();
+
+        {
+            std::lock_guard<hpx::spinlock> lk(channels_mtx_);
+            if (auto const it = channels_.find(l); it != channels_.end())
+            {
+                return it->second;
+            }
+        }
+
+        // only localities on the same node can be reached, the destination
+        // has to have a free channel
+        std::shared_ptr<channel> ch;
+        if (l && l.host() == here_.get<locality>().host())
+        {
+            if (segment s = segment::open(l.segment_name()))
+            {
+                if (ring_buffer const rb =
+                        s.claim_channel(static_cast<std::uint32_t>(::getpid())))
+                {
+                    ch = std::make_shared<channel>(HPX_MOVE(s), rb);
+                }
+            }
+        }
+
+        if (!ch)
+        {
+            LPT_(debug).format(
+                "shmem: locality {} can't be reached using shared memory", l);
+        }
+
+        // a failed attempt is remembered as well, the destination will be
+        // served by another parcelport
+        std::lock_guard<hpx::spinlock> lk(channels_mtx_);
+        auto const p = channels_.emplace(l, HPX_MOVE(ch));
+        return p.first->second;
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const&) const
+    {
+        // this parcelport is never used for bootstrapping
+        return parcelset::locality(locality());
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+
+    bool connection_handler::background_work(
+        std::size_t num_thread, parcelport_background_mode mode)
+    {
+        if (!running_.load(std::memory_order_acquire) ||
+            num_thread >= background_threads_)
+        {
+            return false;
+        }
+
+        bool has_work = false;
+        if (mode & parcelport_background_mode::receive)
+        {
+            for (std::unique_ptr<receiver> const& r : receivers_)
+            {
+                has_work = r->receive() || has_work;
+            }
+        }
+
+        if (mode & parcelport_background_mode::send)
+        {
+            std::vector<std::shared_ptr<channel>> channels;
+            {
+                std::unique_lock<hpx::spinlock> l(
+                    channels_mtx_, std::try_to_lock);
+                if (l.owns_lock())
+                {
+                    channels.reserve(channels_.size());
+                    for (auto const& p : channels_)
+                    {
+                        if (p.second)
+                            channels.push_back(p.second);
+                    }
+                }
+            }
+
+            // the completion handlers are invoked without holding any lock as
+            // those might send more parcels
+            std::vector<std::shared_ptr<sender>> completed;
+            for (std::shared_ptr<channel> const& ch : channels)
+            {
+                has_work = ch->progress(completed) || has_work;
+            }
+
+            for (std::shared_ptr<sender> const& s : completed)
+            {
+                s->done();
+            }
+        }
+        return has_work;
+    }
+
+    void connection_handler::io_service_work()
+    {
+        std::size_t k = 0;
+
+        // We only execute work on the IO service while HPX is starting
+        while (hpx::is_starting())
+        {
+            if (background_work(0, parcelport_background_mode::all))
+            {
+                k = 0;
+            }
+            else
+            {
+                ++k;
+                util::detail::yield_k(k,
+                    "hpx::parcelset::policies::shmem::connection_handler::"
+                    "io_service_work");
+            }
+        }
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
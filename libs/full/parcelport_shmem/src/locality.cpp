@@ -0,0 +1,47 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    std::string locality::segment_name() const
+    {
+        return hpx::util::format("/hpx.shmem.{}.{:016x}", pid_, token_);
+    }
+
+    void locality::save(serialization::output_archive& ar) const
+    {
+        ar << host_;
+        ar << pid_;
+        ar << token_;
+    }
+
+    void locality::load(serialization::input_archive& ar)
+    {
+        ar >> host_;
+        ar >> pid_;
+        ar >> token_;
+    }
+
+    std::ostream& operator<<(std::ostream& os, locality const& loc) noexcept
+    {
+        hpx::util::ios_flags_saver ifs(os);
+        os << loc.host_ << ":" << loc.pid_;
+        return os;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,66 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+// Inject additional configuration data into the factory registry for this type.
+// This information ends up in the system wide configuration database under the
+// plugin specific section:
+//
+//      [hpx.parcel.shmem]
+//      ...
+//      priority = 2000
+//      enable = 0
+//      channels = 16
+//      channel_size = 1048576
+//      background_threads = -1
+//
+template <>
+struct hpx::traits::plugin_config_data<
+    hpx::parcelset::policies::shmem::connection_handler>
+{
+    static constexpr char const* priority() noexcept
+    {
+        // this parcelport is preferred for all destinations it can reach
+        return "2000";
+    }
+
+    static constexpr void init(int* /* argc */, char*** /* argv */,
+        util::command_line_handling& /* cfg */) noexcept
+    {
+    }
+
+    // by default no additional initialization using the resource
+    // partitioner is required
+    static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+    static constexpr void destroy() noexcept {}
+
+    static constexpr char const* call() noexcept
+    {
+        // This parcelport is used in addition to the bootstrap parcelport
+        // for destinations on the same node, it has to be enabled explicitly.
+        return "enable = ${HPX_PARCEL_SHMEM_ENABLE:0}\n"
+               // number of localities which can send data to this locality
+               "channels = ${HPX_PARCEL_SHMEM_CHANNELS:16}\n"
+               // size of each channel in bytes (power of two)
+               "channel_size = ${HPX_PARCEL_SHMEM_CHANNEL_SIZE:1048576}\n"
+               // number of cores polling the channels, -1: all
+               "background_threads = "
+               "${HPX_PARCEL_SHMEM_BACKGROUND_THREADS:-1}\n";
+    }
+};    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::connection_handler, shmem)
+
+#endif
@@ -0,0 +1,229 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/serialization.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    receiver::receiver(ring_buffer rb, std::uint64_t max_inbound_size,
+        connection_handler& parcelport) noexcept
+      : ring_buffer_(rb)
+      , max_inbound_size_(max_inbound_size)
+      , parcelport_(parcelport)
+      , received_(0)
+      , skipped_(0)
+    {
+    }
+
+    bool receiver::receive()
+    {
+        if (ring_buffer_.empty())
+            return false;
+
+        std::unique_lock<hpx::spinlock> l(mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+            return false;
+
+        // limit the number of records handled at once to allow for other
+        // channels to be served as well
+        bool has_work = false;
+        for (int i = 0; i != 16; ++i)
+        {
+            record_header const* hdr = ring_buffer_.peek();
+            if (hdr == nullptr)
+                break;
+
+            has_work = true;
+            if (!handle_record(hdr))
+                break;
+        }
+        return has_work;
+    }
+
+    bool receiver::handle_record(record_header const* hdr)
+    {
+        char const* data = ring_buffer::payload(hdr);
+        auto const size = static_cast<std::size_t>(hdr->size);
+
+        switch (hdr->kind)
+        {
+        case record_header::message:
+            // the message will be de-serialized directly from the shared
+            // memory, the record is released only afterwards
+            HPX_ASSERT(message_.empty());
+            handle_message(data, size);
+            ring_buffer_.release(hdr);
+            return true;
+
+        case record_header::message_begin:
+        {
+            HPX_ASSERT(message_.empty() && size >= sizeof(std::uint64_t));
+
+            std::uint64_t total_size = 0;
+            std::memcpy(&total_size, data, sizeof(total_size));
+
+            std::size_t const received = size - sizeof(total_size);
+            HPX_ASSERT(received <= total_size);
+
+            // the size was given by the sender, check it against the given
+            // limit (if any) before allocating memory for the message
+            if (max_inbound_size_ != 0 && total_size > max_inbound_size_)
+            {
+                LPT_(error).format("shmem receiver: message of {} bytes "
+                                   "exceeds the maximum inbound message size",
+                    total_size);
+
+                // skip the remaining records of this message
+                skipped_ =
+                    static_cast<std::size_t>(total_size) - received;
+                ring_buffer_.release(hdr);
+                return true;
+            }
+
+            message_.resize(static_cast<std::size_t>(total_size));
+            received_ = received;
+            std::memcpy(message_.data(), data + sizeof(total_size), received_);
+            ring_buffer_.release(hdr);
+            return true;
+        }
+
+        case record_header::message_data:
+            if (skipped_ != 0)
+            {
+                HPX_ASSERT(size <= skipped_);
+                skipped_ -= (std::min) (size, skipped_);
+                ring_buffer_.release(hdr);
+                return true;
+            }
+
+            HPX_ASSERT(received_ + size <= message_.size());
+
+            std::memcpy(message_.data() + received_, data, size);
+            received_ += size;
+            ring_buffer_.release(hdr);
+
+            if (received_ == message_.size())
+            {
+                std::vector<char> message = HPX_MOVE(message_);
+                message_.clear();
+                received_ = 0;
+
+                handle_message(message.data(), message.size());
+            }
+            return true;
+
+        default:
+            break;
+        }
+
+        LPT_(error).format(
+            "shmem receiver: unexpected record type: {}", hdr->kind);
+        return false;
+    }
+
+    void receiver::handle_message(char const* data, std::size_t size)
+    {
+        using parcel_buffer_type = parcelset::parcel_buffer<>;
+        using transmission_chunk_type =
+            parcel_buffer_type::transmission_chunk_type;
+
+        parcel_buffer_type buffer;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        buffer.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+
+        message_header hdr{};
+        HPX_ASSERT(size >= sizeof(hdr));
+        std::memcpy(&hdr, data, sizeof(hdr));
+
+        // check for the message exceeding the given limit (only if given)
+        if (max_inbound_size_ != 0 && hdr.size > max_inbound_size_)
+        {
+            LPT_(error).format("shmem receiver: message of {} bytes exceeds "
+                               "the maximum inbound message size",
+                hdr.size);
+            return;
+        }
+
+        buffer.size_ = hdr.size;
+        buffer.data_size_ = hdr.data_size;
+        buffer.num_chunks_ = parcel_buffer_type::count_chunks_type(
+            hdr.num_zero_copy_chunks, hdr.num_non_zero_copy_chunks);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        buffer.data_point_.bytes_ = static_cast<std::size_t>(hdr.size);
+#endif
+        std::size_t offset = sizeof(hdr);
+
+        auto const num_zero_copy_chunks =
+            static_cast<std::size_t>(hdr.num_zero_copy_chunks);
+        if (num_zero_copy_chunks != 0)
+        {
+            std::size_t const num_chunks =
+                num_zero_copy_chunks + hdr.num_non_zero_copy_chunks;
+            std::size_t const chunks_size =
+                num_chunks * sizeof(transmission_chunk_type);
+
+            HPX_ASSERT(offset + chunks_size <= size);
+            buffer.transmission_chunks_.resize(num_chunks);
+            std::memcpy(buffer.transmission_chunks_.data(), data + offset,
+                chunks_size);
+            offset += align_record(chunks_size);
+        }
+
+        // the non-zero-copy data has to be copied into the parcel buffer
+        auto const data_size = static_cast<std::size_t>(hdr.size);
+        HPX_ASSERT(offset + data_size <= size);
+        buffer.data_.assign(data + offset, data + offset + data_size);
+        offset += align_record(data_size);
+
+        // the zero-copy chunks refer to the message itself
+        buffer.chunks_.resize(num_zero_copy_chunks);
+        for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+        {
+            auto const chunk_size = static_cast<std::size_t>(
+                buffer.transmission_chunks_[i].second);
+
+            HPX_ASSERT(offset + chunk_size <= size);
+            buffer.chunks_[i] =
+                serialization::create_pointer_chunk(data + offset, chunk_size);
+            offset += align_record(chunk_size);
+        }
+        HPX_ASSERT(offset == size);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        buffer.data_point_.time_ =
+            timer_.elapsed_nanoseconds() - buffer.data_point_.time_;
+#endif
+
+        // decode and handle received data, all data is copied from the
+        // message while the parcels are being de-serialized
+        handle_received_parcels(decode_parcels(parcelport_, HPX_MOVE(buffer)));
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
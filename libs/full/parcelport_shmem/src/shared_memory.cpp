@@ -0,0 +1,253 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        // 'HPXSHM' followed by the version of the layout
+        constexpr std::uint64_t segment_magic = 0x4850'5853'484d'0001;
+
+        struct segment_header
+        {
+            std::atomic<std::uint64_t> magic;
+            std::uint32_t num_channels;
+            std::uint32_t reserved;
+            std::uint64_t channel_size;
+            std::uint64_t channel_stride;
+        };
+
+        constexpr std::size_t segment_header_size =
+            (sizeof(segment_header) + threads::get_cache_line_size() - 1) &
+            ~(threads::get_cache_line_size() - 1);
+
+        constexpr std::size_t channel_header_size = sizeof(channel_header);
+
+        segment_header* get_header(void* base) noexcept
+        {
+            return static_cast<segment_header*>(base);
+        }
+
+        channel_header* get_channel(void* base, std::uint32_t index) noexcept
+        {
+            segment_header const* hdr = get_header(base);
+            return reinterpret_cast<channel_header*>(static_cast<char*>(base) +
+                segment_header_size + index * hdr->channel_stride);
+        }
+
+        [[noreturn]] void throw_system_error(char const* what, int err)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::segment::create", "{}: {}", what,
+                std::error_code(err, std::system_category()).message());
+        }
+    }    // namespace
+
+    segment::segment() noexcept
+      : base_(nullptr)
+      , size_(0)
+    {
+    }
+
+    segment::segment(segment&& rhs) noexcept
+      : base_(std::exchange(rhs.base_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+    {
+    }
+
+    segment& segment::operator=(segment&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+            base_ = std::exchange(rhs.base_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    segment::~segment()
+    {
+        reset();
+    }
+
+    void segment::reset() noexcept
+    {
+        if (base_ != nullptr)
+        {
+            ::munmap(base_, size_);
+            base_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    segment segment::create(std::string const& name,
+        std::uint32_t num_channels, std::uint64_t channel_size)
+    {
+        if (num_channels == 0 || channel_size < 4096 ||
+            (channel_size & (channel_size - 1)) != 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "shmem::segment::create",
+                "invalid shared memory configuration: {} channels of {} bytes "
+                "(the channel size has to be a power of two of at least 4096)",
+                num_channels, channel_size);
+        }
+
+        std::uint64_t const stride = channel_header_size + channel_size;
+        std::size_t const size = segment_header_size + num_channels * stride;
+
+        // remove stale segments left behind by a previous process with the
+        // same name
+        ::shm_unlink(name.c_str());
+
+        int const fd =
+            ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd < 0)
+            throw_system_error("shm_open", errno);
+
+        // make sure the memory is available, otherwise accessing it would
+        // raise SIGBUS
+        if (int const err = ::posix_fallocate(fd, 0, static_cast<off_t>(size));
+            err != 0)
+        {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            throw_system_error("posix_fallocate", err);
+        }
+
+        void* base =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (base == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+            throw_system_error("mmap", err);
+        }
+
+        segment_header* hdr = new (base) segment_header;
+        hdr->num_channels = num_channels;
+        hdr->reserved = 0;
+        hdr->channel_size = channel_size;
+        hdr->channel_stride = stride;
+
+        for (std::uint32_t i = 0; i != num_channels; ++i)
+        {
+            channel_header* ch = new (get_channel(base, i)) channel_header;
+            ch->owner.store(0, std::memory_order_relaxed);
+            ch->head.store(0, std::memory_order_relaxed);
+            ch->tail.store(0, std::memory_order_relaxed);
+        }
+
+        hdr->magic.store(segment_magic, std::memory_order_release);
+
+        segment s;
+        s.base_ = base;
+        s.size_ = size;
+        return s;
+    }
+
+    segment segment::open(std::string const& name) noexcept
+    {
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0)
+            return {};
+
+        struct stat st = {};
+        if (::fstat(fd, &st) != 0 ||
+            static_cast<std::size_t>(st.st_size) < segment_header_size)
+        {
+            ::close(fd);
+            return {};
+        }
+
+        auto const size = static_cast<std::size_t>(st.st_size);
+        void* base =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (base == MAP_FAILED)
+            return {};
+
+        segment s;
+        s.base_ = base;
+        s.size_ = size;
+
+        // verify the layout of the segment
+        segment_header const* hdr = get_header(base);
+        if (hdr->magic.load(std::memory_order_acquire) != segment_magic ||
+            segment_header_size +
+                    hdr->num_channels * hdr->channel_stride >
+                size)
+        {
+            return {};
+        }
+        return s;
+    }
+
+    void segment::unlink(std::string const& name) noexcept
+    {
+        ::shm_unlink(name.c_str());
+    }
+
+    std::uint32_t segment::num_channels() const noexcept
+    {
+        HPX_ASSERT(base_ != nullptr);
+        return get_header(base_)->num_channels;
+    }
+
+    ring_buffer segment::channel(std::uint32_t index) const noexcept
+    {
+        HPX_ASSERT(base_ != nullptr && index < num_channels());
+
+        channel_header* ch = get_channel(base_, index);
+        return {ch, reinterpret_cast<char*>(ch) + channel_header_size,
+            get_header(base_)->channel_size};
+    }
+
+    ring_buffer segment::claim_channel(std::uint32_t owner) const noexcept
+    {
+        HPX_ASSERT(base_ != nullptr && owner != 0);
+
+        for (std::uint32_t i = 0; i != num_channels(); ++i)
+        {
+            std::uint32_t expected = 0;
+            if (get_channel(base_, i)->owner.compare_exchange_strong(
+                    expected, owner, std::memory_order_acq_rel))
+            {
+                return channel(i);
+            }
+        }
+        return {};
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,146 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Send several batches of parcels of different sizes to each of the remote
+// localities. The parcels are sent one batch after the other, which makes the
+// parcelport reuse its connections for messages of different sizes: small
+// messages fitting into a single record of a channel as well as messages
+// carrying zero-copy chunks which have to be split over several records.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t numparcels_default = 10;
+constexpr std::size_t numrounds_default = 5;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action, typename T>
+hpx::parcelset::parcel generate_parcel(
+    hpx::id_type const& dest_id, hpx::id_type const& cont, T&& data)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<double>(cont), Action(),
+        hpx::launch::async, std::forward<T>(data)));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double checksum(std::vector<double> const& data)
+{
+    // all values are small integers, the sum is exact
+    double sum = 0.0;
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        sum += static_cast<double>(i % 7 + 1) * data[i];
+    }
+    return sum;
+}
+HPX_PLAIN_ACTION(checksum)
+
+std::vector<double> generate_data(std::size_t size, std::size_t seed)
+{
+    std::vector<double> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = static_cast<double>((i + seed) % 1024);
+    }
+    return data;
+}
+
+void test_put_parcels(hpx::id_type const& id, std::size_t size)
+{
+    std::vector<std::vector<double>> data;
+    data.reserve(numparcels_default);
+
+    std::vector<hpx::future<double>> results;
+    results.reserve(numparcels_default);
+
+    // create parcels
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        data.push_back(generate_data(size, i));
+
+        hpx::distributed::promise<double> p;
+        auto f = p.get_future();
+        parcels.push_back(
+            generate_parcel<checksum_action>(id, p.get_id(), data.back()));
+        results.push_back(std::move(f));
+    }
+
+    // send parcels
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    // verify all messages arrived intact
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), checksum(data[i]));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // small messages are sent in a single record, larger ones exceed the
+    // size of a record of the (64kB) channels configured below
+    std::vector<std::size_t> const sizes = {16, 8 * 1024, 128 * 1024};
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        for (std::size_t round = 0; round != numrounds_default; ++round)
+        {
+            // alternate the order to have large messages follow small ones
+            // and vice versa
+            for (std::size_t i = 0; i != sizes.size(); ++i)
+            {
+                test_put_parcels(id,
+                    sizes[round % 2 == 0 ? i : sizes.size() - i - 1]);
+            }
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // explicitly disable message handlers (parcel coalescing), use small
+    // channels to force larger messages to be split
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=0",
+        "hpx.parcel.shmem.enable=1",
+        "hpx.parcel.shmem.channel_size=65536",
+    };
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -118,6 +118,9 @@ namespace hpx::parcelset {
             /// Acceptor used to listen for incoming connections.
             asio::ip::tcp::acceptor* acceptor_;
 
+            /// Minimal size of chunks sent using MSG_ZEROCOPY (0: disabled)
+            std::size_t zero_copy_send_threshold_;
+
             /// The list of accepted connections
             mutable hpx::spinlock connections_mtx_;
 
@@ -408,6 +408,7 @@ namespace hpx::parcelset::policies::tcp {
                     // decode and handle received data
                     HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
                         !parcelport_.allow_zero_copy_receive_optimizations());
+                    buffer_.set_chunk_data_owner(HPX_MOVE(chunk_buffers_));
                     handle_received_parcels(
                         decode_parcels(parcelport_, HPX_MOVE(buffer_)));
                 }
@@ -32,9 +32,23 @@
 #include <asio/buffer.hpp>
 #include <asio/io_context.hpp>
 #include <asio/ip/tcp.hpp>
+#include <asio/post.hpp>
 #include <asio/read.hpp>
 #include <asio/write.hpp>
 
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+// MSG_ZEROCOPY is available starting Linux V4.14
+#if defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY) &&                           \
+    defined(SO_EE_ORIGIN_ZEROCOPY)
+#define HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND
+#endif
+#endif
+
 // The asio support includes termios.h.
 // The termios.h file on ppc64le defines these macros, which
 // are also used by blaze, blaze_tensor as Template names.
@@ -42,7 +56,11 @@
 #undef VT1
 #undef VT2
 
+#include <algorithm>
+#include <cerrno>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <system_error>
 #include <utility>
@@ -50,6 +68,29 @@
 
 namespace hpx::parcelset::policies::tcp {
 
+    namespace detail {
+
+        // Non-owning buffer sequence referring to the buffers of a sender,
+        // this avoids copying the vector of buffers into the write operation
+        struct const_buffers_view
+        {
+            using value_type = asio::const_buffer;
+            using const_iterator = asio::const_buffer const*;
+
+            const_iterator begin() const noexcept
+            {
+                return begin_;
+            }
+            const_iterator end() const noexcept
+            {
+                return end_;
+            }
+
+            const_iterator begin_;
+            const_iterator end_;
+        };
+    }    // namespace detail
+
     class sender : public parcelset::parcelport_connection<sender>
     {
         using postprocess_handler_type =
@@ -95,6 +136,20 @@ namespace hpx::parcelset::policies::tcp {
             return there_;
         }
 
+        // Send all buffers larger than the given threshold using MSG_ZEROCOPY
+        // (if supported), has to be called after the socket was connected.
+        void enable_zero_copy_send([[maybe_unused]] std::size_t threshold)
+        {
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+            int const enable = 1;
+            if (::setsockopt(socket_.native_handle(), SOL_SOCKET, SO_ZEROCOPY,
+                    &enable, sizeof(enable)) == 0)
+            {
+                zero_copy_threshold_ = threshold;
+            }
+#endif
+        }
+
         void verify_(parcelset::locality const& parcel_locality_id) const
         {
 #if defined(HPX_DEBUG)
@@ -145,25 +200,27 @@ namespace hpx::parcelset::policies::tcp {
 #endif
             // Write the serialized data to the socket. We use "gather-write"
             // to send both the header and the data in a single write operation.
-            std::vector<asio::const_buffer> buffers;
-            buffers.emplace_back(&buffer_.size_, sizeof(buffer_.size_));
-            buffers.emplace_back(
+            // The vector of buffers is reused for all messages sent through
+            // this connection.
+            buffers_.clear();
+            buffers_.emplace_back(&buffer_.size_, sizeof(buffer_.size_));
+            buffers_.emplace_back(
                 &buffer_.data_size_, sizeof(buffer_.data_size_));
 
             // add chunk description
-            buffers.emplace_back(
+            buffers_.emplace_back(
                 &buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
 
             std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
                 buffer_.transmission_chunks_;
             if (!chunks.empty())
             {
-                buffers.emplace_back(chunks.data(),
+                buffers_.emplace_back(chunks.data(),
                     chunks.size() *
                         sizeof(parcel_buffer_type::transmission_chunk_type));
 
                 // add main buffer holding data which was serialized normally
-                buffers.emplace_back(asio::buffer(buffer_.data_));
+                buffers_.emplace_back(asio::buffer(buffer_.data_));
 
                 // now add chunks themselves, those hold zero-copy serialized chunks
                 for (serialization::serialization_chunk& c : buffer_.chunks_)
@@ -173,15 +230,28 @@ namespace hpx::parcelset::policies::tcp {
                         c.type_ ==
                             serialization::chunk_type::chunk_type_const_pointer)
                     {
-                        buffers.emplace_back(c.data_.cpos_, c.size_);
+                        buffers_.emplace_back(c.data_.cpos_, c.size_);
                     }
                 }
             }
             else
             {
                 // add main buffer holding data which was serialized normally
-                buffers.emplace_back(asio::buffer(buffer_.data_));
+                buffers_.emplace_back(asio::buffer(buffer_.data_));
+            }
+
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+            if (zero_copy_threshold_ != 0 && prepare_zero_copy_send())
+            {
+                // all operations related to a zero-copy send are executed on
+                // the io_context of the socket, which serializes them with the
+                // handlers of the asynchronous operations they initiate
+                void (sender::*f)() = &sender::zero_copy_send;
+                asio::post(
+                    socket_.get_executor(), hpx::bind(f, shared_from_this()));
+                return;
             }
+#endif
 
             // this additional wrapping of the handler into a bind object is
             // needed to keep  this parcelport_connection object alive for the
@@ -189,7 +259,9 @@ namespace hpx::parcelset::policies::tcp {
             void (sender::*f)(std::error_code const&, std::size_t) =
                 &sender::handle_write;
 
-            asio::async_write(socket_, buffers,
+            asio::async_write(socket_,
+                detail::const_buffers_view{
+                    buffers_.data(), buffers_.data() + buffers_.size()},
                 hpx::bind(f, shared_from_this(), hpx::placeholders::_1,
                     hpx::placeholders::_2));
         }
@@ -200,6 +272,240 @@ namespace hpx::parcelset::policies::tcp {
             handler.reset();
         }
 
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+        // Fill the (reused) array of iovecs from the buffers of the current
+        // message, returns whether any of them should be sent using
+        // MSG_ZEROCOPY.
+        bool prepare_zero_copy_send()
+        {
+            iovecs_.clear();
+            zero_copy_iovecs_.clear();
+
+            bool has_zero_copy_iovecs = false;
+            for (asio::const_buffer const& b : buffers_)
+            {
+                if (b.size() == 0)
+                    continue;
+
+                iovec iov{};
+                iov.iov_base = const_cast<void*>(b.data());
+                iov.iov_len = b.size();
+                iovecs_.push_back(iov);
+
+                bool const zero_copy = b.size() >= zero_copy_threshold_;
+                zero_copy_iovecs_.push_back(zero_copy);
+                has_zero_copy_iovecs = has_zero_copy_iovecs || zero_copy;
+            }
+
+            next_iovec_ = 0;
+            bytes_sent_ = 0;
+            return has_zero_copy_iovecs;
+        }
+
+        // Send the remaining iovecs, consecutive iovecs of the same kind are
+        // sent using a single call to sendmsg. Large buffers are sent using
+        // MSG_ZEROCOPY, the kernel pins the memory of those instead of copying
+        // it. The memory (and with it the parcel) has to be kept alive until
+        // the kernel signals completion of the send operation.
+        void zero_copy_send()
+        {
+            // the maximal number of iovecs per call (IOV_MAX on Linux)
+            constexpr std::size_t max_iovecs = 1024;
+
+            int const fd = socket_.native_handle();
+            std::size_t const num_iovecs = iovecs_.size();
+            while (next_iovec_ != num_iovecs)
+            {
+                bool const zero_copy = zero_copy_iovecs_[next_iovec_] != 0;
+
+                std::size_t last = next_iovec_ + 1;
+                while (last != num_iovecs && last - next_iovec_ < max_iovecs &&
+                    (zero_copy_iovecs_[last] != 0) == zero_copy)
+                {
+                    ++last;
+                }
+
+                msghdr msg{};
+                msg.msg_iov = &iovecs_[next_iovec_];
+                msg.msg_iovlen = last - next_iovec_;
+
+                int const flags = zero_copy ?
+                    MSG_DONTWAIT | MSG_NOSIGNAL | MSG_ZEROCOPY :
+                    MSG_DONTWAIT | MSG_NOSIGNAL;
+
+                ssize_t const sent = ::sendmsg(fd, &msg, flags);
+                if (sent < 0)
+                {
+                    int const err = errno;
+                    if (err == EINTR)
+                        continue;
+
+                    if (err == EAGAIN || err == EWOULDBLOCK)
+                    {
+                        // continue once the socket is writable again
+                        void (sender::*f)(std::error_code const&) =
+                            &sender::handle_zero_copy_send_wait;
+                        socket_.async_wait(asio::socket_base::wait_write,
+                            hpx::bind(
+                                f, shared_from_this(), placeholders::_1));
+                        return;
+                    }
+
+                    if (zero_copy && err == ENOBUFS)
+                    {
+                        // the kernel could not pin the memory (the socket
+                        // option memory limit was exceeded), copy instead
+                        std::fill(zero_copy_iovecs_.begin() +
+                                static_cast<std::ptrdiff_t>(next_iovec_),
+                            zero_copy_iovecs_.begin() +
+                                static_cast<std::ptrdiff_t>(last),
+                            0);
+                        continue;
+                    }
+
+                    handle_write(
+                        std::error_code(err, asio::error::get_system_category()),
+                        bytes_sent_);
+                    return;
+                }
+
+                // each successful zero-copy send is identified by the kernel
+                // using consecutive numbers
+                if (zero_copy)
+                    ++zero_copy_sends_;
+
+                consume_iovecs(static_cast<std::size_t>(sent));
+            }
+
+            wait_for_zero_copy_completion();
+        }
+
+        void consume_iovecs(std::size_t bytes) noexcept
+        {
+            bytes_sent_ += bytes;
+            while (bytes != 0)
+            {
+                iovec& iov = iovecs_[next_iovec_];
+                if (bytes < iov.iov_len)
+                {
+                    iov.iov_base = static_cast<char*>(iov.iov_base) + bytes;
+                    iov.iov_len -= bytes;
+                    break;
+                }
+
+                bytes -= iov.iov_len;
+                ++next_iovec_;
+            }
+        }
+
+        void handle_zero_copy_send_wait(std::error_code const& e)
+        {
+            if (e)
+            {
+                handle_write(e, bytes_sent_);
+                return;
+            }
+            zero_copy_send();
+        }
+
+        // Read all completion notifications from the error queue of the
+        // socket
+        void read_zero_copy_completions()
+        {
+            int const fd = socket_.native_handle();
+            while (true)
+            {
+                alignas(cmsghdr) char control[128];
+                msghdr msg{};
+                msg.msg_control = control;
+                msg.msg_controllen = sizeof(control);
+
+                if (::recvmsg(fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    return;    // no more notifications
+                }
+
+                for (cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != nullptr;
+                    cm = CMSG_NXTHDR(&msg, cm))
+                {
+                    if (!(cm->cmsg_level == SOL_IP &&
+                            cm->cmsg_type == IP_RECVERR) &&
+                        !(cm->cmsg_level == SOL_IPV6 &&
+                            cm->cmsg_type == IPV6_RECVERR))
+                    {
+                        continue;
+                    }
+
+                    sock_extended_err err{};
+                    std::memcpy(&err, CMSG_DATA(cm), sizeof(err));
+                    if (err.ee_origin != SO_EE_ORIGIN_ZEROCOPY ||
+                        err.ee_errno != 0)
+                    {
+                        continue;
+                    }
+
+                    // [ee_info, ee_data] is the range of completed sends
+                    zero_copy_completed_ += err.ee_data - err.ee_info + 1;
+
+#if defined(SO_EE_CODE_ZEROCOPY_COPIED)
+                    // the kernel had to copy the data anyways (e.g. for
+                    // loopback connections), pinning the memory is pure
+                    // overhead in this case
+                    if (err.ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+                        zero_copy_threshold_ = 0;
+#endif
+                }
+            }
+        }
+
+        void wait_for_zero_copy_completion()
+        {
+            read_zero_copy_completions();
+            if (zero_copy_completed_ == zero_copy_sends_)
+            {
+                handle_write(std::error_code(), bytes_sent_);
+                return;
+            }
+
+            // wait for the kernel to signal more completions
+            void (sender::*f)(std::error_code const&) =
+                &sender::handle_zero_copy_completion;
+            socket_.async_wait(asio::socket_base::wait_error,
+                hpx::bind(f, shared_from_this(), placeholders::_1));
+
+            // the remaining completions may have been signaled before the
+            // wait operation was started
+            read_zero_copy_completions();
+            if (zero_copy_completed_ == zero_copy_sends_)
+            {
+                // the wait operation is the only one pending on this socket,
+                // its handler will finish the write operation
+                std::error_code ec;
+                // NOLINTNEXTLINE(bugprone-unused-return-value)
+                socket_.cancel(ec);
+            }
+        }
+
+        void handle_zero_copy_completion(std::error_code const& e)
+        {
+            read_zero_copy_completions();
+            if (zero_copy_completed_ == zero_copy_sends_)
+            {
+                handle_write(std::error_code(), bytes_sent_);
+                return;
+            }
+
+            if (e)
+            {
+                handle_write(e, bytes_sent_);
+                return;
+            }
+            wait_for_zero_copy_completion();
+        }
+#endif
+
         /// handle completed write operation
         void handle_write(std::error_code const& e, std::size_t /* bytes */)
         {
@@ -294,6 +600,25 @@ namespace hpx::parcelset::policies::tcp {
         hpx::move_only_function<void(std::error_code const&,
             parcelset::locality const&, std::shared_ptr<sender>)>
             postprocess_handler_;
+
+        // buffers of the message currently being sent
+        std::vector<asio::const_buffer> buffers_;
+
+#if defined(HPX_PARCELPORT_TCP_HAVE_ZERO_COPY_SEND)
+        // minimal size of buffers sent using MSG_ZEROCOPY, 0: disabled
+        std::size_t zero_copy_threshold_ = 0;
+
+        // the iovecs of the message currently being sent and whether each of
+        // them is sent using MSG_ZEROCOPY
+        std::vector<iovec> iovecs_;
+        std::vector<std::uint8_t> zero_copy_iovecs_;
+        std::size_t next_iovec_ = 0;
+        std::size_t bytes_sent_ = 0;
+
+        // number of zero-copy sends issued/completed on this socket
+        std::uint32_t zero_copy_sends_ = 0;
+        std::uint32_t zero_copy_completed_ = 0;
+#endif
     };
 }    // namespace hpx::parcelset::policies::tcp
 
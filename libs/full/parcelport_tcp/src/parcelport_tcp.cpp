@@ -19,6 +19,7 @@
 //      [hpx.parcel.tcp]
 //      ...
 //      priority = 1
+//      zero_copy_send_threshold = 0
 //
 template <>
 struct hpx::traits::plugin_config_data<
@@ -42,7 +43,9 @@ struct hpx::traits::plugin_config_data<
 
     static constexpr char const* call() noexcept
     {
-        return "";
+        // minimal size of chunks sent using MSG_ZEROCOPY, 0: disabled
+        return "zero_copy_send_threshold = "
+               "${HPX_PARCEL_TCP_ZERO_COPY_SEND_THRESHOLD:0}\n";
     }
 };    // namespace hpx::traits
 
@@ -30,7 +30,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <memory>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -426,6 +428,28 @@ namespace hpx::parcelset {
         serialization::input_archive archive(
             buffer.data_, inbound_data_size, &chunks);
 
+        // allow for de-serialized objects to reference the received chunks
+        // in place if the chunk memory can be kept alive
+        using chunk_type = typename decltype(buffer.chunks_)::value_type;
+        if constexpr (!std::is_same_v<chunk_type,
+                          serialization::serialization_chunk>)
+        {
+            // the buffer owns the memory of the received chunks
+            if (buffer.chunk_data_owner_ == nullptr && !buffer.chunks_.empty())
+            {
+                buffer.chunk_data_owner_ =
+                    std::make_shared<std::vector<chunk_type>>(
+                        HPX_MOVE(buffer.chunks_));
+            }
+        }
+
+        if (buffer.chunk_data_owner_ != nullptr)
+        {
+            archive
+                .get_extra_data<serialization::detail::received_data_owner>()
+                .data_ = HPX_MOVE(buffer.chunk_data_owner_);
+        }
+
         return decode_message_with_chunks(
             archive, pp, buffer, parcel_count, num_thread);
     }
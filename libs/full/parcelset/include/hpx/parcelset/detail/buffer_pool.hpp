@@ -0,0 +1,66 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <cstddef>
+#include <vector>
+
+namespace hpx::parcelset::detail {
+
+    // The serialization buffers of parcel messages are recycled through a
+    // per-thread pool. Buffers are grouped into size classes (powers of two),
+    // a buffer taken from the pool has at least the capacity requested and
+    // belongs to the requested or the next larger size class. Buffers larger
+    // than the largest size class are not pooled.
+    struct buffer_pool
+    {
+        static constexpr std::size_t min_size_class = 10;    // 1kB
+        static constexpr std::size_t max_size_class = 20;    // 1MB
+        static constexpr std::size_t num_size_classes =
+            max_size_class - min_size_class + 1;
+
+        // maximal number of buffers cached per size class and thread
+        static constexpr std::size_t max_cached_buffers = 4;
+
+        // Return the size class used for buffers of the given capacity
+        // (rounded up), returns num_size_classes if the buffer is too large
+        // to be pooled.
+        [[nodiscard]] static constexpr std::size_t size_class(
+            std::size_t size) noexcept
+        {
+            std::size_t size_class = min_size_class;
+            while (size_class <= max_size_class &&
+                (std::size_t(1) << size_class) < size)
+            {
+                ++size_class;
+            }
+            return size_class - min_size_class;
+        }
+
+        // Get an empty buffer with a capacity of at least the given size,
+        // 'reused' is set to true if the buffer was taken from the pool.
+        HPX_EXPORT static std::vector<char> allocate(
+            std::size_t size, bool& reused);
+
+        // Give a buffer back to the pool of the current thread. The buffer is
+        // released if the pool is full or if the buffer is too large or too
+        // small.
+        HPX_EXPORT static void deallocate(std::vector<char>&& buffer) noexcept;
+    };
+
+    // The expected size of messages starting with a parcel for the given
+    // action, derived from the sizes of the messages sent before by the
+    // current thread. Returns zero if no message was sent for this action.
+    HPX_EXPORT std::size_t get_message_size_hint(char const* action) noexcept;
+    HPX_EXPORT void update_message_size_hint(
+        char const* action, std::size_t size);
+}    // namespace hpx::parcelset::detail
+
+#endif
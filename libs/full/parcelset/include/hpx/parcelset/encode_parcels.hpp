@@ -23,20 +23,24 @@
 #include <hpx/actions_base/basic_action.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/parcelset/detail/buffer_pool.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
+#include <hpx/serialization/detail/measure_archive.hpp>
 
 #if ASIO_HAS_BOOST_THROW_EXCEPTION != 0
 #include <boost/exception/exception.hpp>
 #endif
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <memory>
 #include <string>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -81,6 +85,40 @@ namespace hpx::parcelset {
         }
 #endif
 
+        // Make sure the (empty) container can hold at least the given number
+        // of bytes, memory is taken from the buffer pool if possible. Returns
+        // false if memory had to be allocated.
+        template <typename Container>
+        bool reserve_buffer(Container& data, std::size_t size)
+        {
+            HPX_ASSERT(data.empty());
+            if (data.capacity() >= size)
+                return true;
+
+            if constexpr (std::is_same_v<Container, std::vector<char>>)
+            {
+                bool reused = false;
+                std::vector<char> buffer = buffer_pool::allocate(size, reused);
+                buffer_pool::deallocate(HPX_MOVE(data));
+                data = HPX_MOVE(buffer);
+                return reused;
+            }
+            else
+            {
+                data.reserve(size);
+                return false;
+            }
+        }
+
+        // Return whether the serialized size of all given parcels can be
+        // measured before the parcels are serialized.
+        inline bool is_trivially_measurable(
+            parcel const* ps, std::size_t num_parcels)
+        {
+            return std::all_of(ps, ps + num_parcels,
+                [](parcel const& p) { return p.is_trivially_measurable(); });
+        }
+
         template <typename Buffer>
         void encode_finalize(Buffer& buffer, std::size_t arg_size)
         {
@@ -196,13 +234,57 @@ namespace hpx::parcelset {
                     num_chunks += ps[parcels_sent].num_chunks();
                 }
 
-                buffer.data_.reserve(arg_size);
-                buffer.chunks_.reserve(num_chunks);
-
                 // mark start of serialization
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 hpx::chrono::high_resolution_timer const timer;
 #endif
+
+                // If the size of all parcels can be measured, a first pass
+                // computes the exact size of the message. The parcels are then
+                // serialized into a buffer that is resized only once.
+                std::size_t message_size = 0;
+                if (!filter &&
+                    detail::is_trivially_measurable(ps, parcels_sent))
+                {
+                    auto const measured =
+                        serialization::detail::measure_archive(
+                            [&](serialization::output_archive& archive) {
+                                if (num_parcels != static_cast<std::size_t>(-1))
+                                    archive << parcels_sent;    //-V128
+
+                                for (std::size_t i = 0; i != parcels_sent; ++i)
+                                    archive << ps[i];
+                            },
+                            archive_flags, true,
+                            pp.get_zero_copy_serialization_threshold());
+
+                    message_size = measured.size;
+                    num_chunks = measured.num_chunks;
+                }
+
+                // otherwise, pre-size the buffer based on the size of earlier
+                // messages starting with the same action
+                char const* const action_name = ps[0].get_action_name();
+                std::size_t const buffer_size = message_size != 0 ?
+                    message_size :
+                    (std::max) (
+                        arg_size, detail::get_message_size_hint(action_name));
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                hpx::chrono::high_resolution_timer const allocate_timer;
+#endif
+                [[maybe_unused]] bool const reused =
+                    detail::reserve_buffer(buffer.data_, buffer_size);
+                buffer.data_.resize(message_size);
+                [[maybe_unused]] std::size_t const capacity =
+                    buffer.data_.capacity();
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                buffer.data_point_.buffer_allocate_time_ =
+                    allocate_timer.elapsed_nanoseconds();
+#endif
+
+                buffer.chunks_.reserve(num_chunks);
+
                 {
                     // Serialize the data
                     if (filter)
@@ -252,10 +334,27 @@ namespace hpx::parcelset {
                     arg_size = archive.bytes_written();
                 }
 
-                // store the time required for serialization
+                HPX_ASSERT(message_size == 0 ||
+                    (buffer.data_.size() == message_size &&
+                        arg_size == message_size));
+
+                detail::update_message_size_hint(
+                    action_name, buffer.data_.size());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                // the buffer was reallocated if it was too small
+                if (reused && buffer.data_.capacity() == capacity)
+                    ++buffer.data_point_.num_buffer_pool_hits_;
+                else
+                    ++buffer.data_point_.num_buffer_pool_misses_;
+#endif
+
+                // store the time required for serialization (including the
+                // measuring pass)
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 buffer.data_point_.serialization_time_ =
-                    timer.elapsed_nanoseconds();
+                    timer.elapsed_nanoseconds() -
+                    buffer.data_point_.buffer_allocate_time_;
 #endif
             }
             catch (hpx::exception const& e)
@@ -117,6 +117,7 @@ namespace hpx::parcelset::detail {
 #endif
 
         bool does_termination_detection() const override;
+        bool is_trivially_measurable() const override;
 
         split_gids_type move_split_gids() const override;
         void set_split_gids(split_gids_type&& split_gids) override;
@@ -12,9 +12,12 @@
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/modules/serialization.hpp>
 
+#include <hpx/parcelset/detail/buffer_pool.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 
 #include <cstdint>
+#include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -59,13 +62,39 @@ namespace hpx::parcelset {
         }
 
         parcel_buffer(parcel_buffer&& other) = default;
-        parcel_buffer& operator=(parcel_buffer&& other) = default;
+
+        parcel_buffer& operator=(parcel_buffer&& other)
+        {
+            if (this != &other)
+            {
+                recycle();
+
+                data_ = HPX_MOVE(other.data_);
+                chunks_ = HPX_MOVE(other.chunks_);
+                transmission_chunks_ = HPX_MOVE(other.transmission_chunks_);
+                chunk_data_owner_ = HPX_MOVE(other.chunk_data_owner_);
+                num_chunks_ = other.num_chunks_;
+                size_ = other.size_;
+                data_size_ = other.data_size_;
+                header_size_ = other.header_size_;
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                data_point_ = other.data_point_;
+#endif
+            }
+            return *this;
+        }
+
+        ~parcel_buffer()
+        {
+            recycle();
+        }
 
         void clear()
         {
             data_.clear();
             chunks_.clear();
             transmission_chunks_.clear();
+            chunk_data_owner_.reset();
             num_chunks_ = count_chunks_type(0, 0);
             size_ = 0;
             data_size_ = 0;
@@ -75,11 +104,39 @@ namespace hpx::parcelset {
 #endif
         }
 
+        // Take over the (non-empty) storage the received zero-copy chunks
+        // refer to, allowing de-serialized objects to reference it in place.
+        template <typename ChunkData>
+        void set_chunk_data_owner(ChunkData&& chunk_data)
+        {
+            if (!chunk_data.empty())
+            {
+                chunk_data_owner_ = std::make_shared<std::decay_t<ChunkData>>(
+                    HPX_FORWARD(ChunkData, chunk_data));
+            }
+        }
+
+    private:
+        // give the memory of the data buffer back to the buffer pool
+        void recycle() noexcept
+        {
+            if constexpr (std::is_same_v<BufferType, std::vector<char>>)
+            {
+                detail::buffer_pool::deallocate(HPX_MOVE(data_));
+            }
+        }
+
+    public:
         BufferType data_;
 
         std::vector<ChunkType> chunks_;
         std::vector<transmission_chunk_type> transmission_chunks_;
 
+        // Keeps the memory alive the received (zero-copy) chunks refer to, if
+        // set. De-serialized objects may share the ownership of this memory
+        // instead of copying the chunk data (see zero_copy_view).
+        std::shared_ptr<void> chunk_data_owner_;
+
         // pair of (zero-copy, non-zero-copy) chunks
         count_chunks_type num_chunks_;
 
@@ -0,0 +1,148 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/parcelset/detail/buffer_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::detail {
+
+    namespace {
+
+        // Buffers may be released while the thread is exiting, after the
+        // cache of the thread has been destroyed.
+        thread_local bool cache_destroyed = false;
+
+        struct buffer_cache
+        {
+            buffer_cache() = default;
+            buffer_cache(buffer_cache const&) = delete;
+            buffer_cache(buffer_cache&&) = delete;
+            buffer_cache& operator=(buffer_cache const&) = delete;
+            buffer_cache& operator=(buffer_cache&&) = delete;
+
+            ~buffer_cache()
+            {
+                cache_destroyed = true;
+            }
+
+            std::array<std::vector<std::vector<char>>,
+                buffer_pool::num_size_classes>
+                buffers;
+        };
+
+        buffer_cache& get_buffer_cache() noexcept
+        {
+            thread_local buffer_cache cache;
+            return cache;
+        }
+    }    // namespace
+
+    std::vector<char> buffer_pool::allocate(std::size_t size, bool& reused)
+    {
+        std::size_t const index = size_class(size);
+        if (index == num_size_classes || cache_destroyed)
+        {
+            reused = false;
+            std::vector<char> buffer;
+            buffer.reserve(size);
+            return buffer;
+        }
+
+        // a buffer of the next larger size class is used as well, if needed
+        auto& cache = get_buffer_cache();
+        std::size_t const last = (std::min) (index + 2, num_size_classes);
+        for (std::size_t i = index; i != last; ++i)
+        {
+            auto& buffers = cache.buffers[i];
+            if (!buffers.empty())
+            {
+                reused = true;
+                std::vector<char> buffer = HPX_MOVE(buffers.back());
+                buffers.pop_back();
+                return buffer;
+            }
+        }
+
+        // allocate the full size of the size class, this allows for the
+        // buffer to be reused for all messages of this class
+        reused = false;
+        std::vector<char> buffer;
+        buffer.reserve(std::size_t(1) << (index + min_size_class));
+        return buffer;
+    }
+
+    void buffer_pool::deallocate(std::vector<char>&& buffer) noexcept
+    {
+        std::size_t const capacity = buffer.capacity();
+        if (capacity < (std::size_t(1) << min_size_class) || cache_destroyed)
+            return;
+
+        std::size_t index = size_class(capacity);
+        if (index == num_size_classes)
+            return;
+
+        // a buffer is stored in the largest size class it can serve
+        if ((std::size_t(1) << (index + min_size_class)) > capacity)
+            --index;
+
+        auto& buffers = get_buffer_cache().buffers[index];
+        if (buffers.size() < max_cached_buffers)
+        {
+            try
+            {
+                buffer.clear();
+                buffers.push_back(HPX_MOVE(buffer));
+            }
+            catch (...)
+            {
+                // the buffer is released if it can't be stored
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        // Action names are static strings, they are identified by address.
+        std::unordered_map<char const*, std::size_t>& get_message_size_hints()
+        {
+            thread_local std::unordered_map<char const*, std::size_t> hints;
+            return hints;
+        }
+    }    // namespace
+
+    std::size_t get_message_size_hint(char const* action) noexcept
+    {
+        if (action == nullptr)
+            return 0;
+
+        auto const& hints = get_message_size_hints();
+        auto const it = hints.find(action);
+        return it != hints.end() ? it->second : 0;
+    }
+
+    void update_message_size_hint(char const* action, std::size_t size)
+    {
+        if (action == nullptr)
+            return;
+
+        // follow increasing message sizes immediately, decrease the hint
+        // slowly to avoid reallocations for varying message sizes
+        auto& hint = get_message_size_hints()[action];
+        hint = (std::max) (size, hint - hint / 8);
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
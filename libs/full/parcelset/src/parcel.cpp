@@ -357,6 +357,14 @@ namespace hpx::parcelset::detail {
         return action_ ? action_->does_termination_detection() : false;
     }
 
+    bool parcel::is_trivially_measurable() const
+    {
+        // continuations refer to their target using an id_type, which can't
+        // be measured without splitting its credit
+        return action_ && !data_.has_continuation_ &&
+            action_->has_trivially_measurable_arguments();
+    }
+
     parcel::split_gids_type parcel::move_split_gids() const
     {
         split_gids_type gids;
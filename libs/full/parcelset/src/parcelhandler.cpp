@@ -1262,6 +1262,24 @@ namespace hpx::parcelset {
         return pp ? pp->get_zchunks_recv_size_max(reset) : 0;
     }
 
+    // number of messages sent without allocating buffer memory
+    std::int64_t parcelhandler::get_buffer_pool_hits_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_buffer_pool_hits_sent(reset) : 0;
+    }
+
+    // number of messages sent requiring to allocate buffer memory
+    std::int64_t parcelhandler::get_buffer_pool_misses_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_buffer_pool_misses_sent(reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
@@ -0,0 +1,147 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/modules/parcelset.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/detail/buffer_pool.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using hpx::parcelset::detail::buffer_pool;
+
+void test_size_classes()
+{
+    HPX_TEST_EQ(buffer_pool::size_class(0), std::size_t(0));
+    HPX_TEST_EQ(buffer_pool::size_class(1024), std::size_t(0));
+    HPX_TEST_EQ(buffer_pool::size_class(1025), std::size_t(1));
+    HPX_TEST_EQ(buffer_pool::size_class(std::size_t(1) << 20),
+        buffer_pool::num_size_classes - 1);
+    HPX_TEST_EQ(buffer_pool::size_class((std::size_t(1) << 20) + 1),
+        buffer_pool::num_size_classes);
+}
+
+void test_reuse()
+{
+    bool reused = true;
+    std::vector<char> buffer = buffer_pool::allocate(3000, reused);
+    HPX_TEST(!reused);
+    HPX_TEST(buffer.empty());
+    HPX_TEST_LTE(std::size_t(4096), buffer.capacity());
+
+    char const* data = buffer.data();
+    buffer.resize(3000);
+    buffer_pool::deallocate(std::move(buffer));
+
+    // a buffer of the same size class is taken from the pool
+    std::vector<char> reused_buffer = buffer_pool::allocate(4000, reused);
+    HPX_TEST(reused);
+    HPX_TEST(reused_buffer.empty());
+    HPX_TEST_EQ(reused_buffer.data(), data);
+
+    // a larger buffer can't be served from the pool
+    std::vector<char> larger_buffer = buffer_pool::allocate(5000, reused);
+    HPX_TEST(!reused);
+    HPX_TEST_LTE(std::size_t(8192), larger_buffer.capacity());
+
+    // a buffer of the next larger size class can serve smaller requests
+    buffer_pool::deallocate(std::move(larger_buffer));
+    std::vector<char> smaller_buffer = buffer_pool::allocate(4000, reused);
+    HPX_TEST(reused);
+    HPX_TEST_LTE(std::size_t(8192), smaller_buffer.capacity());
+
+    // large buffers are not pooled
+    std::vector<char> large_buffer =
+        buffer_pool::allocate((std::size_t(1) << 20) + 1, reused);
+    HPX_TEST(!reused);
+    buffer_pool::deallocate(std::move(large_buffer));
+    large_buffer = buffer_pool::allocate((std::size_t(1) << 20) + 1, reused);
+    HPX_TEST(!reused);
+}
+
+void test_pool_limit()
+{
+    std::vector<std::vector<char>> buffers;
+    for (std::size_t i = 0; i != 2 * buffer_pool::max_cached_buffers; ++i)
+    {
+        bool reused = false;
+        buffers.push_back(buffer_pool::allocate(1 << 16, reused));
+    }
+
+    for (auto& buffer : buffers)
+    {
+        buffer_pool::deallocate(std::move(buffer));
+    }
+
+    std::size_t num_reused = 0;
+    for (std::size_t i = 0; i != 2 * buffer_pool::max_cached_buffers; ++i)
+    {
+        bool reused = false;
+        buffers[i] = buffer_pool::allocate(1 << 16, reused);
+        if (reused)
+            ++num_reused;
+    }
+    HPX_TEST_EQ(num_reused, buffer_pool::max_cached_buffers);
+}
+
+void test_message_size_hints()
+{
+    char const* action = "test_action";
+
+    HPX_TEST_EQ(
+        hpx::parcelset::detail::get_message_size_hint(action), std::size_t(0));
+    HPX_TEST_EQ(
+        hpx::parcelset::detail::get_message_size_hint(nullptr), std::size_t(0));
+
+    // the hint follows larger messages immediately
+    hpx::parcelset::detail::update_message_size_hint(action, 1000);
+    HPX_TEST_EQ(hpx::parcelset::detail::get_message_size_hint(action),
+        std::size_t(1000));
+    hpx::parcelset::detail::update_message_size_hint(action, 8000);
+    HPX_TEST_EQ(hpx::parcelset::detail::get_message_size_hint(action),
+        std::size_t(8000));
+
+    // and decreases slowly for smaller messages
+    hpx::parcelset::detail::update_message_size_hint(action, 100);
+    HPX_TEST_EQ(hpx::parcelset::detail::get_message_size_hint(action),
+        std::size_t(7000));
+    for (int i = 0; i != 100; ++i)
+    {
+        hpx::parcelset::detail::update_message_size_hint(action, 100);
+    }
+    HPX_TEST_EQ(hpx::parcelset::detail::get_message_size_hint(action),
+        std::size_t(100));
+}
+
+void test_parcel_buffer_recycling()
+{
+    bool reused = false;
+    {
+        hpx::parcelset::parcel_buffer<> buffer;
+        buffer.data_ = buffer_pool::allocate(1 << 14, reused);
+        buffer.data_.resize(1 << 14);
+    }
+
+    // the memory of a destroyed parcel buffer is returned to the pool
+    std::vector<char> buffer = buffer_pool::allocate(1 << 14, reused);
+    HPX_TEST(reused);
+}
+
+int main()
+{
+    test_size_classes();
+    test_reuse();
+    test_pool_limit();
+    test_message_size_hints();
+    test_parcel_buffer_recycling();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -46,5 +46,12 @@ namespace hpx::parcelset {
 
         //// maximum size of zero-copy chunks
         std::int64_t size_zchunks_max_ = 0;
+
+        //// number of messages serialized into a buffer without allocating
+        //// memory (reused from a pool or from a previous message)
+        std::int64_t num_buffer_pool_hits_ = 0;
+
+        //// number of messages for which buffer memory had to be allocated
+        std::int64_t num_buffer_pool_misses_ = 0;
     };
 }    // namespace hpx::parcelset
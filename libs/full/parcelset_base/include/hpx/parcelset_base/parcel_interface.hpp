@@ -85,6 +85,7 @@ namespace hpx::parcelset::detail {
             locality const& loc) const = 0;
 
         virtual bool does_termination_detection() const = 0;
+        virtual bool is_trivially_measurable() const = 0;
 
         virtual split_gids_type move_split_gids() const = 0;
         virtual void set_split_gids(split_gids_type&& split_gids) = 0;
@@ -172,6 +173,10 @@ namespace hpx::parcelset {
 
         [[nodiscard]] bool does_termination_detection() const;
 
+        // Return whether the serialized size of this parcel can be measured
+        // before it is serialized.
+        [[nodiscard]] bool is_trivially_measurable() const;
+
         split_gids_type move_split_gids() const;
         void set_split_gids(split_gids_type&& split_gids) const;
 
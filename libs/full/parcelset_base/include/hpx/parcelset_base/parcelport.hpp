@@ -258,6 +258,12 @@ namespace hpx::parcelset {
 
         //// the maximum size of zero-copy chunks per message received
         std::int64_t get_zchunks_recv_size_max(bool reset);
+
+        //// number of messages sent without allocating buffer memory
+        std::int64_t get_buffer_pool_hits_sent(bool reset);
+
+        //// number of messages sent requiring to allocate buffer memory
+        std::int64_t get_buffer_pool_misses_sent(bool reset);
 #endif
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
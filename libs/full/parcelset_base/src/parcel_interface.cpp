@@ -168,6 +168,11 @@ namespace hpx::parcelset {
         return data_ ? data_->does_termination_detection() : false;
     }
 
+    bool parcel::is_trivially_measurable() const
+    {
+        return data_ ? data_->is_trivially_measurable() : false;
+    }
+
     parcel::split_gids_type parcel::move_split_gids() const
     {
         return data_->move_split_gids();
@@ -276,6 +276,18 @@ namespace hpx::parcelset {
     {
         return parcels_received_.size_zchunks_max(reset);
     }
+
+    //// number of messages sent without allocating buffer memory
+    std::int64_t parcelport::get_buffer_pool_hits_sent(bool reset)
+    {
+        return parcels_sent_.num_buffer_pool_hits(reset);
+    }
+
+    //// number of messages sent requiring to allocate buffer memory
+    std::int64_t parcelport::get_buffer_pool_misses_sent(bool reset)
+    {
+        return parcels_sent_.num_buffer_pool_misses(reset);
+    }
 #endif
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
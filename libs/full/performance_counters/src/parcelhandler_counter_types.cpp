@@ -121,6 +121,13 @@ namespace hpx::performance_counters {
             hpx::bind_front(
                 &parcelhandler::get_zchunks_recv_size_max, &ph, pp_type));
 
+        hpx::function<std::int64_t(bool)> buffer_pool_hits_sent(
+            hpx::bind_front(
+                &parcelhandler::get_buffer_pool_hits_sent, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> buffer_pool_misses_sent(
+            hpx::bind_front(
+                &parcelhandler::get_buffer_pool_misses_sent, &ph, pp_type));
+
         performance_counters::generic_counter_type_data const counter_types[] =
             {
                 {hpx::util::format("/parcels/count/{}/sent", pp_type),
@@ -462,6 +469,34 @@ namespace hpx::performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         HPX_MOVE(size_zchunks_recv_per_msg_max), _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/buffer_pool_hits/sent", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of messages sent using the {} "
+                        "connection type for the referenced locality that "
+                        "were serialized without allocating buffer memory",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(buffer_pool_hits_sent), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/buffer_pool_misses/sent", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of messages sent using the {} "
+                        "connection type for the referenced locality that "
+                        "required allocating buffer memory",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(buffer_pool_misses_sent), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
             };
 
         performance_counters::install_counter_types(
@@ -10,6 +10,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
@@ -347,6 +348,57 @@ namespace hpx::performance_counters::detail {
         return naming::invalid_gid;
     }
 #endif
+
+    ///////////////////////////////////////////////////////////////////////
+    // stack pool counter creation function
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+    naming::gid_type stack_pool_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        namespace posix = threads::coroutines::detail::posix;
+
+        struct creator_data
+        {
+            char const* const countername;
+            hpx::function<std::int64_t(bool)> total_func;
+        };
+
+        creator_data data[] = {
+            // /threads{locality#%d/total}/count/stack-pool-hits
+            {"count/stack-pool-hits", &posix::get_stack_pool_hit_count},
+            // /threads{locality#%d/total}/count/stack-pool-misses
+            {"count/stack-pool-misses", &posix::get_stack_pool_miss_count},
+            // /threads{locality#%d/total}/stack-pool/hit-rate
+            {"stack-pool/hit-rate", &posix::get_stack_pool_hit_rate},
+            // /threads{locality#%d/total}/stack-pool/resident-bytes
+            {"stack-pool/resident-bytes",
+                &posix::get_stack_pool_resident_bytes},
+        };
+        std::size_t const data_size = sizeof(data) / sizeof(data[0]);
+
+        for (creator_data const* d = data; d < &data[data_size]; ++d)
+        {
+            if (paths.countername_ == d->countername)
+            {
+                return counter_creator(info, paths, d->total_func,
+                    hpx::function<std::int64_t(bool)>(), "", 0, ec);
+            }
+        }
+
+        HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+            "stack_pool_counter_creator", "invalid counter instance name: {}",
+            paths.instancename_);
+        return naming::invalid_gid;
+    }
+#endif
 }    // namespace hpx::performance_counters::detail
 
 namespace hpx::performance_counters {
@@ -358,6 +410,10 @@ namespace hpx::performance_counters {
         create_counter_func counts_creator(
             hpx::bind_front(&detail::thread_counts_counter_creator));
 #endif
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+        create_counter_func stack_pool_creator(
+            hpx::bind_front(&detail::stack_pool_counter_creator));
+#endif
 
         generic_counter_type_data const counter_types[] = {
             // length of thread queue(s)
@@ -616,6 +672,33 @@ namespace hpx::performance_counters {
                 &locality_counter_discoverer, ""},
 #endif
 #endif
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+            {"/threads/count/stack-pool-hits",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks served from "
+                "the stack pool without mapping new memory for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-misses",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stack arenas mapped "
+                "by the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-pool/hit-rate", counter_type::raw,
+                "returns the ratio of HPX-thread stack allocations served "
+                "from the stack pool without mapping new memory for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, "0.01%"},
+            {"/threads/stack-pool/resident-bytes", counter_type::raw,
+                "returns the amount of memory mapped for HPX-thread stacks "
+                "by the stack pool which is currently resident in physical "
+                "memory for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, "bytes"},
+#endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses",
                 counter_type::monotonically_increasing,
@@ -677,6 +760,23 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_num_stolen_to_staged,
                     &threads::thread_pool_base::get_num_stolen_to_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/time/average-steal-latency", counter_type::raw,
+                "returns the average time between sending a steal request "
+                "and receiving the stolen HPX-threads for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_average_steal_latency,
+                    &threads::thread_pool_base::get_average_steal_latency),
+                &locality_pool_thread_counter_discoverer, "ns"},
+            {"/threads/count/average-steal-batch-size", counter_type::raw,
+                "returns the average number of HPX-threads received in "
+                "response to one steal request for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_average_steal_batch_size,
+                    &threads::thread_pool_base::get_average_steal_batch_size),
+                &locality_pool_thread_counter_discoverer, "0.01"},
 #endif
             // scheduler utilization
             {"/scheduler/utilization/instantaneous", counter_type::raw,
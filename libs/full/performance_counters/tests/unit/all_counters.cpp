@@ -59,6 +59,8 @@ char const* const locality_pool_thread_counter_names[] =
     "/threads/count/stolen-from-staged",
     "/threads/count/stolen-to-pending",
     "/threads/count/stolen-to-staged",
+    "/threads/time/average-steal-latency",
+    "/threads/count/average-steal-batch-size",
 #endif
     nullptr
 };
@@ -83,6 +85,12 @@ char const* const locality_counter_names[] = {
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
     "/threads/count/stack-unbinds",
 #endif
+#endif
+#if defined(HPX_COROUTINES_HAVE_THREAD_STACK_POOL)
+    "/threads/count/stack-pool-hits",
+    "/threads/count/stack-pool-misses",
+    "/threads/stack-pool/hit-rate",
+    "/threads/stack-pool/resident-bytes",
 #endif
     "/scheduler/utilization/instantaneous", nullptr};
 
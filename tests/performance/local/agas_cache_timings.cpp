@@ -14,6 +14,7 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/agas/detail/gva_cache.hpp>
 #include <hpx/modules/cache.hpp>
 #include <hpx/modules/preprocessor.hpp>
 #include <hpx/modules/testing.hpp>
@@ -28,6 +29,7 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -228,6 +230,101 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Concurrent lookups (and optionally updates) of the same set of entries from
+// all worker threads. The locked cache reproduces the original AGAS cache,
+// which had to be accessed under an exclusive lock even for lookups.
+struct locked_gva_cache
+{
+    explicit locked_gva_cache(std::size_t cache_size)
+    {
+        cache.reserve(cache_size);
+    }
+
+    bool get_entry(hpx::naming::gid_type const& gid, hpx::agas::gva& g)
+    {
+        gva_cache_key idbase;
+        gva_cache_type::entry_type e;
+
+        std::unique_lock<hpx::shared_mutex> l(mtx);
+        if (!cache.get_entry(gva_cache_key(gid, 1), idbase, e))
+            return false;
+
+        g = e.get();
+        return true;
+    }
+
+    void update(hpx::naming::gid_type const& gid, hpx::agas::gva const& g)
+    {
+        std::unique_lock<hpx::shared_mutex> l(mtx);
+        cache.update(gva_cache_key(gid, 1), g);
+    }
+
+    hpx::shared_mutex mtx;
+    gva_cache_type cache;
+};
+
+template <typename Cache>
+void test_contention(char const* name, Cache& cache,
+    hpx::naming::gid_type first_key, std::size_t num_entries,
+    std::size_t num_lookups, std::size_t update_interval)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = to_int(hpx::components::component_enum_type::invalid);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        cache.update(first_key + i,
+            hpx::agas::gva(locality, ct, 1, std::uint64_t(i), 0));
+    }
+
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<std::size_t>> results;
+    results.reserve(num_threads);
+    for (std::size_t thread = 0; thread != num_threads; ++thread)
+    {
+        results.push_back(hpx::async([&, thread]() {
+            std::size_t hits = 0;
+            std::size_t key = thread * (num_entries / num_threads);
+            for (std::size_t i = 0; i != num_lookups; ++i)
+            {
+                if (++key == num_entries)
+                    key = 0;
+
+                if (update_interval != 0 && i % update_interval == 0)
+                {
+                    cache.update(first_key + key,
+                        hpx::agas::gva(
+                            locality, ct, 1, std::uint64_t(key), 0));
+                    continue;
+                }
+
+                hpx::agas::gva g;
+                if (cache.get_entry(first_key + key, g))
+                    ++hits;
+            }
+            return hits;
+        }));
+    }
+
+    std::size_t hits = 0;
+    for (auto& f : results)
+    {
+        hits += f.get();
+    }
+
+    double const elapsed = t.elapsed();
+    std::cout << std::setw(10) << name << ": " << num_threads
+              << " threads, " << std::setprecision(3)
+              << (num_threads * num_lookups) / elapsed / 1e6
+              << " Mops/s, hits: " << hits << std::endl;
+
+    hpx::util::print_cdash_timing(name, elapsed);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -239,6 +336,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
+    std::size_t const num_lookups = vm["num_lookups"].as<std::size_t>();
+    std::size_t const update_interval =
+        vm["update_interval"].as<std::size_t>();
+
     gva_cache_type cache;
     cache.reserve(cache_size);
 
@@ -253,6 +354,20 @@ int hpx_main(hpx::program_options::variables_map& vm)
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
+    {
+        locked_gva_cache locked_cache(cache_size);
+        test_contention("AGASCacheContentionLocked", locked_cache,
+            hpx::detail::get_next_id(num_entries), num_entries, num_lookups,
+            update_interval);
+    }
+
+    {
+        hpx::agas::detail::gva_cache lock_free_cache(cache_size);
+        test_contention("AGASCacheContentionLockFree", lock_free_cache,
+            hpx::detail::get_next_id(num_entries), num_entries, num_lookups,
+            update_interval);
+    }
+
     return hpx::finalize();
 }
 
@@ -266,7 +381,13 @@ int main(int argc, char* argv[])
         "initial cache size (default: " HPX_PP_STRINGIZE(
             HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")("num_entries,n",
         value<std::size_t>(),
-        "number of items to insert into cache (default: 1000)");
+        "number of items to insert into cache (default: 1000)")(
+        "num_lookups", value<std::size_t>()->default_value(100000),
+        "number of concurrent lookups performed by each worker thread "
+        "(default: 100000)")("update_interval",
+        value<std::size_t>()->default_value(0),
+        "perform an update after this many concurrent lookups, zero disables "
+        "updates (default: 0)");
 
     // Initialize and run HPX
     hpx::init_params init_args;
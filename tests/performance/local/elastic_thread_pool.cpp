@@ -0,0 +1,202 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures how an elastic_pool_controller reacts to bursty
+// load. A worker pool is alternately left idle (giving the controller the
+// chance to suspend its processing units) and flooded with a burst of tasks.
+// For each burst we measure the time it takes the controller to resume the
+// first processing unit (the reaction time) and the time it takes to process
+// the whole burst (the throughput). Running with --no-elasticity gives the
+// baseline of a pool that never shrinks.
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/thread_pool_util.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+void busy_wait(std::int64_t duration_us)
+{
+    hpx::chrono::high_resolution_timer t;
+    while (t.elapsed_microseconds() < duration_us)
+    {
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const bursts = vm["bursts"].as<std::size_t>();
+    std::size_t const burst_size = vm["burst-size"].as<std::size_t>();
+    std::int64_t const task_duration = vm["task-duration"].as<std::int64_t>();
+    std::int64_t const pause = vm["pause"].as<std::int64_t>();
+    bool const elastic = vm.count("no-elasticity") == 0;
+
+    hpx::threads::thread_pool_base& tp =
+        hpx::resource::get_thread_pool("worker");
+    hpx::execution::parallel_executor exec(&tp);
+
+    hpx::threads::elasticity_parameters params;
+    params.sampling_interval =
+        std::chrono::microseconds(vm["sampling-interval"].as<std::int64_t>());
+    params.suspend_after = vm["suspend-after"].as<std::size_t>();
+    params.resume_after = vm["resume-after"].as<std::size_t>();
+
+    std::unique_ptr<hpx::threads::elastic_pool_controller> controller;
+    if (elastic)
+    {
+        controller = std::make_unique<hpx::threads::elastic_pool_controller>(
+            tp, params);
+    }
+
+    double reaction_time = 0.0;
+    std::size_t reactions = 0;
+    double burst_time = 0.0;
+    std::size_t suspended_before_burst = 0;
+
+    std::vector<hpx::future<void>> fs;
+    fs.reserve(burst_size);
+
+    for (std::size_t i = 0; i != bursts; ++i)
+    {
+        // give the controller a chance to shrink the pool
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(pause));
+
+        std::size_t const resumptions =
+            controller ? controller->get_num_resumptions() : 0;
+        if (controller)
+        {
+            suspended_before_burst +=
+                controller->get_num_suspended_processing_units();
+        }
+
+        hpx::chrono::high_resolution_timer t;
+        for (std::size_t j = 0; j != burst_size; ++j)
+        {
+            fs.push_back(hpx::async(
+                exec, [task_duration]() { busy_wait(task_duration); }));
+        }
+
+        auto all = hpx::when_all(std::move(fs));
+        fs.clear();
+
+        // wait for the controller to react to the burst
+        if (controller)
+        {
+            while (!all.is_ready() &&
+                controller->get_num_resumptions() == resumptions)
+            {
+                hpx::this_thread::yield();
+            }
+
+            if (controller->get_num_resumptions() != resumptions)
+            {
+                reaction_time += t.elapsed();
+                ++reactions;
+            }
+        }
+
+        all.get();
+        burst_time += t.elapsed();
+    }
+
+    double const tasks = static_cast<double>(bursts * burst_size);
+
+    hpx::util::format_to(std::cout,
+        "threads: {}, elasticity: {}, bursts: {}, average burst time: "
+        "{:.6f}s, throughput: {:.1f} tasks/s\n",
+        hpx::resource::get_num_threads("worker"), elastic ? "on" : "off",
+        bursts, burst_time / static_cast<double>(bursts), tasks / burst_time);
+
+    if (controller)
+    {
+        controller->stop();
+
+        hpx::util::format_to(std::cout,
+            "average suspended processing units before burst: {:.2f}, "
+            "average reaction time: {:.6f}s ({} of {} bursts), "
+            "suspensions: {}, resumptions: {}\n",
+            static_cast<double>(suspended_before_burst) /
+                static_cast<double>(bursts),
+            reactions != 0 ? reaction_time / static_cast<double>(reactions) :
+                             0.0,
+            reactions, bursts, controller->get_num_suspensions(),
+            controller->get_num_resumptions());
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("bursts", value<std::size_t>()->default_value(20),
+            "number of bursts of tasks")
+        ("burst-size", value<std::size_t>()->default_value(10000),
+            "number of tasks per burst")
+        ("task-duration", value<std::int64_t>()->default_value(50),
+            "duration of each task (in microseconds)")
+        ("pause", value<std::int64_t>()->default_value(200),
+            "idle time between bursts (in milliseconds)")
+        ("sampling-interval", value<std::int64_t>()->default_value(1000),
+            "sampling interval of the controller (in microseconds)")
+        ("suspend-after", value<std::size_t>()->default_value(100),
+            "number of idle samples before suspending a processing unit")
+        ("resume-after", value<std::size_t>()->default_value(1),
+            "number of samples with backlog before resuming processing units")
+        ("no-elasticity", "do not control the worker pool")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.rp_callback = [](auto& rp, variables_map const&) {
+        // leave one processing unit to the default pool, which runs
+        // hpx_main
+        rp.create_thread_pool("worker",
+            hpx::resource::scheduling_policy::local_priority_fifo,
+            hpx::threads::policies::scheduler_mode::default_ |
+                hpx::threads::policies::scheduler_mode::enable_elasticity);
+
+        std::size_t const worker_pool_threads =
+            rp.get_number_requested_threads() - 1;
+        std::size_t worker_pool_threads_added = 0;
+
+        for (hpx::resource::numa_domain const& d : rp.numa_domains())
+        {
+            for (hpx::resource::core const& c : d.cores())
+            {
+                for (hpx::resource::pu const& p : c.pus())
+                {
+                    if (worker_pool_threads_added < worker_pool_threads)
+                    {
+                        rp.add_resource(p, "worker");
+                        ++worker_pool_threads_added;
+                    }
+                }
+            }
+        }
+    };
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,109 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This example benchmarks the time it takes to enter and exit a parallel
+// region on a fork_join_executor if the parallel regions are separated by
+// idle periods of a given length. This is meant to be compared to
+// openmp_parallel_region. The consumed CPU time shows how much time the idle
+// worker threads of the executor spend spinning between the regions.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+using hpx::execution::experimental::fork_join_executor;
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const repetitions = vm["repetitions"].as<std::uint64_t>();
+    auto const gap = std::chrono::microseconds(vm["gap"].as<std::uint64_t>());
+    auto const yield_delay =
+        std::chrono::microseconds(vm["yield-delay"].as<std::uint64_t>());
+    std::string const policy_name = vm["idle-policy"].as<std::string>();
+
+    auto const policy = policy_name == "adaptive" ?
+        fork_join_executor::idle_policy::adaptive :
+        fork_join_executor::idle_policy::fixed;
+
+    fork_join_executor exec(hpx::threads::thread_priority::bound,
+        hpx::threads::thread_stacksize::small_,
+        fork_join_executor::loop_schedule::static_, yield_delay, policy);
+
+    std::size_t const threads = hpx::get_num_worker_threads();
+
+    // Do one warmup iteration
+    hpx::experimental::for_loop(hpx::execution::par.on(exec), std::size_t(0),
+        threads, [](std::size_t) {});
+
+    std::cout << "threads, idle policy, gap [s], parallel region [s]"
+              << std::endl;
+
+    hpx::chrono::high_resolution_timer timer;
+    double total_time = 0;
+    std::clock_t const cpu_start = std::clock();
+
+    for (std::size_t i = 0; i < repetitions; ++i)
+    {
+        hpx::this_thread::sleep_for(gap);
+
+        timer.restart();
+
+        hpx::experimental::for_loop(hpx::execution::par.on(exec),
+            std::size_t(0), threads, [](std::size_t) {});
+
+        auto t_parallel = timer.elapsed();
+        total_time += t_parallel;
+
+        std::cout << threads << ", " << policy << ", "
+                  << std::chrono::duration<double>(gap).count() << ", "
+                  << t_parallel << std::endl;
+    }
+
+    double const cpu_time =
+        static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+
+    std::cout << "average parallel region [s]: "
+              << total_time / static_cast<double>(repetitions)
+              << ", consumed cpu time [s]: " << cpu_time << std::endl;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char** argv)
+{
+    using namespace hpx::program_options;
+
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("repetitions", value<std::uint64_t>()->default_value(100),
+            "Number of repetitions")
+        ("gap", value<std::uint64_t>()->default_value(1000),
+            "Idle time between parallel regions (in microseconds)")
+        ("yield-delay", value<std::uint64_t>()->default_value(300),
+            "Time after which idle worker threads yield (in microseconds)")
+        ("idle-policy", value<std::string>()->default_value("adaptive"),
+            "Policy of idle worker threads (fixed or adaptive)")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -26,8 +26,10 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -88,6 +90,29 @@ char const* exec_name(hpx::execution::experimental::scheduler_executor<
     return "scheduler_executor<thread_pool_scheduler>";
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// count the number of (global) allocations to be able to report the number of
+// allocations per future
+std::atomic<std::uint64_t> num_allocations(0);
+
+void* operator new(std::size_t size)
+{
+    num_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // we use globals here to prevent the delay from being optimized away
 double volatile global_scratch = 0;
@@ -318,6 +343,50 @@ void measure_function_futures_for_loop(std::uint64_t count, bool csv,
         executor_name ? executor_name : exec_name(exec), count, duration, csv);
 }
 
+// Time long chains of continuations, report the number of allocations needed
+// for each attached continuation
+template <typename Policy>
+void measure_function_futures_then_chain(
+    std::uint64_t count, bool csv, Policy policy, char const* policy_name)
+{
+    constexpr std::uint64_t chain_length = 1000;
+    std::uint64_t const num_chains =
+        (count + chain_length - 1) / chain_length;
+
+    std::uint64_t const allocations_before = num_allocations.load();
+
+    // start the clock
+    high_resolution_timer const walltime;
+    for (std::uint64_t i = 0; i < num_chains; ++i)
+    {
+        hpx::promise<double> p;
+        future<double> f = p.get_future();
+        for (std::uint64_t j = 0; j < chain_length; ++j)
+        {
+            f = f.then(policy,
+                [](future<double>&& r) { return r.get() + null_function(); });
+        }
+        p.set_value(0.0);
+        global_scratch = global_scratch + f.get();
+    }
+
+    // stop the clock
+    double const duration = walltime.elapsed();
+
+    std::uint64_t const num_then = num_chains * chain_length;
+    print_stats("then", "Chain", policy_name,
+        static_cast<std::int64_t>(num_then), duration, csv);
+
+    if (!csv)
+    {
+        std::cout << "allocations per then: "
+                  << static_cast<double>(
+                         num_allocations.load() - allocations_before) /
+                static_cast<double>(num_then)
+                  << std::endl;
+    }
+}
+
 void measure_function_futures_register_work(std::uint64_t count, bool csv)
 {
     hpx::latch l(static_cast<std::int64_t>(count));
@@ -539,6 +608,10 @@ int hpx_main(variables_map& vm)
                 measure_function_futures_for_loop(count, csv, sched_exec_tps);
                 measure_function_futures_for_loop(
                     count, csv, par_nostack, "parallel_executor_nostack");
+                measure_function_futures_then_chain(
+                    count, csv, hpx::launch::sync, "launch::sync");
+                measure_function_futures_then_chain(
+                    count, csv, hpx::launch::async, "launch::async");
                 measure_function_futures_register_work(count, csv);
                 measure_function_futures_create_thread(count, csv);
                 measure_function_futures_apply_hierarchical_placement(
@@ -25,6 +25,7 @@
 #include <hpx/modules/compute_local.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/util/adapt_static_placement.hpp>
 #include <hpx/thread.hpp>
 #include <hpx/version.hpp>
 
@@ -601,10 +602,24 @@ int hpx_main(hpx::program_options::variables_map& vm)
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
                 std::move(alloc), std::move(policy));
         }
+        else if (executor == 6)
+        {
+            // Parallel policy with static placement of the chunks onto the
+            // cores and allocator with the same policy. The arrays are first
+            // touched from the cores that access them in all of the kernels.
+            auto policy = hpx::execution::experimental::adapt_static_placement(
+                hpx::execution::par);
+            hpx::compute::host::detail::policy_allocator<STREAM_TYPE,
+                decltype(policy)>
+                alloc(policy);
+
+            timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
+                std::move(alloc), std::move(policy));
+        }
         else
         {
             HPX_THROW_EXCEPTION(hpx::error::commandline_option_error,
-                "hpx_main", "Invalid executor id given (0-4 allowed");
+                "hpx_main", "Invalid executor id given (0-6 allowed");
         }
     }
     time_total = mysecond() - time_total;
@@ -658,10 +673,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 "max,add_bytes,add_bw,add_avg,add_min,add_max,triad_bytes,"
                 "triad_bw,triad_avg,triad_min,triad_max\n");
         }
-        std::size_t const num_executors = 6;
+        std::size_t const num_executors = 7;
         const char* executors[num_executors] = {"parallel-serial", "block",
             "parallel-parallel", "fork_join_executor", "scheduler_executor",
-            "block_fork_join_executor"};
+            "block_fork_join_executor", "parallel-static-placement"};
         hpx::util::format_to(std::cout, "{},{},{},", executors[executor],
             hpx::get_os_thread_count(), vector_size);
     }
@@ -737,7 +752,7 @@ int main(int argc, char* argv[])
             "size of vector (default: 1024)")
         (   "executor",
             hpx::program_options::value<std::size_t>()->default_value(2),
-            "executor to use (0-5) (default: 2, parallel_executor)")
+            "executor to use (0-6) (default: 2, parallel_executor)")
         ;
     // clang-format on
 
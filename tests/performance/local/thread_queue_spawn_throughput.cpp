@@ -0,0 +1,164 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the task spawn throughput of a thread pool when all
+// worker threads create (and terminate) tasks concurrently. It compares the
+// thread_queue with its default, mutex-protected bookkeeping against the
+// sharded bookkeeping selected by the sharded_bookkeeping queuing policy.
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/thread_pools.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t tasks_per_thread = 100000;
+std::uint64_t repetitions = 5;
+std::string queue_name;
+
+std::atomic<std::uint64_t> remaining(0);
+
+void empty_task(hpx::latch& done)
+{
+    if (--remaining == 0)
+    {
+        done.count_down(1);
+    }
+}
+
+void spawn_tasks(hpx::latch& done)
+{
+    for (std::uint64_t i = 0; i != tasks_per_thread; ++i)
+    {
+        hpx::post(&empty_task, std::ref(done));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+    std::uint64_t const num_tasks = tasks_per_thread * num_threads;
+
+    double best_time = 0.0;
+    for (std::uint64_t r = 0; r != repetitions; ++r)
+    {
+        remaining = num_tasks;
+        hpx::latch done(1);
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        // spawn tasks from all worker threads concurrently
+        std::vector<hpx::future<void>> spawners;
+        spawners.reserve(num_threads);
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            auto policy = hpx::execution::experimental::with_hint(
+                hpx::launch::async,
+                hpx::threads::thread_schedule_hint(
+                    static_cast<std::int16_t>(i)));
+            spawners.push_back(
+                hpx::async(policy, &spawn_tasks, std::ref(done)));
+        }
+
+        hpx::wait_all(spawners);
+        done.wait();
+
+        std::uint64_t const end = hpx::chrono::high_resolution_clock::now();
+
+        double const elapsed = static_cast<double>(end - start) / 1e9;
+        if (r == 0 || elapsed < best_time)
+            best_time = elapsed;
+    }
+
+    std::cout << "queue: " << queue_name << ", threads: " << num_threads
+              << ", tasks: " << num_tasks << ", time: " << best_time
+              << " [s], throughput: "
+              << static_cast<double>(num_tasks) / best_time << " [tasks/s]"
+              << std::endl;
+
+    hpx::util::print_cdash_timing(
+        ("TaskSpawnThroughput_" + queue_name).c_str(), best_time);
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Scheduler>
+std::unique_ptr<hpx::threads::thread_pool_base> create_pool(
+    hpx::threads::thread_pool_init_parameters thread_pool_init,
+    hpx::threads::policies::thread_queue_init_parameters thread_queue_init)
+{
+    typename Scheduler::init_parameter_type init(thread_pool_init.num_threads_,
+        thread_pool_init.affinity_data_, thread_pool_init.num_threads_,
+        thread_queue_init, "thread_queue_spawn_throughput");
+
+    std::unique_ptr<Scheduler> scheduler(new Scheduler(init));
+    scheduler->set_scheduler_mode(thread_pool_init.mode_);
+
+    return std::unique_ptr<hpx::threads::thread_pool_base>(
+        new hpx::threads::detail::scheduled_thread_pool<Scheduler>(
+            std::move(scheduler), thread_pool_init));
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks", value<std::uint64_t>(&tasks_per_thread)->default_value(100000),
+         "number of tasks to spawn per worker thread (default: 100000)")
+        ("repetitions", value<std::uint64_t>(&repetitions)->default_value(5),
+         "number of times to repeat the benchmark (default: 5)")
+        ("queue", value<std::string>(&queue_name)->default_value("sharded"),
+         "thread queue bookkeeping to use, 'locked' or 'sharded' "
+         "(default: sharded)");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.rp_callback = [](auto& rp, variables_map const& vm) {
+        using locked_scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo>;
+        using sharded_scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo,
+                hpx::threads::policies::sharded_bookkeeping<
+                    hpx::threads::policies::lockfree_fifo>>;
+
+        if (vm["queue"].as<std::string>() == "locked")
+        {
+            rp.create_thread_pool(
+                "default", &create_pool<locked_scheduler_type>);
+        }
+        else
+        {
+            rp.create_thread_pool(
+                "default", &create_pool<sharded_scheduler_type>);
+        }
+    };
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,171 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overhead of timed thread suspension when many
+// HPX threads are waiting with a timeout at the same time. It compares the
+// asio based timer service with the timer wheel driven by the scheduling
+// loop (see hpx.timer_service). Two scenarios are measured: all timeouts
+// expire, and all sleeping threads are woken up before their timeout expires
+// which requires canceling the timers.
+
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/set_thread_state_timed.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t num_waiters = 10000;
+std::uint64_t timeout_us = 1000;
+std::uint64_t repetitions = 5;
+
+std::atomic<std::uint64_t> total_lateness(0);
+
+void sleeping_task(std::uint64_t i, hpx::latch& done)
+{
+    // spread the timeouts over [timeout, 2 * timeout]
+    auto const duration =
+        std::chrono::microseconds(timeout_us + i % (timeout_us + 1));
+
+    auto const start = std::chrono::steady_clock::now();
+    hpx::this_thread::sleep_for(duration);
+    auto const lateness = std::chrono::steady_clock::now() - start - duration;
+
+    total_lateness += static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(lateness)
+            .count());
+    done.count_down(1);
+}
+
+double measure_expiring_timeouts(double& mean_lateness)
+{
+    double best_time = 0.0;
+    for (std::uint64_t r = 0; r != repetitions; ++r)
+    {
+        total_lateness = 0;
+        hpx::latch done(static_cast<std::ptrdiff_t>(num_waiters + 1));
+
+        hpx::chrono::high_resolution_timer t;
+        for (std::uint64_t i = 0; i != num_waiters; ++i)
+        {
+            hpx::post(&sleeping_task, i, std::ref(done));
+        }
+        done.arrive_and_wait();
+
+        double const elapsed = t.elapsed();
+        if (r == 0 || elapsed < best_time)
+        {
+            best_time = elapsed;
+            mean_lateness = static_cast<double>(total_lateness) /
+                static_cast<double>(num_waiters);
+        }
+    }
+    return best_time;
+}
+
+double measure_canceled_timeouts()
+{
+    double best_time = 0.0;
+    for (std::uint64_t r = 0; r != repetitions; ++r)
+    {
+        std::vector<hpx::threads::thread_id_type> ids(num_waiters);
+
+        hpx::latch waiting(static_cast<std::ptrdiff_t>(num_waiters + 1));
+        hpx::latch done(static_cast<std::ptrdiff_t>(num_waiters + 1));
+
+        hpx::chrono::high_resolution_timer t;
+        for (std::uint64_t i = 0; i != num_waiters; ++i)
+        {
+            hpx::post([&, i]() {
+                ids[i] = hpx::threads::get_self_id();
+                waiting.count_down(1);
+                hpx::this_thread::sleep_for(std::chrono::seconds(60));
+                done.count_down(1);
+            });
+        }
+        waiting.arrive_and_wait();
+
+        // wake up all threads before their timeout expires, this will retry
+        // for threads which have not been suspended yet
+        for (auto const& id : ids)
+        {
+            hpx::threads::set_thread_state(id,
+                hpx::threads::thread_schedule_state::pending,
+                hpx::threads::thread_restart_state::signaled);
+        }
+        done.arrive_and_wait();
+
+        double const elapsed = t.elapsed();
+        if (r == 0 || elapsed < best_time)
+            best_time = elapsed;
+    }
+    return best_time;
+}
+
+void run_benchmark(char const* service)
+{
+    double mean_lateness = 0.0;
+    double const expiring = measure_expiring_timeouts(mean_lateness);
+    double const canceled = measure_canceled_timeouts();
+
+    std::cout << "service: " << service << ", waiters: " << num_waiters
+              << ", expiring: " << expiring
+              << " [s], mean lateness: " << mean_lateness
+              << " [us], canceled: " << canceled << " [s]" << std::endl;
+
+    hpx::util::print_cdash_timing(
+        (std::string("TimeoutsExpiring_") + service).c_str(), expiring);
+    hpx::util::print_cdash_timing(
+        (std::string("TimeoutsCanceled_") + service).c_str(), canceled);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // switching the timer service is safe here as no timers are pending
+    // between the runs
+    hpx::threads::detail::use_timer_wheel = false;
+    run_benchmark("asio");
+
+    hpx::threads::detail::use_timer_wheel = true;
+    run_benchmark("wheel");
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("waiters", value<std::uint64_t>(&num_waiters)->default_value(10000),
+         "number of threads concurrently waiting with a timeout "
+         "(default: 10000)")
+        ("timeout", value<std::uint64_t>(&timeout_us)->default_value(1000),
+         "minimal timeout in microseconds (default: 1000)")
+        ("repetitions", value<std::uint64_t>(&repetitions)->default_value(5),
+         "number of times to repeat the benchmark (default: 5)");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
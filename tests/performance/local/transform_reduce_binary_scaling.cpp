@@ -47,6 +47,23 @@ float measure_inner_product(ExPolicy&& policy, std::vector<float> const& data1,
         std::begin(data2), 0.0f, ::multiplies(), ::plus());
 }
 
+// The asynchronous algorithm returns a sender (no futures are created for the
+// chunks) that is composed with a continuation before waiting for it.
+template <typename ExPolicy>
+float measure_inner_product_sender(ExPolicy&& policy,
+    std::vector<float> const& data1, std::vector<float> const& data2)
+{
+    namespace ex = hpx::execution::experimental;
+    namespace tt = hpx::this_thread::experimental;
+
+    auto result = tt::sync_wait(ex::then(
+        hpx::transform_reduce(policy, std::begin(data1), std::end(data1),
+            std::begin(data2), 0.0f, ::multiplies(), ::plus()),
+        [](float value) { return value * 2.0f; }));
+
+    return hpx::get<0>(*result);
+}
+
 template <typename ExPolicy>
 std::int64_t measure_inner_product(int count, ExPolicy&& policy,
     std::vector<float> const& data1, std::vector<float> const& data2)
@@ -63,6 +80,22 @@ std::int64_t measure_inner_product(int count, ExPolicy&& policy,
         count;
 }
 
+template <typename ExPolicy>
+std::int64_t measure_inner_product_sender(int count, ExPolicy&& policy,
+    std::vector<float> const& data1, std::vector<float> const& data2)
+{
+    std::int64_t start =
+        static_cast<std::int64_t>(hpx::chrono::high_resolution_clock::now());
+
+    for (int i = 0; i != count; ++i)
+        measure_inner_product_sender(policy, data1, data2);
+
+    return (static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now()) -
+               start) /
+        count;
+}
+
 int hpx_main(hpx::program_options::variables_map& vm)
 {
     unsigned int seed = (unsigned int) std::random_device{}();
@@ -97,10 +130,21 @@ int hpx_main(hpx::program_options::variables_map& vm)
         std::uint64_t tr_time_par = measure_inner_product(
             test_count, hpx::execution::par, data1, data2);
 
+        // sender based execution on the thread pool scheduler (uses the bulk
+        // algorithm of the scheduler)
+        namespace ex = hpx::execution::experimental;
+        auto exec =
+            ex::explicit_scheduler_executor(ex::thread_pool_scheduler{});
+
+        std::uint64_t tr_time_sender = measure_inner_product_sender(
+            test_count, hpx::execution::par(hpx::execution::task).on(exec),
+            data1, data2);
+
         if (csvoutput)
         {
             std::cout << "," << static_cast<double>(tr_time_par) / 1e9 << ","
-                      << static_cast<double>(tr_time_datapar) / 1e9 << "\n"
+                      << static_cast<double>(tr_time_datapar) / 1e9 << ","
+                      << static_cast<double>(tr_time_sender) / 1e9 << "\n"
                       << std::flush;
         }
         else
@@ -111,6 +155,9 @@ int hpx_main(hpx::program_options::variables_map& vm)
                       << "transform_reduce(datapar): " << std::right
                       << std::setw(15)
                       << static_cast<double>(tr_time_datapar) / 1e9 << "\n"
+                      << "transform_reduce(sender): " << std::right
+                      << std::setw(15)
+                      << static_cast<double>(tr_time_sender) / 1e9 << "\n"
                       << std::flush;
         }
     }